@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/difftest.cpp" "CMakeFiles/c166_difftest.dir/difftest.cpp.o" "gcc" "CMakeFiles/c166_difftest.dir/difftest.cpp.o.d"
+  "/root/repo/src/emulator.cpp" "CMakeFiles/c166_difftest.dir/root/repo/src/emulator.cpp.o" "gcc" "CMakeFiles/c166_difftest.dir/root/repo/src/emulator.cpp.o.d"
+  "/root/repo/src/lift.cpp" "CMakeFiles/c166_difftest.dir/root/repo/src/lift.cpp.o" "gcc" "CMakeFiles/c166_difftest.dir/root/repo/src/lift.cpp.o.d"
+  "/root/repo/src/state.cpp" "CMakeFiles/c166_difftest.dir/root/repo/src/state.cpp.o" "gcc" "CMakeFiles/c166_difftest.dir/root/repo/src/state.cpp.o.d"
+  "/root/repo/src/util.cpp" "CMakeFiles/c166_difftest.dir/root/repo/src/util.cpp.o" "gcc" "CMakeFiles/c166_difftest.dir/root/repo/src/util.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/c166_difftest.dir/difftest.cpp.o"
+  "CMakeFiles/c166_difftest.dir/difftest.cpp.o.d"
+  "CMakeFiles/c166_difftest.dir/root/repo/src/emulator.cpp.o"
+  "CMakeFiles/c166_difftest.dir/root/repo/src/emulator.cpp.o.d"
+  "CMakeFiles/c166_difftest.dir/root/repo/src/lift.cpp.o"
+  "CMakeFiles/c166_difftest.dir/root/repo/src/lift.cpp.o.d"
+  "CMakeFiles/c166_difftest.dir/root/repo/src/state.cpp.o"
+  "CMakeFiles/c166_difftest.dir/root/repo/src/state.cpp.o.d"
+  "CMakeFiles/c166_difftest.dir/root/repo/src/util.cpp.o"
+  "CMakeFiles/c166_difftest.dir/root/repo/src/util.cpp.o.d"
+  "c166_difftest"
+  "c166_difftest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/c166_difftest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -5,14 +5,26 @@
 
 #include <binaryninjaapi.h>
 
+#include <algorithm>
 #include <cstring>
+#include <fstream>
+#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "busconfig.h"
+#include "conditions.h"
+#include "elf.h"
+#include "firmware.h"
 #include "flags.h"
+#include "import.h"
 #include "instructions.h"
+#include "intrinsics.h"
+#include "mapfile.h"
 #include "opcodes.h"
 #include "registers.h"
+#include "signatures.h"
 #include "util.h"
 
 namespace BN = BinaryNinja;
@@ -47,8 +59,10 @@ BNRegisterInfo C166Architecture::RegisterInfo(const uint32_t fullWidthReg,
   return 2;
 }
 
+// Instructions are at most 4 bytes, but the lifter is offered two of them so
+// that ADD/ADDC and SUB/SUBC pairs can be fused (see LiftLongArith)
 [[nodiscard]] size_t C166Architecture::GetMaxInstructionLength() const {
-  return 4;
+  return 8;
 }
 
 std::vector<uint32_t> C166Architecture::GetAllRegisters() {
@@ -62,7 +76,10 @@ std::vector<uint32_t> C166Architecture::GetAllRegisters() {
       Registers::RL4, Registers::RH4,       Registers::RL5,     Registers::RH5,
       Registers::RL6, Registers::RH6,       Registers::RL7,     Registers::RH7,
       Registers::CSP, Registers::CPUCON1,   Registers::CPUCON2, Registers::PSW,
-      Registers::CP,  Registers::VIRTUAL_LR};
+      Registers::CP,  Registers::VIRTUAL_LR,
+      Registers::MD,  Registers::MDH,       Registers::MDL,
+      Registers::DPP, Registers::DPP0,      Registers::DPP1,    Registers::DPP2,
+      Registers::DPP3, Registers::SP};
 }
 
 std::vector<uint32_t> C166Architecture::GetFullWidthRegisters() {
@@ -72,13 +89,16 @@ std::vector<uint32_t> C166Architecture::GetFullWidthRegisters() {
       Registers::R8,  Registers::R9,        Registers::R10,     Registers::R11,
       Registers::R12, Registers::R13,       Registers::R14,     Registers::R15,
       Registers::CSP, Registers::CPUCON1,   Registers::CPUCON2, Registers::PSW,
-      Registers::CP,  Registers::VIRTUAL_LR};
+      Registers::CP,  Registers::VIRTUAL_LR,
+      Registers::MD,  Registers::DPP,       Registers::SP};
 }
 
 std::vector<uint32_t> C166Architecture::GetGlobalRegisters() {
   return std::vector<uint32_t>{Registers::CSP,     Registers::CPUCON1,
                                Registers::CPUCON2, Registers::PSW,
-                               Registers::CP,      Registers::VIRTUAL_LR};
+                               Registers::CP,      Registers::VIRTUAL_LR,
+                               Registers::MD,      Registers::DPP,
+                               Registers::SP};
 }
 
 BNRegisterInfo C166Architecture::GetRegisterInfo(const uint32_t rid) {
@@ -159,6 +179,24 @@ BNRegisterInfo C166Architecture::GetRegisterInfo(const uint32_t rid) {
       return RegisterInfo(Registers::CP, 0, 2);
     case Registers::VIRTUAL_LR:
       return RegisterInfo(Registers::VIRTUAL_LR, 0, 2);
+    case Registers::MD:
+      return RegisterInfo(Registers::MD, 0, 4);
+    case Registers::MDL:
+      return RegisterInfo(Registers::MD, 0, 2);
+    case Registers::MDH:
+      return RegisterInfo(Registers::MD, 2, 2);
+    case Registers::DPP:
+      return RegisterInfo(Registers::DPP, 0, 8);
+    case Registers::DPP0:
+      return RegisterInfo(Registers::DPP, 0, 2);
+    case Registers::DPP1:
+      return RegisterInfo(Registers::DPP, 2, 2);
+    case Registers::DPP2:
+      return RegisterInfo(Registers::DPP, 4, 2);
+    case Registers::DPP3:
+      return RegisterInfo(Registers::DPP, 6, 2);
+    case Registers::SP:
+      return RegisterInfo(Registers::SP, 0, 2);
     default:
       return RegisterInfo(0, 0, 0);
   }
@@ -195,8 +233,11 @@ std::string C166Architecture::GetFlagName(const uint32_t flag) {
 }
 
 std::vector<uint32_t> C166Architecture::GetAllFlagWriteTypes() {
-  return std::vector<uint32_t>{Flags::WRITE_ALL, Flags::WRITE_Z,
-                               Flags::WRITE_EZN};
+  return std::vector<uint32_t>{Flags::WRITE_ALL,   Flags::WRITE_Z,
+                               Flags::WRITE_EZN,   Flags::WRITE_LOGIC,
+                               Flags::WRITE_ZN,    Flags::WRITE_ZNC,
+                               Flags::WRITE_ZNV,   Flags::WRITE_ZNVC,
+                               Flags::WRITE_BIT};
 }
 
 std::string C166Architecture::GetFlagWriteTypeName(const uint32_t wtype) {
@@ -207,6 +248,18 @@ std::string C166Architecture::GetFlagWriteTypeName(const uint32_t wtype) {
       return "z";
     case Flags::WRITE_EZN:
       return "ezn";
+    case Flags::WRITE_LOGIC:
+      return "logic";
+    case Flags::WRITE_ZN:
+      return "zn";
+    case Flags::WRITE_ZNC:
+      return "znc";
+    case Flags::WRITE_ZNV:
+      return "znv";
+    case Flags::WRITE_ZNVC:
+      return "znvc";
+    case Flags::WRITE_BIT:
+      return "bit";
     default:
       BN::LogError("%s: Invalid id: %u", __func__, wtype);
       return "?W?";
@@ -215,40 +268,25 @@ std::string C166Architecture::GetFlagWriteTypeName(const uint32_t wtype) {
 
 std::vector<uint32_t> C166Architecture::GetFlagsWrittenByFlagWriteType(
     uint32_t wtype) {
-  switch (wtype) {
-    case Flags::WRITE_ALL:
-      return std::vector<uint32_t>{Flags::FLAG_NEGATIVE, Flags::FLAG_CARRY,
-                                   Flags::FLAG_OVERFLOW, Flags::FLAG_ZERO,
-                                   Flags::FLAG_E};
-    case Flags::WRITE_Z:
-      return std::vector<uint32_t>{Flags::FLAG_ZERO};
-    case Flags::WRITE_EZN:
-      return std::vector<uint32_t>{Flags::FLAG_E, Flags::FLAG_ZERO,
-                                   Flags::FLAG_NEGATIVE};
-    default:
-      BN::LogError("%s: Invalid write type id: %u", __func__, wtype);
-      return {};
-  }
+  return Flags::GetFlagsWritten(wtype);
+}
+
+BN::ExprId C166Architecture::GetFlagWriteLowLevelIL(
+    const BNLowLevelILOperation op, const size_t size, const uint32_t wtype,
+    const uint32_t flag, BNRegisterOrConstant *operands,
+    const size_t operandCount, BN::LowLevelILFunction &il) {
+  BN::ExprId result;
+  if (Flags::GetFlagWriteLowLevelIL(op, size, wtype, flag, operands,
+                                    operandCount, il, result))
+    return result;
+
+  return BN::Architecture::GetFlagWriteLowLevelIL(op, size, wtype, flag,
+                                                  operands, operandCount, il);
 }
 
-// TODO: Learn about semantic flag classes
 BNFlagRole C166Architecture::GetFlagRole(const uint32_t flag,
                                          uint32_t sem_class) {
-  switch (flag) {
-    case Flags::FLAG_NEGATIVE:
-      return NegativeSignFlagRole;
-    case Flags::FLAG_CARRY:
-      return CarryFlagRole;
-    case Flags::FLAG_OVERFLOW:
-      return OverflowFlagRole;
-    case Flags::FLAG_ZERO:
-      return ZeroFlagRole;
-    case Flags::FLAG_E:
-      return SpecialFlagRole;
-    default:
-      BN::LogError("%s: Invalid id: %u", __func__, flag);
-      return SpecialFlagRole;
-  }
+  return Flags::GetFlagRole(flag);
 }
 
 std::vector<uint32_t> C166Architecture::GetFlagsRequiredForFlagCondition(
@@ -289,6 +327,183 @@ std::vector<uint32_t> C166Architecture::GetFlagsRequiredForFlagCondition(
   }
 }
 
+std::vector<uint32_t> C166Architecture::GetAllSemanticFlagClasses() {
+  return std::vector<uint32_t>{Flags::CLASS_ARITH, Flags::CLASS_LOGIC};
+}
+
+std::string C166Architecture::GetSemanticFlagClassName(
+    const uint32_t sem_class) {
+  switch (sem_class) {
+    case Flags::CLASS_ARITH:
+      return "arith";
+    case Flags::CLASS_LOGIC:
+      return "logic";
+    default:
+      return "";
+  }
+}
+
+uint32_t C166Architecture::GetSemanticClassForFlagWriteType(
+    const uint32_t wtype) {
+  switch (wtype) {
+    case Flags::WRITE_ALL:
+      return Flags::CLASS_ARITH;
+    case Flags::WRITE_LOGIC:
+    case Flags::WRITE_ZN:  // BFLDL/BFLDH
+      return Flags::CLASS_LOGIC;
+    case Flags::WRITE_ZNV:   // MUL/DIV can set V
+    case Flags::WRITE_ZNC:   // SHL/ROL set C
+    case Flags::WRITE_ZNVC:  // SHR/ROR/ASHR set V and C
+    case Flags::WRITE_BIT:   // Set explicitly from the bit operands
+    default:
+      return 0;
+  }
+}
+
+// Each condition code except cc_UC has a semantic flag group with the same id,
+// see Instruction::GetCondition
+std::vector<uint32_t> C166Architecture::GetAllSemanticFlagGroups() {
+  return std::vector<uint32_t>{
+      Conditions::CC_Z,   Conditions::CC_NZ,  Conditions::CC_V,
+      Conditions::CC_NV,  Conditions::CC_N,   Conditions::CC_NN,
+      Conditions::CC_ULT, Conditions::CC_ULE, Conditions::CC_UGE,
+      Conditions::CC_UGT, Conditions::CC_SLT, Conditions::CC_SLE,
+      Conditions::CC_SGE, Conditions::CC_SGT, Conditions::CC_NET};
+}
+
+std::string C166Architecture::GetSemanticFlagGroupName(
+    const uint32_t sem_group) {
+  return Instruction::ConditionCodeToString(sem_group);
+}
+
+std::vector<uint32_t> C166Architecture::GetFlagsRequiredForSemanticFlagGroup(
+    const uint32_t sem_group) {
+  if (sem_group == Conditions::CC_NET) {
+    return std::vector<uint32_t>{Flags::FLAG_ZERO, Flags::FLAG_E};
+  }
+
+  return GetFlagsRequiredForFlagCondition(
+      Instruction::GetFlagCondition(sem_group), 0);
+}
+
+std::map<uint32_t, BNLowLevelILFlagCondition>
+C166Architecture::GetFlagConditionsForSemanticFlagGroup(
+    const uint32_t sem_group) {
+  // cc_NET has no standard equivalent and is always built by
+  // GetSemanticFlagGroupLowLevelIL
+  if (sem_group == Conditions::CC_NET) {
+    return {};
+  }
+
+  const BNLowLevelILFlagCondition cond =
+      Instruction::GetFlagCondition(sem_group);
+
+  return std::map<uint32_t, BNLowLevelILFlagCondition>{
+      {0, cond}, {Flags::CLASS_ARITH, cond}, {Flags::CLASS_LOGIC, cond}};
+}
+
+BN::ExprId C166Architecture::GetFlagConditionLowLevelIL(
+    const BNLowLevelILFlagCondition cond, const uint32_t sem_class,
+    BN::LowLevelILFunction &il) {
+  if (sem_class == Flags::CLASS_LOGIC) {
+    // With C and V clear the unsigned and overflow conditions are constant and
+    // the signed ones only depend on Z and N
+    switch (cond) {
+      case LLFC_ULT:
+      case LLFC_O:
+        return il.Const(0, 0);
+      case LLFC_UGE:
+      case LLFC_NO:
+        return il.Const(0, 1);
+      case LLFC_ULE:
+        return il.Flag(Flags::FLAG_ZERO);
+      case LLFC_UGT:
+        return il.Not(0, il.Flag(Flags::FLAG_ZERO));
+      case LLFC_SLT:
+        return il.Flag(Flags::FLAG_NEGATIVE);
+      case LLFC_SGE:
+        return il.Not(0, il.Flag(Flags::FLAG_NEGATIVE));
+      case LLFC_SLE:
+        return il.Or(0, il.Flag(Flags::FLAG_ZERO),
+                     il.Flag(Flags::FLAG_NEGATIVE));
+      case LLFC_SGT:
+        return il.Not(0, il.Or(0, il.Flag(Flags::FLAG_ZERO),
+                               il.Flag(Flags::FLAG_NEGATIVE)));
+      default:
+        break;
+    }
+  }
+
+  // CLASS_ARITH flags follow the standard roles, which lets the core fold a
+  // compare and the condition using it into a single comparison
+  return BN::Architecture::GetFlagConditionLowLevelIL(cond, sem_class, il);
+}
+
+BN::ExprId C166Architecture::GetSemanticFlagGroupLowLevelIL(
+    const uint32_t sem_group, BN::LowLevelILFunction &il) {
+  // Not equal and not end of table: E marks a 0x8000 table terminator as the
+  // source operand of CMPI/CMPD
+  if (sem_group == Conditions::CC_NET) {
+    return il.And(0, il.Not(0, il.Flag(Flags::FLAG_ZERO)),
+                  il.Not(0, il.Flag(Flags::FLAG_E)));
+  }
+
+  return GetFlagConditionLowLevelIL(Instruction::GetFlagCondition(sem_group), 0,
+                                    il);
+}
+
+std::vector<uint32_t> C166Architecture::GetAllIntrinsics() {
+  return std::vector<uint32_t>{Intrinsics::DISWDT, Intrinsics::EINIT,
+                               Intrinsics::IDLE,   Intrinsics::PWRDN,
+                               Intrinsics::SRST,   Intrinsics::SRVWDT,
+                               Intrinsics::ATOMIC, Intrinsics::PRIOR};
+}
+
+std::string C166Architecture::GetIntrinsicName(const uint32_t intrinsic) {
+  switch (intrinsic) {
+    case Intrinsics::DISWDT:
+      return "__diswdt";
+    case Intrinsics::EINIT:
+      return "__einit";
+    case Intrinsics::IDLE:
+      return "__idle";
+    case Intrinsics::PWRDN:
+      return "__pwrdn";
+    case Intrinsics::SRST:
+      return "__srst";
+    case Intrinsics::SRVWDT:
+      return "__srvwdt";
+    case Intrinsics::ATOMIC:
+      return "__atomic";
+    case Intrinsics::PRIOR:
+      return "__prior";
+    default:
+      return "";
+  }
+}
+
+std::vector<BN::NameAndType> C166Architecture::GetIntrinsicInputs(
+    const uint32_t intrinsic) {
+  switch (intrinsic) {
+    case Intrinsics::ATOMIC:
+      return {BN::NameAndType("count", BN::Type::IntegerType(1, false))};
+    case Intrinsics::PRIOR:
+      return {BN::NameAndType("value", BN::Type::IntegerType(2, false))};
+    default:
+      return {};
+  }
+}
+
+std::vector<BN::Confidence<BN::Ref<BN::Type>>>
+C166Architecture::GetIntrinsicOutputs(const uint32_t intrinsic) {
+  switch (intrinsic) {
+    case Intrinsics::PRIOR:
+      return {BN::Type::IntegerType(2, false)};
+    default:
+      return {};
+  }
+}
+
 bool C166Architecture::GetInstructionInfo(const uint8_t* data,
                                           const uint64_t addr,
                                           const size_t maxLen,
@@ -552,7 +767,7 @@ bool C166Architecture::GetInstructionInfo(const uint8_t* data,
     case Opcodes::JNBS:
       return Jnbs::Info(data, addr, maxLen, result);
     case Opcodes::PCALL:
-      return false;
+      return Pcall::Info(data, addr, maxLen, result);
     case Opcodes::RET:
     case Opcodes::RETP:
     case Opcodes::RETS:
@@ -567,9 +782,10 @@ bool C166Architecture::GetInstructionInfo(const uint8_t* data,
   }
 }
 
-bool C166Architecture::GetInstructionLowLevelIL(const uint8_t* data,
-                                                uint64_t addr, size_t& len,
-                                                BN::LowLevelILFunction& il) {
+template <Variant V>
+bool C166Architecture::LiftInstruction(const uint8_t* data, const uint64_t addr,
+                                       size_t& len,
+                                       BN::LowLevelILFunction& il) {
   switch (const uint16_t op = (*(const uint16_t*)data) & 0xFFu) {
     /* 2-byte non-branching instructions */
     case Opcodes::ADD_RWN_RWM:
@@ -665,11 +881,11 @@ bool C166Architecture::GetInstructionLowLevelIL(const uint8_t* data,
     case Opcodes::MOV_RWN_REF_RWM:
       return Mov::LiftxA8(data, addr, len, il);
     case Opcodes::MOV_RWN_REF_POST_INC_RWM:
-      return Mov::Liftx98(data, addr, len, il);
+      return Mov::Liftx98<V>(data, addr, len, il);
     case Opcodes::MOV_REF_RWM_RWN:
       return Mov::LiftxB8(data, addr, len, il);
     case Opcodes::MOV_REF_PRE_DEC_RWM_RWN:
-      return Mov::Liftx88(data, addr, len, il);
+      return Mov::Liftx88<V>(data, addr, len, il);
     case Opcodes::MOV_REF_RWN_REF_RWM:
       return Mov::LiftxC8(data, addr, len, il);
     case Opcodes::MOV_REF_POST_INC_RWN_REF_RWM:
@@ -683,11 +899,11 @@ bool C166Architecture::GetInstructionLowLevelIL(const uint8_t* data,
     case Opcodes::MOVB_RBN_REF_RWM:
       return Movb::LiftxA9(data, addr, len, il);
     case Opcodes::MOVB_RBN_REF_POST_INC_RWM:
-      return Movb::Liftx99(data, addr, len, il);
+      return Movb::Liftx99<V>(data, addr, len, il);
     case Opcodes::MOVB_REF_RWM_RBN:
       return Movb::LiftxB9(data, addr, len, il);
     case Opcodes::MOVB_REF_PRE_DEC_RWM_RBN:
-      return Movb::Liftx89(data, addr, len, il);
+      return Movb::Liftx89<V>(data, addr, len, il);
     case Opcodes::MOVB_REF_RWN_REF_RWM:
       return Movb::LiftxC9(data, addr, len, il);
     case Opcodes::MOVB_REF_POST_INC_RWN_REF_RWM:
@@ -946,8 +1162,7 @@ bool C166Architecture::GetInstructionLowLevelIL(const uint8_t* data,
     case Opcodes::JNBS:
       return Jnbs::Lift(this, data, addr, len, il);
     case Opcodes::PCALL:
-      // TODO: BRANCH
-      return false;
+      return Pcall::Lift(data, addr, len, il);
     case Opcodes::RET:
       return Ret::Lift(data, addr, len, il);
     case Opcodes::RETP:
@@ -1342,7 +1557,7 @@ bool C166Architecture::GetInstructionText(
     case Opcodes::JNBS:
       return Jnbs::Text(data, addr, len, result);
     case Opcodes::PCALL:
-      return false;
+      return Pcall::Text(data, addr, len, result);
     case Opcodes::RET:
       return Ret::Text(data, addr, len, result);
     case Opcodes::RETP:
@@ -1358,31 +1573,31 @@ bool C166Architecture::GetInstructionText(
   }
 }
 
-class C166TCArchitecture final : public C166Architecture {
+template <Variant V>
+class C166VariantArchitecture final : public C166Architecture {
  public:
-  explicit C166TCArchitecture(const std::string& name)
+  explicit C166VariantArchitecture(const std::string& name)
       : C166Architecture(name) {}
 
-  uint32_t GetStackPointerRegister() override { return Registers::R0; }
-};
+  uint32_t GetStackPointerRegister() override { return V.stack_pointer; }
 
-class C166TVXArchitecture : public C166Architecture {
- public:
-  explicit C166TVXArchitecture(const std::string& name)
-      : C166Architecture(name) {}
+  uint32_t GetLinkRegister() override {
+    if constexpr (V.link_register) {
+      return Registers::VIRTUAL_LR;
+    } else {
+      return C166Architecture::GetLinkRegister();
+    }
+  }
 
-  uint32_t GetStackPointerRegister() override { return Registers::R15; }
+  bool GetInstructionLowLevelIL(const uint8_t* data, uint64_t addr, size_t& len,
+                                BN::LowLevelILFunction& il) override {
+    return LiftInstruction<V>(data, addr, len, il);
+  }
 };
 
-class C166V2Architecture final : public C166Architecture {
- public:
-  explicit C166V2Architecture(const std::string& name)
-      : C166Architecture(name) {}
-
-  uint32_t GetStackPointerRegister() override { return Registers::R0; }
-
-  uint32_t GetLinkRegister() override { return Registers::VIRTUAL_LR; }
-};
+using C166TCArchitecture = C166VariantArchitecture<Variants::TC>;
+using C166TVXArchitecture = C166VariantArchitecture<Variants::TVX>;
+using C166V2Architecture = C166VariantArchitecture<Variants::V2>;
 
 class TaskingVXCallingConvention final : public BN::CallingConvention {
  public:
@@ -1498,12 +1713,12 @@ void apply_extp_pag10(BinaryNinja::BinaryView* view, uint64_t start,
   BN::GetIntegerInput(pag10, std::string("Enter EXTP #pag10 value"),
                       std::string("EXTP: pag10"));
 
-  // Try to apply to all 2-byte addresses in the specified (highlighted range)
-  for (uint64_t a = start; a < (start + length);) {
-    BN::LogInfo("Apply EXTP to address: 0x%lx", a);
-    Instruction::SetExtpPag10(a, pag10, 0);
-    a += 2;
-  }
+  if (length == 0) return;
+
+  // Apply to all 2-byte addresses in the specified (highlighted range)
+  Instruction::SetExtpPag10Range(start, start + length - 1, pag10, 0);
+  BN::LogInfo("Applied EXTP #0x%lx to 0x%lx-0x%lx", pag10, start,
+              start + length);
 
   view->Reanalyze();
 }
@@ -1515,24 +1730,23 @@ void apply_exts_seg8(BinaryNinja::BinaryView* view, uint64_t start,
   BN::GetIntegerInput(seg8, std::string("Enter EXTS #seg8 value"),
                       std::string("EXTS: seg8"));
 
-  // Try to apply to all 2-byte addresses in the specified (highlighted range)
-  for (uint64_t a = start; a < (start + length);) {
-    BN::LogInfo("Apply EXTS to address: 0x%lx", a);
-    Instruction::SetExtsSeg8(a, seg8, 0);
-    a += 2;
-  }
+  if (length == 0) return;
+
+  // Apply to all 2-byte addresses in the specified (highlighted range)
+  Instruction::SetExtsSeg8Range(start, start + length - 1, seg8, 0);
+  BN::LogInfo("Applied EXTS #0x%lx to 0x%lx-0x%lx", seg8, start,
+              start + length);
 
   view->Reanalyze();
 }
 
 void apply_extr(BinaryNinja::BinaryView* view, uint64_t start,
                 uint64_t length) {
-  // Try to apply to all 2-byte addresses in the specified (highlighted range)
-  for (uint64_t a = start; a < (start + length);) {
-    BN::LogInfo("Apply EXTR to address: 0x%lx", a);
-    Instruction::SetExtr(a, 0);
-    a += 2;
-  }
+  if (length == 0) return;
+
+  // Apply to all 2-byte addresses in the specified (highlighted range)
+  Instruction::SetExtrRange(start, start + length - 1, 0);
+  BN::LogInfo("Applied EXTR to 0x%lx-0x%lx", start, start + length);
 
   view->Reanalyze();
 }
@@ -1549,13 +1763,15 @@ void apply_dpp(BinaryNinja::BinaryView* view, uint64_t start, uint64_t length) {
   BN::GetIntegerInput(dpp3, std::string("Enter DPP3 value"),
                       std::string("DPP3:"));
 
-  // Try to apply to all 2-byte addresses in the specified (highlighted range)
-  uint64_t a;
-  for (a = start; a < (start + length);) {
-    BN::LogInfo("Apply DPP values to address: 0x%lx", a);
-    Instruction::SetDpps(a, dpp0, dpp1, dpp2, dpp3);
-    a += 2;
-  }
+  if (length == 0) return;
+
+  // Apply to all 2-byte addresses in the specified (highlighted range),
+  // replacing any EXT state the user applied there
+  Instruction::SetDppsRange(start, start + length - 1, dpp0, dpp1, dpp2, dpp3,
+                            false);
+  BN::LogInfo(
+      "Applied DPP0-3 (0x%lx, 0x%lx, 0x%lx, 0x%lx) to 0x%lx-0x%lx", dpp0,
+      dpp1, dpp2, dpp3, start, start + length);
 
   view->Reanalyze();
 }
@@ -1597,6 +1813,180 @@ void load_state_map(BinaryNinja::BinaryView* view) {
 
   view->Reanalyze();
 }
+
+// Applies a CSV/JSON table of DPP/EXT ranges in one update, then reanalyzes
+// only the functions that overlap one of the ranges.
+void import_state_ranges(BinaryNinja::BinaryView* view) {
+  std::string filename;
+  if (!BN::GetOpenFileNameInput(filename, "Select DPP/EXT range table",
+                                "*.csv;*.json"))
+    return;
+
+  std::vector<StateRange> ranges;
+  if (!StateImport::Load(filename, ranges) || ranges.empty()) return;
+
+  Instruction::ApplyStateRanges(ranges);
+  BN::LogInfo("Applied %zu DPP/EXT range(s) from %s", ranges.size(),
+              filename.c_str());
+
+  // Merge into sorted, disjoint [start, end) spans
+  std::vector<std::pair<uint64_t, uint64_t>> spans;
+  spans.reserve(ranges.size());
+  for (const auto& range : ranges)
+    spans.emplace_back(range.start, range.end + 1);
+  std::sort(spans.begin(), spans.end());
+
+  size_t merged = 0;
+  for (size_t i = 1; i < spans.size(); i++) {
+    if (spans[i].first <= spans[merged].second) {
+      spans[merged].second = std::max(spans[merged].second, spans[i].second);
+    } else {
+      spans[++merged] = spans[i];
+    }
+  }
+  spans.resize(merged + 1);
+
+  size_t reanalyzed = 0;
+  for (const auto& func : view->GetAnalysisFunctionList()) {
+    for (const auto& block : func->GetAddressRanges()) {
+      // First span ending after the block starts
+      const auto it = std::upper_bound(
+          spans.begin(), spans.end(), block.start,
+          [](uint64_t addr, const auto& span) { return addr < span.second; });
+      if (it != spans.end() && it->first < block.end) {
+        func->Reanalyze();
+        reanalyzed++;
+        break;
+      }
+    }
+  }
+  BN::LogInfo("Reanalyzing %zu affected function(s)", reanalyzed);
+}
+
+void import_linker_map(BinaryNinja::BinaryView* view) {
+  std::string filename;
+  if (!BN::GetOpenFileNameInput(filename, "Select Tasking linker map file",
+                                "*.map"))
+    return;
+
+  LinkerMap map;
+  if (!MapImport::Load(filename, map)) return;
+
+  MapImport::Apply(view, map);
+  view->Reanalyze();
+}
+
+// Imports <image>.map from beside a newly opened C166 image, so its DPP ranges
+// are in place before initial analysis runs
+void load_adjacent_linker_map(BinaryNinja::BinaryView* view) {
+  const BN::Ref<BN::Architecture> arch = view->GetDefaultArchitecture();
+  if (!arch || arch->GetName().rfind("c166", 0) != 0) return;
+
+  const BN::Ref<BN::FileMetadata> file = view->GetFile();
+  if (file->IsBackedByDatabase()) return;
+
+  std::string filename = file->GetOriginalFilename();
+  const size_t dot = filename.find_last_of('.');
+  const size_t slash = filename.find_last_of("/\\");
+  if (dot != std::string::npos && (slash == std::string::npos || dot > slash))
+    filename.resize(dot);
+  filename += ".map";
+  if (!std::ifstream(filename).is_open()) return;
+
+  LinkerMap map;
+  if (!MapImport::Load(filename, map)) return;
+
+  BN::LogInfo("Importing linker map %s", filename.c_str());
+  MapImport::Apply(view, map);
+}
+
+bool is_c166_elf(BinaryNinja::BinaryView* view) {
+  if (view->GetTypeName() != "ELF") return false;
+
+  const BN::Ref<BN::Architecture> arch = view->GetDefaultArchitecture();
+  return arch && (arch->GetName() == "c166tvx" || arch->GetName() == "c166v2");
+}
+
+// Applies the DPPs from a Tasking VX ELF image's __dpp section. This is opt-in,
+// as the section layout is assumed rather than documented.
+void apply_elf_dpps(BinaryNinja::BinaryView* view) {
+  if (!ElfImport::Apply(view)) {
+    BN::LogWarn("No usable __dpp section found");
+    return;
+  }
+
+  view->Reanalyze();
+}
+
+void infer_memory_map(BinaryNinja::BinaryView* view) {
+  BusConfig config;
+  if (!BusInference::Collect(view, config)) {
+    BN::LogInfo("No bus configuration writes found near reset");
+    return;
+  }
+
+  BN::LogInfo("Mapped %zu external memory window(s)",
+              BusInference::Apply(view, config));
+}
+
+// Derives the memory map of newly opened C166 images once the boot code has
+// been analyzed
+void infer_memory_map_after_analysis(BinaryNinja::BinaryView* view) {
+  const BN::Ref<BN::Architecture> arch = view->GetDefaultArchitecture();
+  if (!arch || arch->GetName().rfind("c166", 0) != 0 ||
+      view->GetFile()->IsBackedByDatabase())
+    return;
+
+  BusConfig config;
+  if (BusInference::Collect(view, config)) BusInference::Apply(view, config);
+}
+
+void save_state_file(BinaryNinja::BinaryView* view) {
+  std::string filename;
+  if (!BN::GetSaveFileNameInput(filename, "Save C166 state file",
+                                "*.c166state"))
+    return;
+
+  Instruction::writeStateMapToFile(filename);
+}
+
+void load_state_file(BinaryNinja::BinaryView* view) {
+  std::string filename;
+  if (!BN::GetOpenFileNameInput(filename, "Select C166 state file",
+                                "*.c166state"))
+    return;
+
+  Instruction::loadStateMapFromFile(filename);
+  view->Reanalyze();
+}
+
+void apply_runtime_signatures(BinaryNinja::BinaryView* view) {
+  std::string filename;
+  if (!BN::GetOpenFileNameInput(filename, "Select runtime signature database"))
+    return;
+
+  std::vector<RuntimeSignature> db;
+  if (!Signature::LoadDatabase(filename, db)) return;
+
+  const size_t matched = Signature::Apply(view, db);
+  BN::LogInfo("Matched %zu function(s) against %zu runtime signature(s)",
+              matched, db.size());
+}
+
+void generate_runtime_signature(BinaryNinja::BinaryView* view,
+                                BinaryNinja::Function* func) {
+  RuntimeSignature sig;
+  if (!Signature::Compute(view, func, sig)) {
+    BN::LogError("Unable to compute signature for function at 0x%lx",
+                 func->GetStart());
+    return;
+  }
+
+  char name[32];
+  snprintf(name, sizeof(name), "sub_%lx", func->GetStart());
+  sig.name = name;
+  BN::LogInfo("%s", Signature::ToString(sig).c_str());
+}
 }  // namespace C166
 
 extern "C" {
@@ -1627,6 +2017,14 @@ BINARYNINJAPLUGIN bool CorePluginInit() {
   C166V2->RegisterCallingConvention(cc);
   C166V2->SetDefaultCallingConvention(cc);
 
+  // Tasking VX ELF images are loaded by Binary Ninja's ELF view, which also
+  // imports their DWARF information
+  BN::BinaryViewType::RegisterArchitecture("ELF", C166::ElfImport::machine_c166,
+                                           LittleEndian, C166TVX);
+
+  // Intel HEX / S-record images, mapped at their record addresses
+  BN::BinaryViewType::Register(new C166::C166FirmwareViewType());
+
   // Register plugin commands to support manual identification of EXT/DPP values
   // for instruction lifting
   BN::PluginCommand::RegisterForRange(
@@ -1648,9 +2046,9 @@ BINARYNINJAPLUGIN bool CorePluginInit() {
       "Highlight a range of instructions to apply specific DPP values to.",
       &C166::apply_dpp, &C166::func_is_valid);
 
-  // Assign Default DPP values
-  uint32_t dpp[] = {0x0, 0x0, 0x0, 0x0};
-  C166::Instruction::SetDefaultDpps(dpp[0], dpp[1], dpp[2], dpp[3]);
+  // Default DPPs are left unset: direct addresses use the reset values, and
+  // [Rw] accesses keep a dynamic DPP lookup until defaults are configured or a
+  // DPP range is applied.
 
   BN::PluginCommand::Register(
       "C166 Architecture\\Save C166 StateMap",
@@ -1662,6 +2060,59 @@ BINARYNINJAPLUGIN bool CorePluginInit() {
       "Load manual modifications to instruction addressing modes.",
       &C166::load_state_map);
 
+  BN::PluginCommand::Register(
+      "C166 Architecture\\Import DPP/EXT Ranges",
+      "Applies a CSV or JSON table of DPP and EXT ranges exported by other "
+      "tools.",
+      &C166::import_state_ranges);
+
+  BN::PluginCommand::Register(
+      "C166 Architecture\\Import Linker Map",
+      "Applies the sections, symbols and DPP assignments from a Tasking "
+      "linker map file.",
+      &C166::import_linker_map);
+
+  BN::BinaryViewType::RegisterBinaryViewFinalizationEvent(
+      &C166::load_adjacent_linker_map);
+
+  BN::PluginCommand::Register(
+      "C166 Architecture\\Apply ELF DPP Section",
+      "Applies the DPP0-3 values recorded in the __dpp section of a Tasking VX "
+      "ELF image as the default DPPs of its code sections.",
+      &C166::apply_elf_dpps, &C166::is_c166_elf);
+
+  BN::PluginCommand::Register(
+      "C166 Architecture\\Infer Memory Map",
+      "Maps the external memory windows configured by ADDRSELx/BUSCONx and "
+      "SYSCON writes in the boot code.",
+      &C166::infer_memory_map);
+
+  BN::BinaryViewType::RegisterBinaryViewInitialAnalysisCompletionEvent(
+      &C166::infer_memory_map_after_analysis);
+
+  BN::PluginCommand::Register(
+      "C166 Architecture\\Save C166 State File",
+      "Writes instruction addressing modes to a sidecar file that can be "
+      "shared between databases.",
+      &C166::save_state_file);
+
+  BN::PluginCommand::Register(
+      "C166 Architecture\\Load C166 State File",
+      "Maps instruction addressing modes from a sidecar state file.",
+      &C166::load_state_file);
+
+  BN::PluginCommand::Register(
+      "C166 Architecture\\Apply Runtime Signatures",
+      "Identify and name known runtime library routines (long "
+      "multiply/divide, memcpy, switch helpers, ...) from a signature "
+      "database.",
+      &C166::apply_runtime_signatures);
+
+  BN::PluginCommand::RegisterForFunction(
+      "C166 Architecture\\Generate Runtime Signature",
+      "Log a signature database entry for the current function.",
+      &C166::generate_runtime_signature);
+
   return true;
 }
 }
@@ -6,6 +6,8 @@
 
 #include <binaryninjaapi.h>
 
+#include "variants.h"
+
 namespace BN = BinaryNinja;
 
 namespace C166 {
@@ -32,18 +34,46 @@ class C166Architecture : public BN::Architecture {
   BNFlagRole GetFlagRole(uint32_t flag, uint32_t semClass) override;
   std::vector<uint32_t> GetFlagsWrittenByFlagWriteType(uint32_t flags) override;
   std::string GetFlagWriteTypeName(uint32_t flags) override;
+  BN::ExprId GetFlagWriteLowLevelIL(BNLowLevelILOperation op, size_t size,
+                                    uint32_t flagWriteType, uint32_t flag,
+                                    BNRegisterOrConstant* operands,
+                                    size_t operandCount,
+                                    BN::LowLevelILFunction& il) override;
   std::vector<uint32_t> GetFlagsRequiredForFlagCondition(
       BNLowLevelILFlagCondition cond, uint32_t semClass) override;
+  std::vector<uint32_t> GetAllSemanticFlagClasses() override;
+  std::string GetSemanticFlagClassName(uint32_t semClass) override;
+  uint32_t GetSemanticClassForFlagWriteType(uint32_t writeType) override;
+  std::vector<uint32_t> GetAllSemanticFlagGroups() override;
+  std::string GetSemanticFlagGroupName(uint32_t semGroup) override;
+  std::vector<uint32_t> GetFlagsRequiredForSemanticFlagGroup(
+      uint32_t semGroup) override;
+  std::map<uint32_t, BNLowLevelILFlagCondition>
+  GetFlagConditionsForSemanticFlagGroup(uint32_t semGroup) override;
+  BN::ExprId GetFlagConditionLowLevelIL(BNLowLevelILFlagCondition cond,
+                                        uint32_t semClass,
+                                        BN::LowLevelILFunction& il) override;
+  BN::ExprId GetSemanticFlagGroupLowLevelIL(
+      uint32_t semGroup, BN::LowLevelILFunction& il) override;
+  std::vector<uint32_t> GetAllIntrinsics() override;
+  std::string GetIntrinsicName(uint32_t intrinsic) override;
+  std::vector<BN::NameAndType> GetIntrinsicInputs(uint32_t intrinsic) override;
+  std::vector<BN::Confidence<BN::Ref<BN::Type>>> GetIntrinsicOutputs(
+      uint32_t intrinsic) override;
 
   bool GetInstructionInfo(const uint8_t* data, uint64_t addr, size_t maxLen,
                           BN::InstructionInfo& result) override;
   bool GetInstructionText(
       const uint8_t* data, uint64_t addr, size_t& len,
       std::vector<BN::InstructionTextToken>& result) override;
-  bool GetInstructionLowLevelIL(const uint8_t* data, uint64_t addr, size_t& len,
-                                BN::LowLevelILFunction& il) override;
 
   uint32_t GetStackPointerRegister() override = 0;
+
+ protected:
+  // Shared LLIL dispatch, instantiated by each variant architecture
+  template <Variant V>
+  bool LiftInstruction(const uint8_t* data, uint64_t addr, size_t& len,
+                       BN::LowLevelILFunction& il);
 };
 }  // namespace C166
 
@@ -0,0 +1,172 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "busconfig.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "sfr.h"
+
+namespace BN = BinaryNinja;
+
+namespace C166 {
+
+// C167CR on-chip XRAM, decoded when SYSCON.XPEN is set
+static constexpr uint64_t xram_start = 0xE000;
+static constexpr uint64_t xram_size = 0x800;
+
+MemoryWindow::MemoryWindow() : start(0), size(0) {}
+
+BusConfig::BusConfig() : syscon(0), addrsel(), buscon(), written(0) {}
+
+bool BusConfig::Record(const uint32_t sfr, const uint16_t value) {
+  static constexpr uint16_t addrsels[5] = {0, Sfr::ADDRSEL1, Sfr::ADDRSEL2,
+                                           Sfr::ADDRSEL3, Sfr::ADDRSEL4};
+  static constexpr uint16_t buscons[5] = {Sfr::BUSCON0, Sfr::BUSCON1,
+                                          Sfr::BUSCON2, Sfr::BUSCON3,
+                                          Sfr::BUSCON4};
+
+  if (sfr == Sfr::SYSCON) {
+    syscon = value;
+    written |= 1;
+    return true;
+  }
+
+  for (int i = 0; i < 5; i++) {
+    if (i > 0 && sfr == addrsels[i]) {
+      addrsel[i] = value;
+      written |= 1u << (1 + i);
+      return true;
+    }
+    if (sfr == buscons[i]) {
+      buscon[i] = value;
+      written |= 1u << (6 + i);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void BusConfig::GetWindows(std::vector<MemoryWindow> &windows) const {
+  for (int i = 1; i < 5; i++) {
+    const bool configured =
+        (written & (1u << (1 + i))) && (written & (1u << (6 + i)));
+    if (!configured || !(buscon[i] & busact)) continue;
+
+    // RGSZ selects 4 KB << n (n <= 11, up to 8 MB); RGSAD holds A23..A12 of
+    // the start, of which the bits below the window size are ignored
+    const unsigned rgsz = addrsel[i] & 0xF;
+    if (rgsz > 11) continue;
+
+    MemoryWindow window;
+    window.size = uint64_t{0x1000} << rgsz;
+    window.start =
+        ((uint64_t{addrsel[i]} & 0xFFF0) << 8) & ~(window.size - 1);
+    window.name = "ADDRSEL" + std::to_string(i);
+    windows.push_back(window);
+  }
+
+  if ((written & 1) && (syscon & xpen)) {
+    MemoryWindow window;
+    window.name = "XRAM";
+    window.start = xram_start;
+    window.size = xram_size;
+    windows.push_back(window);
+  }
+}
+
+static bool GetConstant(const BN::LowLevelILInstruction &expr,
+                        uint64_t &value) {
+  const BN::RegisterValue result = expr.GetValue();
+  if (result.state != ConstantValue && result.state != ConstantPointerValue)
+    return false;
+
+  value = static_cast<uint64_t>(result.value);
+  return true;
+}
+
+// Writes are taken in instruction order, so a later write to a register
+// replaces an earlier one
+bool BusInference::Collect(BN::BinaryView *view, BusConfig &config) {
+  const BN::Ref<BN::Platform> platform = view->GetDefaultPlatform();
+  const BN::Ref<BN::Function> entry =
+      view->GetAnalysisFunction(platform, view->GetEntryPoint());
+  if (!entry) return false;
+
+  std::vector<std::pair<BN::Ref<BN::Function>, size_t>> worklist = {
+      {entry, 0}};
+  std::unordered_set<uint64_t> visited = {entry->GetStart()};
+  size_t recorded = 0;
+
+  for (size_t next = 0; next < worklist.size(); next++) {
+    const auto [func, depth] = worklist[next];
+    const BN::Ref<BN::LowLevelILFunction> il = func->GetLowLevelIL();
+    if (!il) continue;
+
+    for (size_t i = 0; i < il->GetInstructionCount(); i++) {
+      const BN::LowLevelILInstruction insn = il->GetInstruction(i);
+      uint64_t addr, value;
+
+      switch (insn.operation) {
+        case LLIL_STORE:
+          if (GetConstant(insn.GetDestExpr<LLIL_STORE>(), addr) &&
+              GetConstant(insn.GetSourceExpr<LLIL_STORE>(), value) &&
+              config.Record(static_cast<uint32_t>(addr),
+                            static_cast<uint16_t>(value)))
+            recorded++;
+          break;
+        case LLIL_CALL:
+        case LLIL_TAILCALL: {
+          const BN::LowLevelILInstruction dest =
+              (insn.operation == LLIL_CALL)
+                  ? insn.GetDestExpr<LLIL_CALL>()
+                  : insn.GetDestExpr<LLIL_TAILCALL>();
+          if (depth >= max_depth || worklist.size() >= max_functions ||
+              !GetConstant(dest, addr) || !visited.insert(addr).second)
+            break;
+
+          if (const BN::Ref<BN::Function> callee =
+                  view->GetAnalysisFunction(platform, addr))
+            worklist.emplace_back(callee, depth + 1);
+          break;
+        }
+        default:
+          break;
+      }
+    }
+  }
+
+  return recorded > 0;
+}
+
+size_t BusInference::Apply(BN::BinaryView *view, const BusConfig &config) {
+  std::vector<MemoryWindow> windows;
+  config.GetWindows(windows);
+
+  size_t applied = 0;
+  for (const auto &window : windows) {
+    if (view->GetSectionByName(window.name)) continue;
+
+    // Windows the image covers hold external flash; anything else is RAM
+    BNSectionSemantics semantics = DefaultSectionSemantics;
+    if (!view->IsOffsetBackedByFile(window.start)) {
+      view->AddUserSegment(window.start, window.size, 0, 0,
+                           SegmentReadable | SegmentWritable |
+                               SegmentContainsData | SegmentDenyExecute);
+      semantics = ReadWriteDataSectionSemantics;
+    }
+    view->AddUserSection(window.name, window.start, window.size, semantics);
+
+    BN::LogInfo("%s: 0x%06lx-0x%06lx", window.name.c_str(), window.start,
+                window.start + window.size);
+    applied++;
+  }
+
+  return applied;
+}
+}  // namespace C166
@@ -0,0 +1,61 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_BUSCONFIG_H_
+#define SRC_BUSCONFIG_H_
+
+#include <binaryninjaapi.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace BN = BinaryNinja;
+
+namespace C166 {
+
+class MemoryWindow {
+ public:
+  std::string name;
+  uint64_t start;
+  uint64_t size;
+
+  MemoryWindow();
+};
+
+// Values boot code writes to the external bus controller (ADDRSEL1-4,
+// BUSCON0-4) and SYSCON, decoded with the C167CR register layout
+class BusConfig {
+  static constexpr uint16_t busact = 0x0400;  // BUSCONx: window enabled
+  static constexpr uint16_t xpen = 0x0004;    // SYSCON: XBUS/XRAM enabled
+
+ public:
+  uint16_t syscon;
+  uint16_t addrsel[5];  // ADDRSEL0 does not exist; BUSCON0 is the default
+  uint16_t buscon[5];
+  uint32_t written;  // Bit per register, in the order above
+
+  BusConfig();
+
+  // Records a write to one of the registers above; returns false for any
+  // other address
+  bool Record(uint32_t sfr, uint16_t value);
+  // Address windows enabled by the recorded values
+  void GetWindows(std::vector<MemoryWindow> &windows) const;
+};
+
+class BusInference {
+  static constexpr size_t max_depth = 2;
+  static constexpr size_t max_functions = 32;
+
+ public:
+  // Scans the lifted stores of the reset entry point and the functions it
+  // calls (up to max_depth levels) for constant writes to the bus registers
+  static bool Collect(BN::BinaryView *view, BusConfig &config);
+  // Maps each window as a section, adding a zero-filled read/write segment
+  // where the image does not cover it. Returns the number of windows applied.
+  static size_t Apply(BN::BinaryView *view, const BusConfig &config);
+};
+}  // namespace C166
+
+#endif  // SRC_BUSCONFIG_H_
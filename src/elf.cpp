@@ -0,0 +1,141 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "elf.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "util.h"
+
+namespace BN = BinaryNinja;
+
+namespace C166 {
+
+static constexpr size_t elf_header_size = 52;
+static constexpr size_t section_header_size = 40;
+static constexpr uint32_t sht_nobits = 8;
+static constexpr uint32_t shf_alloc = 0x2;
+static constexpr uint32_t shf_execinstr = 0x4;
+
+ElfSection::ElfSection() : type(0), flags(0), addr(0), offset(0), size(0) {}
+
+static uint16_t Read16(const uint8_t *data) { return data[0] | data[1] << 8; }
+
+static uint32_t Read32(const uint8_t *data) {
+  return Read16(data) | static_cast<uint32_t>(Read16(data + 2)) << 16;
+}
+
+bool ElfImport::ReadSections(BN::BinaryView *raw,
+                             std::vector<ElfSection> &sections) {
+  uint8_t header[elf_header_size];
+  if (raw->Read(header, 0, sizeof(header)) != sizeof(header)) return false;
+
+  // 32-bit little-endian EM_C166
+  if (std::memcmp(header, "\x7f" "ELF", 4) != 0 || header[4] != 1 ||
+      header[5] != 1 || Read16(header + 18) != machine_c166)
+    return false;
+
+  const uint32_t shoff = Read32(header + 32);
+  const uint16_t shentsize = Read16(header + 46);
+  const uint16_t shnum = Read16(header + 48);
+  const uint16_t shstrndx = Read16(header + 50);
+  if (shentsize < section_header_size || shstrndx >= shnum) return false;
+
+  // All section headers in one read
+  const BN::DataBuffer table =
+      raw->ReadBuffer(shoff, static_cast<size_t>(shnum) * shentsize);
+  if (table.GetLength() != static_cast<size_t>(shnum) * shentsize)
+    return false;
+  const auto *entries = static_cast<const uint8_t *>(table.GetData());
+
+  const uint8_t *strtab_entry = entries + shstrndx * shentsize;
+  const BN::DataBuffer strtab =
+      raw->ReadBuffer(Read32(strtab_entry + 16), Read32(strtab_entry + 20));
+  const auto *names = static_cast<const char *>(strtab.GetData());
+
+  sections.reserve(shnum);
+  for (uint16_t i = 0; i < shnum; i++) {
+    const uint8_t *entry = entries + i * shentsize;
+
+    ElfSection section;
+    const uint32_t name = Read32(entry);
+    if (name < strtab.GetLength()) {
+      section.name.assign(
+          names + name, strnlen(names + name, strtab.GetLength() - name));
+    }
+    section.type = Read32(entry + 4);
+    section.flags = Read32(entry + 8);
+    section.addr = Read32(entry + 12);
+    section.offset = Read32(entry + 16);
+    section.size = Read32(entry + 20);
+    sections.push_back(section);
+  }
+
+  return true;
+}
+
+bool ElfImport::ReadDpps(BN::BinaryView *raw,
+                         const std::vector<ElfSection> &sections,
+                         uint16_t *dpp) {
+  for (const auto &section : sections) {
+    if (section.name != "__dpp") continue;
+
+    uint8_t data[8];
+    if (section.type == sht_nobits || section.size < sizeof(data) ||
+        raw->Read(data, section.offset, sizeof(data)) != sizeof(data)) {
+      BN::LogWarn("%s: Malformed __dpp section", __func__);
+      return false;
+    }
+
+    for (int i = 0; i < 4; i++) {
+      dpp[i] = Read16(data + 2 * i);
+      if (dpp[i] > 0x3FF) {
+        BN::LogWarn("%s: Invalid DPP%d page 0x%x", __func__, i, dpp[i]);
+        return false;
+      }
+    }
+    return true;
+  }
+
+  return false;
+}
+
+void ElfImport::DeriveRanges(const std::vector<ElfSection> &sections,
+                             const uint16_t *dpp,
+                             std::vector<StateRange> &ranges) {
+  for (const auto &section : sections) {
+    if ((section.flags & (shf_alloc | shf_execinstr)) !=
+            (shf_alloc | shf_execinstr) ||
+        section.type == sht_nobits || section.size == 0 ||
+        uint64_t{section.addr} + section.size > StateTable::address_limit)
+      continue;
+
+    ranges.push_back({StateRange::Dpp,
+                      section.addr,
+                      uint64_t{section.addr} + section.size - 1,
+                      {dpp[0], dpp[1], dpp[2], dpp[3]}});
+  }
+}
+
+bool ElfImport::Apply(BN::BinaryView *view) {
+  const BN::Ref<BN::BinaryView> raw = view->GetParentView();
+  if (!raw) return false;
+
+  std::vector<ElfSection> sections;
+  uint16_t dpp[4];
+  if (!ReadSections(raw, sections) || !ReadDpps(raw, sections, dpp))
+    return false;
+
+  std::vector<StateRange> ranges;
+  DeriveRanges(sections, dpp, ranges);
+  Instruction::SetDefaultDpps(dpp[0], dpp[1], dpp[2], dpp[3]);
+  Instruction::ApplyStateRanges(ranges);
+
+  BN::LogInfo("Seeded DPP0-3 (0x%x, 0x%x, 0x%x, 0x%x) over %zu code section(s)",
+              dpp[0], dpp[1], dpp[2], dpp[3], ranges.size());
+  return true;
+}
+}  // namespace C166
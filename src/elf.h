@@ -0,0 +1,57 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_ELF_H_
+#define SRC_ELF_H_
+
+#include <binaryninjaapi.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "state.h"
+
+namespace BN = BinaryNinja;
+
+namespace C166 {
+
+class ElfSection {
+ public:
+  std::string name;
+  uint32_t type;
+  uint32_t flags;
+  uint32_t addr;
+  uint32_t offset;
+  uint32_t size;
+
+  ElfSection();
+};
+
+// Seeds the instruction state store from Tasking VX ELF images on request.
+// Binary Ninja's own ELF view (with the C166 architectures registered for
+// EM_C166) already applies the symbols and DWARF function boundaries and
+// types; what it cannot know is the DPP setup. The Tasking linker is assumed
+// to record it in a "__dpp" section holding DPP0-3 as little-endian 16-bit
+// page numbers; that layout is not documented, so this is only applied
+// through an explicit command.
+class ElfImport {
+  static bool ReadSections(BN::BinaryView *raw,
+                           std::vector<ElfSection> &sections);
+  static bool ReadDpps(BN::BinaryView *raw,
+                       const std::vector<ElfSection> &sections,
+                       uint16_t *dpp);
+
+ public:
+  static constexpr uint32_t machine_c166 = 116;  // EM_C166
+
+  // Ranges assigning dpp to every executable section
+  static void DeriveRanges(const std::vector<ElfSection> &sections,
+                           const uint16_t *dpp,
+                           std::vector<StateRange> &ranges);
+  // Returns false if view is not a C166 ELF image with a __dpp section
+  static bool Apply(BN::BinaryView *view);
+};
+}  // namespace C166
+
+#endif  // SRC_ELF_H_
@@ -0,0 +1,417 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "firmware.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace BN = BinaryNinja;
+
+namespace C166 {
+
+// Longest record payload either format can encode: count, address, 255 data
+// bytes and checksum
+static constexpr size_t max_record_size = 1 + 4 + 255 + 1;
+
+static int HexDigit(const uint8_t c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  return -1;
+}
+
+// Decodes the hex digits in [text, text + len) into out. Returns the number of
+// bytes decoded, or 0 if the text is not a whole number of hex bytes.
+static size_t DecodeRecord(const uint8_t *text, const size_t len,
+                           uint8_t *out) {
+  if (len == 0 || len % 2 || len / 2 > max_record_size) return 0;
+
+  for (size_t i = 0; i < len; i += 2) {
+    const int high = HexDigit(text[i]), low = HexDigit(text[i + 1]);
+    if (high < 0 || low < 0) return 0;
+    out[i / 2] = static_cast<uint8_t>((high << 4) | low);
+  }
+
+  return len / 2;
+}
+
+static uint64_t ReadBigEndian(const uint8_t *data, const size_t len) {
+  uint64_t value = 0;
+  for (size_t i = 0; i < len; i++) value = (value << 8) | data[i];
+  return value;
+}
+
+FirmwareImage::FirmwareImage() : entry(0), has_entry(false) {}
+
+FirmwareImage::Format FirmwareImage::Detect(const uint8_t *data,
+                                            const size_t len) {
+  size_t i = 0;
+  while (i < len && (data[i] == ' ' || data[i] == '\t' || data[i] == '\r' ||
+                     data[i] == '\n'))
+    i++;
+  if (i + 2 >= len) return Unknown;
+
+  if (data[i] == ':' && HexDigit(data[i + 1]) >= 0 &&
+      HexDigit(data[i + 2]) >= 0)
+    return IntelHex;
+  if (data[i] == 'S' && data[i + 1] >= '0' && data[i + 1] <= '9' &&
+      HexDigit(data[i + 2]) >= 0)
+    return SRecord;
+  return Unknown;
+}
+
+void FirmwareImage::Append(const uint64_t addr, const uint8_t *data,
+                           const size_t len) {
+  if (len == 0) return;
+
+  if (!segments.empty()) {
+    ImageSegment &last = segments.back();
+    if (last.addr + last.length == addr &&
+        last.offset + last.length == bytes.size()) {
+      last.length += len;
+      bytes.insert(bytes.end(), data, data + len);
+      return;
+    }
+  }
+
+  segments.push_back({addr, bytes.size(), len});
+  bytes.insert(bytes.end(), data, data + len);
+}
+
+// Files whose records are out of order or overlap are rebuilt into sorted,
+// disjoint segments in one copy. Where records overlap, the later one wins.
+void FirmwareImage::Normalize() {
+  bool ordered = true;
+  for (size_t i = 1; i < segments.size() && ordered; i++) {
+    ordered = segments[i - 1].addr + segments[i - 1].length <= segments[i].addr;
+  }
+  if (ordered) return;
+
+  std::vector<ImageSegment> merged = segments;
+  std::sort(merged.begin(), merged.end(),
+            [](const ImageSegment &a, const ImageSegment &b) {
+              return a.addr < b.addr;
+            });
+
+  size_t last = 0;
+  for (size_t i = 1; i < merged.size(); i++) {
+    const uint64_t end = merged[last].addr + merged[last].length;
+    if (merged[i].addr <= end) {
+      const uint64_t new_end =
+          std::max(end, merged[i].addr + merged[i].length);
+      merged[last].length = new_end - merged[last].addr;
+    } else {
+      merged[++last] = merged[i];
+    }
+  }
+  merged.resize(last + 1);
+
+  size_t size = 0;
+  for (auto &segment : merged) {
+    segment.offset = size;
+    size += segment.length;
+  }
+
+  std::vector<uint8_t> rebuilt(size);
+  for (const auto &segment : segments) {
+    // Merged segment containing this one
+    const auto target =
+        std::prev(std::upper_bound(merged.begin(), merged.end(), segment.addr,
+                                   [](uint64_t addr, const ImageSegment &m) {
+                                     return addr < m.addr;
+                                   }));
+    std::memcpy(&rebuilt[target->offset + (segment.addr - target->addr)],
+                &bytes[segment.offset], segment.length);
+  }
+
+  bytes = std::move(rebuilt);
+  segments = std::move(merged);
+}
+
+bool FirmwareImage::Parse(const uint8_t *data, const size_t len) {
+  const Format format = Detect(data, len);
+  if (format == Unknown) return false;
+
+  bytes.clear();
+  segments.clear();
+  has_entry = false;
+
+  // Two text characters encode each byte, so this bounds the image size
+  bytes.reserve(len / 2);
+
+  uint8_t record[max_record_size];
+  uint64_t base = 0;  // Intel HEX extended segment/linear address
+  size_t lineno = 0;
+  for (size_t pos = 0; pos < len;) {
+    const uint8_t *line = data + pos;
+    const auto *newline =
+        static_cast<const uint8_t *>(std::memchr(line, '\n', len - pos));
+    size_t line_len = newline ? newline - line : len - pos;
+    pos += line_len + 1;
+    lineno++;
+
+    while (line_len && (line[line_len - 1] == '\r' ||
+                        line[line_len - 1] == ' ' ||
+                        line[line_len - 1] == '\t'))
+      line_len--;
+    if (line_len == 0) continue;
+
+    if (format == IntelHex) {
+      // :LLAAAATT<data>CC
+      const size_t size =
+          (line[0] == ':') ? DecodeRecord(line + 1, line_len - 1, record) : 0;
+      uint8_t sum = 0;
+      for (size_t i = 0; i < size; i++) sum += record[i];
+      if (size < 5 || size != record[0] + 5u || sum != 0) {
+        BN::LogWarn("%s: line %zu: Malformed Intel HEX record", __func__,
+                    lineno);
+        continue;
+      }
+
+      const uint8_t count = record[0];
+      const uint8_t *payload = record + 4;
+      switch (record[3]) {
+        case 0x00: {
+          const uint64_t addr = base + ReadBigEndian(record + 1, 2);
+          if (addr + count > address_limit) {
+            BN::LogWarn("%s: line %zu: Data beyond 24-bit address space",
+                        __func__, lineno);
+            continue;
+          }
+          Append(addr, payload, count);
+          break;
+        }
+        case 0x01:
+          pos = len;  // End of file
+          break;
+        case 0x02:
+          if (count == 2) base = ReadBigEndian(payload, 2) << 4;
+          break;
+        case 0x03:
+          if (count == 4) {
+            entry = (ReadBigEndian(payload, 2) << 4) +
+                    ReadBigEndian(payload + 2, 2);
+            has_entry = true;
+          }
+          break;
+        case 0x04:
+          if (count == 2) base = ReadBigEndian(payload, 2) << 16;
+          break;
+        case 0x05:
+          if (count == 4) {
+            entry = ReadBigEndian(payload, 4);
+            has_entry = true;
+          }
+          break;
+        default:
+          break;
+      }
+    } else {
+      // S<type><count><address><data><checksum>
+      const size_t size = (line[0] == 'S' && line_len >= 2)
+                              ? DecodeRecord(line + 2, line_len - 2, record)
+                              : 0;
+      uint8_t sum = 0;
+      for (size_t i = 0; i < size; i++) sum += record[i];
+      if (size < 2 || size != record[0] + 1u || sum != 0xFF) {
+        BN::LogWarn("%s: line %zu: Malformed S-record", __func__, lineno);
+        continue;
+      }
+
+      size_t addr_size;
+      bool is_data;
+      switch (line[1]) {
+        case '1':
+        case '2':
+        case '3':
+          addr_size = line[1] - '0' + 1;
+          is_data = true;
+          break;
+        case '7':
+        case '8':
+        case '9':
+          addr_size = 11 - (line[1] - '0');
+          is_data = false;
+          break;
+        default:
+          continue;  // Header and count records
+      }
+      if (record[0] < addr_size + 1) {
+        BN::LogWarn("%s: line %zu: Malformed S-record", __func__, lineno);
+        continue;
+      }
+
+      const uint64_t addr = ReadBigEndian(record + 1, addr_size);
+      const size_t count = record[0] - addr_size - 1;
+      if (!is_data) {
+        entry = addr;
+        has_entry = true;
+      } else if (addr + count > address_limit) {
+        BN::LogWarn("%s: line %zu: Data beyond 24-bit address space",
+                    __func__, lineno);
+      } else {
+        Append(addr, record + 1 + addr_size, count);
+      }
+    }
+  }
+
+  Normalize();
+  return !segments.empty();
+}
+
+const ImageSegment *FirmwareImage::Find(const uint64_t addr) const {
+  // Last segment starting at or before addr
+  auto it = std::upper_bound(
+      segments.begin(), segments.end(), addr,
+      [](uint64_t a, const ImageSegment &segment) { return a < segment.addr; });
+  if (it == segments.begin()) return nullptr;
+
+  --it;
+  return (addr < it->addr + it->length) ? &*it : nullptr;
+}
+
+C166FirmwareView::C166FirmwareView(BN::BinaryView *data)
+    : BinaryView("C166 Firmware", data->GetFile(), data) {}
+
+bool C166FirmwareView::Init() {
+  const BN::Ref<BN::BinaryView> parent = GetParentView();
+  const BN::DataBuffer text = parent->ReadBuffer(0, parent->GetLength());
+  if (!image.Parse(static_cast<const uint8_t *>(text.GetData()),
+                   text.GetLength())) {
+    BN::LogError("%s: No loadable records found", __func__);
+    return false;
+  }
+
+  // The records do not identify the toolchain; the calling convention can be
+  // changed after loading
+  const BN::Ref<BN::Architecture> arch = BN::Architecture::GetByName("c166tvx");
+  if (!arch) return false;
+  const BN::Ref<BN::Platform> platform = arch->GetStandalonePlatform();
+  SetDefaultArchitecture(arch);
+  SetDefaultPlatform(platform);
+
+  BN::LogInfo("Loaded %zu byte(s) in %zu segment(s)", image.bytes.size(),
+              image.segments.size());
+  for (const auto &segment : image.segments) {
+    BN::LogInfo("  0x%06lx-0x%06lx", segment.addr,
+                segment.addr + segment.length);
+  }
+
+  const uint64_t entry = PerformGetEntryPoint();
+  if (image.Find(entry)) AddEntryPointForAnalysis(platform, entry);
+  return true;
+}
+
+size_t C166FirmwareView::PerformRead(void *dest, const uint64_t offset,
+                                     const size_t len) {
+  size_t done = 0;
+  while (done < len) {
+    const ImageSegment *segment = image.Find(offset + done);
+    if (!segment) break;
+
+    const size_t skip = offset + done - segment->addr;
+    const size_t n = std::min(len - done, segment->length - skip);
+    std::memcpy(static_cast<uint8_t *>(dest) + done,
+                &image.bytes[segment->offset + skip], n);
+    done += n;
+  }
+
+  return done;
+}
+
+size_t C166FirmwareView::PerformWrite(const uint64_t offset, const void *data,
+                                      const size_t len) {
+  size_t done = 0;
+  while (done < len) {
+    const ImageSegment *segment = image.Find(offset + done);
+    if (!segment) break;
+
+    const size_t skip = offset + done - segment->addr;
+    const size_t n = std::min(len - done, segment->length - skip);
+    std::memcpy(&image.bytes[segment->offset + skip],
+                static_cast<const uint8_t *>(data) + done, n);
+    done += n;
+  }
+
+  return done;
+}
+
+bool C166FirmwareView::PerformIsValidOffset(const uint64_t offset) {
+  return image.Find(offset) != nullptr;
+}
+
+bool C166FirmwareView::PerformIsOffsetReadable(const uint64_t offset) {
+  return image.Find(offset) != nullptr;
+}
+
+bool C166FirmwareView::PerformIsOffsetWritable(const uint64_t offset) {
+  return image.Find(offset) != nullptr;
+}
+
+bool C166FirmwareView::PerformIsOffsetExecutable(const uint64_t offset) {
+  return image.Find(offset) != nullptr;
+}
+
+bool C166FirmwareView::PerformIsOffsetBackedByFile(const uint64_t offset) {
+  return image.Find(offset) != nullptr;
+}
+
+uint64_t C166FirmwareView::PerformGetNextValidOffset(const uint64_t offset) {
+  if (image.Find(offset)) return offset;
+
+  for (const auto &segment : image.segments) {
+    if (segment.addr > offset) return segment.addr;
+  }
+  return PerformGetStart() + PerformGetLength();
+}
+
+uint64_t C166FirmwareView::PerformGetStart() const {
+  return image.segments.empty() ? 0 : image.segments.front().addr;
+}
+
+uint64_t C166FirmwareView::PerformGetLength() const {
+  if (image.segments.empty()) return 0;
+
+  const ImageSegment &last = image.segments.back();
+  return last.addr + last.length - PerformGetStart();
+}
+
+// Execution starts at the reset vector unless the file gives an entry point
+uint64_t C166FirmwareView::PerformGetEntryPoint() const {
+  if (image.has_entry) return image.entry;
+  return image.Find(0) ? 0 : PerformGetStart();
+}
+
+bool C166FirmwareView::PerformIsExecutable() const { return true; }
+
+BNEndianness C166FirmwareView::PerformGetDefaultEndianness() const {
+  return LittleEndian;
+}
+
+bool C166FirmwareView::PerformIsRelocatable() const { return false; }
+
+size_t C166FirmwareView::PerformGetAddressSize() const { return 3; }
+
+C166FirmwareViewType::C166FirmwareViewType()
+    : BinaryViewType("C166 Firmware", "C166 Intel HEX/S-record Firmware") {}
+
+BN::Ref<BN::BinaryView> C166FirmwareViewType::Create(BN::BinaryView *data) {
+  return new C166FirmwareView(data);
+}
+
+BN::Ref<BN::BinaryView> C166FirmwareViewType::Parse(BN::BinaryView *data) {
+  return new C166FirmwareView(data);
+}
+
+bool C166FirmwareViewType::IsTypeValidForData(BN::BinaryView *data) {
+  const BN::DataBuffer header = data->ReadBuffer(0, 64);
+  return FirmwareImage::Detect(static_cast<const uint8_t *>(header.GetData()),
+                               header.GetLength()) != FirmwareImage::Unknown;
+}
+}  // namespace C166
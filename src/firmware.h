@@ -0,0 +1,87 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_FIRMWARE_H_
+#define SRC_FIRMWARE_H_
+
+#include <binaryninjaapi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace BN = BinaryNinja;
+
+namespace C166 {
+
+// A run of contiguous bytes at addr, stored at offset in FirmwareImage::bytes
+struct ImageSegment {
+  uint64_t addr;
+  size_t offset;
+  size_t length;
+};
+
+// Memory image decoded from an Intel HEX or Motorola S-record file. Record
+// data is decoded straight into one buffer, and a record that continues the
+// previous one extends its segment, so a well-ordered file produces one
+// segment per contiguous region with no per-record allocations.
+class FirmwareImage {
+  void Append(uint64_t addr, const uint8_t *data, size_t len);
+  void Normalize();
+
+ public:
+  enum Format { Unknown, IntelHex, SRecord };
+
+  // Only the 24-bit C166 address space is mapped
+  static constexpr uint64_t address_limit = uint64_t{1} << 24;
+
+  std::vector<uint8_t> bytes;
+  std::vector<ImageSegment> segments;  // Sorted and disjoint after Parse
+  uint64_t entry;
+  bool has_entry;
+
+  FirmwareImage();
+
+  static Format Detect(const uint8_t *data, size_t len);
+  bool Parse(const uint8_t *data, size_t len);
+  // Segment containing addr, or nullptr
+  const ImageSegment *Find(uint64_t addr) const;
+};
+
+class C166FirmwareView : public BN::BinaryView {
+  FirmwareImage image;
+
+ public:
+  explicit C166FirmwareView(BN::BinaryView *data);
+
+  bool Init() override;
+
+  size_t PerformRead(void *dest, uint64_t offset, size_t len) override;
+  size_t PerformWrite(uint64_t offset, const void *data, size_t len) override;
+  bool PerformIsValidOffset(uint64_t offset) override;
+  bool PerformIsOffsetReadable(uint64_t offset) override;
+  bool PerformIsOffsetWritable(uint64_t offset) override;
+  bool PerformIsOffsetExecutable(uint64_t offset) override;
+  bool PerformIsOffsetBackedByFile(uint64_t offset) override;
+  uint64_t PerformGetNextValidOffset(uint64_t offset) override;
+  [[nodiscard]] uint64_t PerformGetStart() const override;
+  [[nodiscard]] uint64_t PerformGetLength() const override;
+  [[nodiscard]] uint64_t PerformGetEntryPoint() const override;
+  [[nodiscard]] bool PerformIsExecutable() const override;
+  [[nodiscard]] BNEndianness PerformGetDefaultEndianness() const override;
+  [[nodiscard]] bool PerformIsRelocatable() const override;
+  [[nodiscard]] size_t PerformGetAddressSize() const override;
+};
+
+class C166FirmwareViewType : public BN::BinaryViewType {
+ public:
+  C166FirmwareViewType();
+
+  BN::Ref<BN::BinaryView> Create(BN::BinaryView *data) override;
+  BN::Ref<BN::BinaryView> Parse(BN::BinaryView *data) override;
+  bool IsTypeValidForData(BN::BinaryView *data) override;
+  bool IsDeprecated() override { return false; }
+};
+}  // namespace C166
+
+#endif  // SRC_FIRMWARE_H_
@@ -0,0 +1,184 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "flags.h"
+
+#include <binaryninjaapi.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace BN = BinaryNinja;
+
+namespace C166::Flags {
+BNFlagRole GetFlagRole(const uint32_t flag) {
+  switch (flag) {
+    case FLAG_NEGATIVE:
+      return NegativeSignFlagRole;
+    case FLAG_CARRY:
+      return CarryFlagRole;
+    case FLAG_OVERFLOW:
+      return OverflowFlagRole;
+    case FLAG_ZERO:
+      return ZeroFlagRole;
+    case FLAG_E:
+      return SpecialFlagRole;
+    default:
+      BN::LogError("%s: Invalid id: %u", __func__, flag);
+      return SpecialFlagRole;
+  }
+}
+
+std::vector<uint32_t> GetFlagsWritten(const uint32_t wtype) {
+  switch (wtype) {
+    case WRITE_ALL:
+    case WRITE_BIT:
+      return std::vector<uint32_t>{FLAG_NEGATIVE, FLAG_CARRY, FLAG_OVERFLOW,
+                                   FLAG_ZERO, FLAG_E};
+    case WRITE_Z:
+      return std::vector<uint32_t>{FLAG_ZERO};
+    case WRITE_EZN:
+      return std::vector<uint32_t>{FLAG_E, FLAG_ZERO, FLAG_NEGATIVE};
+    case WRITE_LOGIC:
+    case WRITE_ZN:
+    case WRITE_ZNC:
+    case WRITE_ZNV:
+    case WRITE_ZNVC:
+      // The remaining flags are cleared, see GetFlagWriteLowLevelIL
+      return std::vector<uint32_t>{FLAG_NEGATIVE, FLAG_CARRY, FLAG_OVERFLOW,
+                                   FLAG_ZERO, FLAG_E};
+    default:
+      BN::LogError("%s: Invalid write type id: %u", __func__, wtype);
+      return {};
+  }
+}
+
+// Returns whether the write type always clears the flag instead of deriving it
+// from the result
+static bool IsFlagCleared(const uint32_t wtype, const uint32_t flag) {
+  switch (wtype) {
+    case WRITE_LOGIC:
+      return flag == FLAG_OVERFLOW || flag == FLAG_CARRY;
+    case WRITE_ZN:
+      return flag == FLAG_E || flag == FLAG_OVERFLOW || flag == FLAG_CARRY;
+    case WRITE_ZNC:
+      return flag == FLAG_E || flag == FLAG_OVERFLOW;
+    case WRITE_ZNV:
+      return flag == FLAG_E || flag == FLAG_CARRY;
+    case WRITE_ZNVC:
+      return flag == FLAG_E;
+    default:
+      return false;
+  }
+}
+
+// V for MUL/MULU (the product does not fit in 16 bits) and DIV/DIVU/DIVL/
+// DIVLU (division by zero, or the quotient does not fit in 16 bits). The
+// operands are the 16-bit factors, or the dividend and the 16-bit divisor.
+static BN::ExprId GetMulDivOverflow(const BNLowLevelILOperation op,
+                                    BNRegisterOrConstant *operands,
+                                    BN::LowLevelILFunction &il) {
+  const BN::ExprId rhs = il.GetExprForRegisterOrConstant(operands[1], 2);
+  const BN::ExprId zero = il.CompareEqual(2, rhs, il.Const(2, 0));
+
+  switch (op) {
+    case LLIL_MULS_DP: {
+      const BN::ExprId product = il.MultDoublePrecSigned(
+          4, il.GetExprForRegisterOrConstant(operands[0], 2), rhs);
+      return il.CompareNotEqual(4, product,
+                                il.SignExtend(4, il.LowPart(2, product)));
+    }
+    case LLIL_MULU_DP:
+      return il.CompareUnsignedGreaterThan(
+          4,
+          il.MultDoublePrecUnsigned(
+              4, il.GetExprForRegisterOrConstant(operands[0], 2), rhs),
+          il.Const(4, 0xFFFF));
+    case LLIL_DIVS:  // Only 0x8000 / -1 overflows
+      return il.Or(
+          0, zero,
+          il.And(0,
+                 il.CompareEqual(
+                     2, il.GetExprForRegisterOrConstant(operands[0], 2),
+                     il.Const(2, 0x8000)),
+                 il.CompareEqual(2, rhs, il.Const(2, 0xFFFF))));
+    case LLIL_DIVS_DP: {
+      const BN::ExprId quotient =
+          il.DivSigned(4, il.GetExprForRegisterOrConstant(operands[0], 4),
+                       il.SignExtend(4, rhs));
+      return il.Or(0, zero,
+                   il.CompareNotEqual(
+                       4, quotient, il.SignExtend(4, il.LowPart(2, quotient))));
+    }
+    case LLIL_DIVU_DP:
+      return il.Or(
+          0, zero,
+          il.CompareUnsignedGreaterThan(
+              4,
+              il.DivUnsigned(4, il.GetExprForRegisterOrConstant(operands[0], 4),
+                             il.ZeroExtend(4, rhs)),
+              il.Const(4, 0xFFFF)));
+    default:  // LLIL_DIVU
+      return zero;
+  }
+}
+
+bool GetFlagWriteLowLevelIL(const BNLowLevelILOperation op, const size_t size,
+                            const uint32_t wtype, const uint32_t flag,
+                            BNRegisterOrConstant *operands,
+                            const size_t operandCount,
+                            BN::LowLevelILFunction &il, BN::ExprId &result) {
+  if (IsFlagCleared(wtype, flag)) {
+    result = il.Const(0, 0);
+    return true;
+  }
+
+  if (wtype == WRITE_ZNV && flag == FLAG_OVERFLOW && operandCount == 2) {
+    result = GetMulDivOverflow(op, operands, il);
+    return true;
+  }
+
+  // ADDC/SUBC only keep Z set, so that Z covers the whole long result
+  if (flag == FLAG_ZERO && (op == LLIL_ADC || op == LLIL_SBB) &&
+      operandCount == 3) {
+    const BN::ExprId lhs = il.GetExprForRegisterOrConstant(operands[0], size);
+    const BN::ExprId rhs = il.GetExprForRegisterOrConstant(operands[1], size);
+    const BN::ExprId carry = il.GetExprForRegisterOrConstant(operands[2], 0);
+    result = il.And(
+        0, il.Flag(FLAG_ZERO),
+        il.CompareEqual(size,
+                        op == LLIL_ADC ? il.AddCarry(size, lhs, rhs, carry)
+                                       : il.SubBorrow(size, lhs, rhs, carry),
+                        il.Const(size, 0)));
+    return true;
+  }
+
+  // E is set when the source operand is the lowest negative number of its
+  // size (0x8000 or 0x80). The source of ADDC/SUBC is the one before the
+  // carry, that of MOVBS/MOVBZ is the byte, and that of a fused long ADD/SUB
+  // pair is the high word read by the ADDC/SUBC.
+  if (flag == FLAG_E && operandCount > 0 && size > 0 && size <= 4) {
+    const size_t src =
+        op == LLIL_ADC || op == LLIL_SBB ? 1 : operandCount - 1;
+    size_t src_size = size;
+    BN::ExprId value;
+    if (op == LLIL_SX || op == LLIL_ZX) {
+      src_size = size / 2;
+      value = il.GetExprForRegisterOrConstant(operands[src], src_size);
+    } else if (size == 4) {
+      src_size = 2;
+      value = il.LowPart(
+          2, il.LogicalShiftRight(
+                 4, il.GetExprForRegisterOrConstant(operands[src], 4),
+                 il.Const(1, 16)));
+    } else {
+      value = il.GetExprForRegisterOrConstant(operands[src], size);
+    }
+    result = il.CompareEqual(src_size, value,
+                             il.Const(src_size, 1ull << (src_size * 8 - 1)));
+    return true;
+  }
+
+  return false;
+}
+}  // namespace C166::Flags
@@ -4,6 +4,11 @@
 #ifndef SRC_FLAGS_H_
 #define SRC_FLAGS_H_
 
+#include <binaryninjaapi.h>
+
+#include <cstdint>
+#include <vector>
+
 namespace C166::Flags {
 constexpr uint8_t FLAG_NEGATIVE = 0;
 constexpr uint8_t FLAG_CARRY = 1;
@@ -11,9 +16,38 @@ constexpr uint8_t FLAG_OVERFLOW = 2;
 constexpr uint8_t FLAG_ZERO = 3;
 constexpr uint8_t FLAG_E = 4;
 
-constexpr uint8_t WRITE_ALL = 0;
-constexpr uint8_t WRITE_Z = 1;
-constexpr uint8_t WRITE_EZN = 2;
+// Write type 0 is reserved by Binary Ninja for instructions that leave the
+// flags alone. Types that clear a flag still list it as written so the stale
+// value is not propagated.
+constexpr uint8_t WRITE_NONE = 0;
+constexpr uint8_t WRITE_ALL = 1;    // E Z V C N (arithmetic, compare)
+constexpr uint8_t WRITE_Z = 2;      // Z only (JBC/JNBS bit test)
+constexpr uint8_t WRITE_EZN = 3;    // E Z N, V and C unchanged (MOV, POP)
+constexpr uint8_t WRITE_LOGIC = 4;  // E Z N, V and C cleared (AND, OR, CPL)
+constexpr uint8_t WRITE_ZN = 5;     // Z N, E V and C cleared (BFLDL, BFLDH)
+constexpr uint8_t WRITE_ZNC = 6;    // Z N C, E and V cleared (SHL, ROL)
+constexpr uint8_t WRITE_ZNV = 7;    // Z N V, E and C cleared (MUL, DIV)
+constexpr uint8_t WRITE_ZNVC = 8;   // Z N V C, E cleared (SHR, ROR, ASHR)
+// E Z V C N from the bit operands rather than a result, so the lifter sets
+// them explicitly (BSET, BAND, PRIOR, ...)
+constexpr uint8_t WRITE_BIT = 9;
+
+// Semantic flag classes pick how a condition is evaluated from the flags of
+// the instruction that wrote them. Class 0 covers every other write type.
+constexpr uint8_t CLASS_ARITH = 1;  // C is the carry/borrow of an ADD/SUB/CMP
+constexpr uint8_t CLASS_LOGIC = 2;  // C and V are always clear
+
+// Flag write lowering shared by C166Architecture and the difftest, which
+// cannot instantiate the architecture
+BNFlagRole GetFlagRole(uint32_t flag);
+std::vector<uint32_t> GetFlagsWritten(uint32_t wtype);
+// Returns false for flags that take the core's default lowering for their role
+bool GetFlagWriteLowLevelIL(BNLowLevelILOperation op, size_t size,
+                            uint32_t wtype, uint32_t flag,
+                            BNRegisterOrConstant *operands,
+                            size_t operandCount,
+                            BinaryNinja::LowLevelILFunction &il,
+                            BinaryNinja::ExprId &result);
 }  // namespace C166::Flags
 
 #endif  // SRC_FLAGS_H_
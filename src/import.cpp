@@ -0,0 +1,313 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "import.h"
+
+#include <binaryninjaapi.h>
+
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace BN = BinaryNinja;
+
+namespace C166 {
+
+static std::string Trim(const std::string &s) {
+  const size_t first = s.find_first_not_of(" \t\r\n");
+  if (first == std::string::npos) return "";
+  return s.substr(first, s.find_last_not_of(" \t\r\n") - first + 1);
+}
+
+static bool ParseNumber(const std::string &text, uint64_t &value) {
+  if (text.empty()) return false;
+
+  char *end;
+  value = strtoull(text.c_str(), &end, 0);
+  return *end == '\0';
+}
+
+bool StateImport::ParseKind(const std::string &name, StateRange::Kind &kind) {
+  std::string lower;
+  for (const char c : name) lower += static_cast<char>(std::tolower(c));
+
+  if (lower == "dpp") {
+    kind = StateRange::Dpp;
+  } else if (lower == "extp") {
+    kind = StateRange::Extp;
+  } else if (lower == "exts") {
+    kind = StateRange::Exts;
+  } else if (lower == "extr") {
+    kind = StateRange::Extr;
+  } else {
+    return false;
+  }
+
+  return true;
+}
+
+// Checks the bounds of a parsed range given how many values it came with
+bool StateImport::Validate(StateRange &range, const size_t values) {
+  if (range.start > range.end || range.end >= StateTable::address_limit)
+    return false;
+
+  switch (range.kind) {
+    case StateRange::Dpp:
+      if (values != 4) return false;
+      for (const uint16_t dpp : range.value) {
+        if (dpp > 0x3FF) return false;
+      }
+      return true;
+    case StateRange::Extp:
+      return values == 1 && range.value[0] <= 0x3FF;
+    case StateRange::Exts:
+      return values == 1 && range.value[0] <= 0xFF;
+    case StateRange::Extr:
+      return values == 0;
+    default:
+      return false;
+  }
+}
+
+bool StateImport::LoadCsv(const std::string &filename,
+                          std::vector<StateRange> &ranges) {
+  std::ifstream file(filename);
+  if (!file.is_open()) {
+    BN::LogError("%s: Unable to open %s", __func__, filename.c_str());
+    return false;
+  }
+
+  std::string line;
+  size_t lineno = 0;
+  while (std::getline(file, line)) {
+    lineno++;
+    line = Trim(line);
+    if (line.empty() || line[0] == '#') continue;
+
+    std::vector<std::string> fields;
+    std::istringstream stream(line);
+    for (std::string field; std::getline(stream, field, ',');)
+      fields.push_back(Trim(field));
+
+    if (lineno == 1 && !fields.empty() && fields[0] == "kind") continue;
+
+    StateRange range{};
+    uint64_t start, end;
+    bool valid = fields.size() >= 3 && fields.size() <= 7 &&
+                 ParseKind(fields[0], range.kind) &&
+                 ParseNumber(fields[1], start) && ParseNumber(fields[2], end);
+
+    for (size_t i = 3; valid && i < fields.size(); i++) {
+      uint64_t value;
+      valid = ParseNumber(fields[i], value) && value <= 0xFFFF;
+      range.value[i - 3] = static_cast<uint16_t>(value);
+    }
+
+    if (valid) {
+      range.start = start;
+      range.end = end;
+      valid = Validate(range, fields.size() - 3);
+    }
+
+    if (!valid) {
+      BN::LogWarn("%s: %s:%zu: Malformed range", __func__, filename.c_str(),
+                  lineno);
+      continue;
+    }
+    ranges.push_back(range);
+  }
+
+  return true;
+}
+
+/*
+ * Minimal streaming JSON reader, sufficient for arrays of flat range objects
+ */
+
+static void SkipSpace(std::istream &in) {
+  while (std::isspace(in.peek())) in.get();
+}
+
+static bool Consume(std::istream &in, const char c) {
+  SkipSpace(in);
+  if (in.peek() != c) return false;
+  in.get();
+  return true;
+}
+
+static bool ReadString(std::istream &in, std::string &out) {
+  out.clear();
+  if (!Consume(in, '"')) return false;
+
+  for (int c = in.get(); c != EOF; c = in.get()) {
+    if (c == '"') return true;
+    if (c == '\\') {
+      c = in.get();
+      if (c == EOF) return false;
+    }
+    out += static_cast<char>(c);
+  }
+
+  return false;
+}
+
+// A JSON number, or a string holding one (e.g. "0x1F00")
+static bool ReadNumber(std::istream &in, uint64_t &value) {
+  SkipSpace(in);
+
+  std::string text;
+  if (in.peek() == '"') {
+    if (!ReadString(in, text)) return false;
+  } else {
+    while (std::isalnum(in.peek())) text += static_cast<char>(in.get());
+  }
+
+  return ParseNumber(Trim(text), value);
+}
+
+// Skips a member value this importer does not use
+static bool SkipValue(std::istream &in) {
+  SkipSpace(in);
+
+  const int c = in.peek();
+  if (c == '"') {
+    std::string ignored;
+    return ReadString(in, ignored);
+  }
+
+  if (c == '[' || c == '{') {
+    const char close = (c == '[') ? ']' : '}';
+    in.get();
+    if (Consume(in, close)) return true;
+
+    do {
+      if (c == '{') {
+        std::string key;
+        if (!ReadString(in, key) || !Consume(in, ':')) return false;
+      }
+      if (!SkipValue(in)) return false;
+    } while (Consume(in, ','));
+
+    return Consume(in, close);
+  }
+
+  // Number or literal
+  bool any = false;
+  while (std::isalnum(in.peek()) || in.peek() == '-' || in.peek() == '+' ||
+         in.peek() == '.') {
+    in.get();
+    any = true;
+  }
+
+  return any;
+}
+
+bool StateImport::ParseJsonArray(std::istream &in, const std::string &filename,
+                                 std::vector<StateRange> &ranges) {
+  if (!Consume(in, '[')) return false;
+  if (Consume(in, ']')) return true;
+
+  size_t index = 0;
+  do {
+    if (!Consume(in, '{')) return false;
+
+    StateRange range{};
+    bool has_kind = false, has_start = false, has_end = false, valid = true;
+    bool has_pag10 = false, has_seg8 = false;
+    size_t dpps = 0;
+    uint64_t pag10 = 0, seg8 = 0;
+
+    if (!Consume(in, '}')) {
+      do {
+        std::string key;
+        if (!ReadString(in, key) || !Consume(in, ':')) return false;
+
+        if (key == "kind") {
+          std::string kind;
+          if (!ReadString(in, kind)) return false;
+          has_kind = ParseKind(kind, range.kind);
+        } else if (key == "start" || key == "end") {
+          uint64_t value;
+          if (!ReadNumber(in, value)) return false;
+          (key == "start" ? range.start : range.end) = value;
+          (key == "start" ? has_start : has_end) = true;
+        } else if (key == "pag10" || key == "seg8") {
+          if (!ReadNumber(in, key == "pag10" ? pag10 : seg8)) return false;
+          (key == "pag10" ? has_pag10 : has_seg8) = true;
+        } else if (key == "dpp") {
+          if (!Consume(in, '[')) return false;
+          if (!Consume(in, ']')) {
+            do {
+              uint64_t value;
+              if (!ReadNumber(in, value)) return false;
+              if (dpps < 4) range.value[dpps] = static_cast<uint16_t>(value);
+              valid = valid && value <= 0xFFFF;
+              dpps++;
+            } while (Consume(in, ','));
+            if (!Consume(in, ']')) return false;
+          }
+        } else if (!SkipValue(in)) {
+          return false;
+        }
+      } while (Consume(in, ','));
+
+      if (!Consume(in, '}')) return false;
+    }
+
+    // Count the values given for the kind; anything else makes it malformed
+    size_t values = dpps + has_pag10 + has_seg8;
+    if (has_kind && range.kind == StateRange::Extp) {
+      range.value[0] = static_cast<uint16_t>(pag10);
+      valid = valid && pag10 <= 0xFFFF && !has_seg8 && !dpps;
+    } else if (has_kind && range.kind == StateRange::Exts) {
+      range.value[0] = static_cast<uint16_t>(seg8);
+      valid = valid && seg8 <= 0xFFFF && !has_pag10 && !dpps;
+    } else if (has_pag10 || has_seg8) {
+      valid = false;
+    }
+
+    if (valid && has_kind && has_start && has_end &&
+        Validate(range, values)) {
+      ranges.push_back(range);
+    } else {
+      BN::LogWarn("%s: %s: Malformed range at index %zu", __func__,
+                  filename.c_str(), index);
+    }
+    index++;
+  } while (Consume(in, ','));
+
+  return Consume(in, ']');
+}
+
+bool StateImport::LoadJson(const std::string &filename,
+                           std::vector<StateRange> &ranges) {
+  std::ifstream file(filename);
+  if (!file.is_open()) {
+    BN::LogError("%s: Unable to open %s", __func__, filename.c_str());
+    return false;
+  }
+
+  if (!ParseJsonArray(file, filename, ranges)) {
+    BN::LogError("%s: %s: Expected an array of range objects", __func__,
+                 filename.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+bool StateImport::Load(const std::string &filename,
+                       std::vector<StateRange> &ranges) {
+  const size_t dot = filename.find_last_of('.');
+  std::string extension =
+      (dot == std::string::npos) ? "" : filename.substr(dot + 1);
+  for (char &c : extension) c = static_cast<char>(std::tolower(c));
+
+  if (extension == "json") return LoadJson(filename, ranges);
+  return LoadCsv(filename, ranges);
+}
+}  // namespace C166
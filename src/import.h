@@ -0,0 +1,46 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_IMPORT_H_
+#define SRC_IMPORT_H_
+
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "state.h"
+
+namespace C166 {
+
+// Reads DPP/EXT range tables exported by other tools. Both formats are parsed
+// as a stream, one range at a time, so only the resulting ranges are kept in
+// memory. Malformed entries are logged and skipped.
+//
+// CSV: one range per line as kind,start,end[,value...], where kind is dpp
+// (four values), extp (pag10), exts (seg8) or extr (none). Blank lines, lines
+// starting with '#' and a "kind,..." header line are ignored.
+//
+// JSON: an array of objects with "kind", "start" and "end" members plus "dpp"
+// (an array of four values), "pag10" or "seg8" as the kind requires.
+//
+// Numbers may be decimal or 0x-prefixed hexadecimal, and JSON numbers may also
+// be given as strings. end is inclusive.
+class StateImport {
+  static bool ParseKind(const std::string &name, StateRange::Kind &kind);
+  static bool Validate(StateRange &range, size_t values);
+  static bool ParseJsonArray(std::istream &in, const std::string &filename,
+                             std::vector<StateRange> &ranges);
+
+ public:
+  static bool LoadCsv(const std::string &filename,
+                      std::vector<StateRange> &ranges);
+  static bool LoadJson(const std::string &filename,
+                       std::vector<StateRange> &ranges);
+  // Picks the format from the file extension (.json, otherwise CSV)
+  static bool Load(const std::string &filename,
+                   std::vector<StateRange> &ranges);
+};
+}  // namespace C166
+
+#endif  // SRC_IMPORT_H_
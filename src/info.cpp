@@ -14,31 +14,18 @@ namespace BN = BinaryNinja;
 namespace C166 {
 bool Calla::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
                  BN::InstructionInfo& result) {
-  const auto code = GetConditionCode(data, length);
-  const auto target = GetTarget(data, addr, length);
-
-  if (code == Conditions::CC_UC)
-    result.AddBranch(CallDestination, target);
-  else {
-    result.AddBranch(
-        TrueBranch,
-        target);  // TODO: Figure out how to model as CallDestination
-    result.AddBranch(FalseBranch, addr + length);
-  }
-
+  // Conditional calls fall through when not taken, which the lifter models
+  // with an If around the call; the target is a call destination either way.
+  result.AddBranch(CallDestination, GetTarget(data, addr));
   result.length = length;
   return true;
 }
 
 bool Calli::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
                  BN::InstructionInfo& result) {
-  if (const auto code = GetConditionCode(data, length);
+  if (const auto code = GetConditionCode(data);
       code == Conditions::CC_UC)
     result.AddBranch(UnresolvedBranch);
-  else {
-    BN::LogDebug("[I] 0x%lx: Unhandled CALLI variant", addr);
-    return false;
-  }
 
   result.length = length;
   return true;
@@ -46,21 +33,21 @@ bool Calli::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
 
 bool Callr::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
                  BN::InstructionInfo& result) {
-  result.AddBranch(CallDestination, GetTarget(data, addr, length));
+  result.AddBranch(CallDestination, GetTarget(data, addr));
   result.length = length;
   return true;
 }
 
 bool Calls::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
                  BN::InstructionInfo& result) {
-  result.AddBranch(CallDestination, GetTarget(data, length));
+  result.AddBranch(CallDestination, GetTarget(data));
   result.length = length;
   return true;
 }
 
 bool Jb::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
               BN::InstructionInfo& result) {
-  const auto target = GetTarget(data, addr, length);
+  const auto target = GetTarget(data, addr);
 
   result.AddBranch(TrueBranch, target);
   result.AddBranch(FalseBranch, addr + length);
@@ -71,7 +58,7 @@ bool Jb::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
 
 bool Jbc::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
                BN::InstructionInfo& result) {
-  const auto target = GetTarget(data, addr, length);
+  const auto target = GetTarget(data, addr);
 
   result.AddBranch(TrueBranch, target);
   result.AddBranch(FalseBranch, addr + length);
@@ -82,8 +69,8 @@ bool Jbc::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
 
 bool Jmpa::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
                 BN::InstructionInfo& result) {
-  const auto code = GetConditionCode(data, length);
-  const auto target = GetTarget(data, addr, length);
+  const auto code = GetConditionCode(data);
+  const auto target = GetTarget(data, addr);
 
   if (code == Conditions::CC_UC)
     result.AddBranch(UnconditionalBranch, target);
@@ -98,7 +85,7 @@ bool Jmpa::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
 
 bool Jmpi::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
                 BN::InstructionInfo& result) {
-  if (const auto code = Instruction::GetData4High(data, length);
+  if (const auto code = Instruction::GetData4High(data);
       code == Conditions::CC_UC)
     result.AddBranch(UnresolvedBranch);
   else {
@@ -113,9 +100,9 @@ bool Jmpi::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
 
 bool Jmpr::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
                 BN::InstructionInfo& result) {
-  const auto target = GetTarget(data, addr, length);
+  const auto target = GetTarget(data, addr);
 
-  if (GetConditionCode(data, length) == Conditions::CC_UC)
+  if (GetConditionCode(data) == Conditions::CC_UC)
     result.AddBranch(UnconditionalBranch, target);
   else {
     result.AddBranch(TrueBranch, target);
@@ -128,7 +115,7 @@ bool Jmpr::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
 
 bool Jmps::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
                 BN::InstructionInfo& result) {
-  const auto target = GetTarget(data, length);
+  const auto target = GetTarget(data);
   result.AddBranch(UnconditionalBranch, target);
   result.length = length;
   return true;
@@ -136,7 +123,7 @@ bool Jmps::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
 
 bool Jnb::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
                BN::InstructionInfo& result) {
-  const auto target = GetTarget(data, addr, length);
+  const auto target = GetTarget(data, addr);
 
   result.AddBranch(TrueBranch, target);
   result.AddBranch(FalseBranch, addr + length);
@@ -147,7 +134,7 @@ bool Jnb::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
 
 bool Jnbs::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
                 BN::InstructionInfo& result) {
-  const auto target = GetTarget(data, addr, length);
+  const auto target = GetTarget(data, addr);
 
   result.AddBranch(TrueBranch, target);
   result.AddBranch(FalseBranch, addr + length);
@@ -156,9 +143,16 @@ bool Jnbs::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
   return true;
 }
 
+bool Pcall::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
+                 BN::InstructionInfo& result) {
+  result.AddBranch(CallDestination, GetTarget(data, addr));
+  result.length = length;
+  return true;
+}
+
 bool Trap::Info(const uint8_t* data, const uint64_t addr, const size_t maxLen,
                 BN::InstructionInfo& result) {
-  result.AddBranch(CallDestination, GetTarget(data, addr));
+  result.AddBranch(CallDestination, GetTarget(data));
   result.length = length;
   return true;
 }
@@ -10,30 +10,12 @@
 #include <vector>
 
 #include "flags.h"
+#include "variants.h"
 
 namespace BN = BinaryNinja;
 
 namespace C166 {
 
-// Indirect Addressing Expressions (using EXTS)
-static BN::ExprId GetIndAddrExpr_Exts_Rw(BN::LowLevelILFunction& il,
-                                         uint32_t seg8, uint32_t Rw);
-static BN::ExprId GetIndAddrExpr_Exts_Rw_data16(BN::LowLevelILFunction& il,
-                                                uint32_t seg8, uint32_t Rw,
-                                                uint16_t data16);
-
-// Indirect Addressing Expressions (using EXTP)
-static BN::ExprId GetIndAddrExpr_Extp_Rw(BN::LowLevelILFunction& il,
-                                         uint32_t pag10, uint32_t Rw);
-static BN::ExprId GetIndAddrExpr_Extp_Rw_data16(BN::LowLevelILFunction& il,
-                                                uint32_t pag10, uint32_t Rw,
-                                                uint16_t data16);
-
-// Indirect Addressing Expressions (Using DPP by default)
-// static BN::ExprId GetIndAddrExpr_Rw(BN::LowLevelILFunction &il, uint32_t Rw);
-static BN::ExprId GetIndAddrExpr_Rw_data16(BN::LowLevelILFunction& il,
-                                           uint32_t Rw, uint16_t data16);
-
 class Add {
   static constexpr uint32_t flags = Flags::WRITE_ALL;
 
@@ -75,7 +57,7 @@ class Addcb {
 };
 
 class And {
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_LOGIC;
 
  public:
   static bool Lift(uint8_t op, const uint8_t* data, uint64_t addr, size_t& len,
@@ -85,7 +67,7 @@ class And {
 };
 
 class Andb {
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_LOGIC;
 
  public:
   static bool Lift(uint8_t op, const uint8_t* data, uint64_t addr, size_t& len,
@@ -96,7 +78,7 @@ class Andb {
 
 class Ashr {
   static constexpr size_t length = 2;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_ZNVC;
 
  public:
   static bool LiftxAC(const uint8_t* data, uint64_t addr, size_t& len,
@@ -111,7 +93,7 @@ class Ashr {
 
 class Band {
   static constexpr size_t length = 4;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_BIT;
 
  public:
   static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
@@ -122,7 +104,7 @@ class Band {
 
 class Bclr {
   static constexpr size_t length = 2;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_BIT;
 
  public:
   static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
@@ -133,7 +115,7 @@ class Bclr {
 
 class Bcmp {
   static constexpr size_t length = 4;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_BIT;
 
  public:
   static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
@@ -144,7 +126,7 @@ class Bcmp {
 
 class Bfldh {
   static constexpr size_t length = 4;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_ZN;
 
  public:
   static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
@@ -155,7 +137,7 @@ class Bfldh {
 
 class Bfldl {
   static constexpr size_t length = 4;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_ZN;
 
  public:
   static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
@@ -166,7 +148,7 @@ class Bfldl {
 
 class Bmov {
   static constexpr size_t length = 4;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_BIT;
 
  public:
   static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
@@ -177,7 +159,7 @@ class Bmov {
 
 class Bmovn {
   static constexpr size_t length = 4;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_BIT;
 
  public:
   static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
@@ -188,7 +170,7 @@ class Bmovn {
 
 class Bor {
   static constexpr size_t length = 4;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_BIT;
 
  public:
   static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
@@ -199,7 +181,7 @@ class Bor {
 
 class Bset {
   static constexpr size_t length = 2;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_BIT;
 
  public:
   static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
@@ -210,7 +192,7 @@ class Bset {
 
 class Bxor {
   static constexpr size_t length = 4;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_BIT;
 
  public:
   static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
@@ -221,8 +203,8 @@ class Bxor {
 
 class Calla {
   static constexpr size_t length = 4;
-  static uint32_t GetTarget(const uint8_t* data, uint64_t addr, size_t len);
-  static uint32_t GetConditionCode(const uint8_t* data, size_t len);
+  static uint32_t GetTarget(const uint8_t* data, uint64_t addr);
+  static uint32_t GetConditionCode(const uint8_t* data);
 
  public:
   static bool Info(const uint8_t* data, uint64_t addr, size_t maxLen,
@@ -235,7 +217,7 @@ class Calla {
 
 class Calli {
   static constexpr size_t length = 2;
-  static uint32_t GetConditionCode(const uint8_t* data, size_t len);
+  static uint32_t GetConditionCode(const uint8_t* data);
 
  public:
   static bool Info(const uint8_t* data, uint64_t addr, size_t maxLen,
@@ -248,8 +230,8 @@ class Calli {
 
 class Callr {
   static constexpr size_t length = 2;
-  static uint8_t GetRelativeOffset(const uint8_t* data, size_t len);
-  static uint32_t GetTarget(const uint8_t* data, uint64_t addr, size_t len);
+  static uint8_t GetRelativeOffset(const uint8_t* data);
+  static uint32_t GetTarget(const uint8_t* data, uint64_t addr);
 
  public:
   static bool Info(const uint8_t* data, uint64_t addr, size_t maxLen,
@@ -262,7 +244,7 @@ class Callr {
 
 class Calls {
   static constexpr size_t length = 4;
-  static uint32_t GetTarget(const uint8_t* data, size_t len);
+  static uint32_t GetTarget(const uint8_t* data);
 
  public:
   static bool Info(const uint8_t* data, uint64_t addr, size_t maxLen,
@@ -367,7 +349,7 @@ class Cmpi2 {
 
 class Cpl {
   static constexpr size_t length = 2;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_EZN;
 
  public:
   static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
@@ -378,7 +360,7 @@ class Cpl {
 
 class Cplb {
   static constexpr size_t length = 2;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_EZN;
 
  public:
   static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
@@ -399,7 +381,7 @@ class Diswdt {
 
 class Div {
   static constexpr size_t length = 2;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_ZNV;
 
  public:
   static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
@@ -410,7 +392,7 @@ class Div {
 
 class Divl {
   static constexpr size_t length = 2;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_ZNV;
 
  public:
   static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
@@ -421,7 +403,7 @@ class Divl {
 
 class Divlu {
   static constexpr size_t length = 2;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_ZNV;
 
  public:
   static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
@@ -432,7 +414,7 @@ class Divlu {
 
 class Divu {
   static constexpr size_t length = 2;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_ZNV;
 
  public:
   static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
@@ -452,8 +434,7 @@ class Einit {
 };
 
 class Extprs {
-  static const char* GetInstruction(const uint8_t* data, uint64_t addr,
-                                    size_t len);
+  static const char* GetInstruction(const uint8_t* data, uint64_t addr);
 
  public:
   static bool LiftxD7(const uint8_t* data, uint64_t addr, size_t& len,
@@ -487,11 +468,9 @@ class Idle {
 };
 
 class Jb {
-  static constexpr size_t flags =
-      Flags::WRITE_Z;  // Required to model bit status
   static constexpr size_t length = 4;
-  static uint8_t GetRelativeOffset(const uint8_t* data, size_t len);
-  static uint32_t GetTarget(const uint8_t* data, uint64_t addr, size_t len);
+  static uint8_t GetRelativeOffset(const uint8_t* data);
+  static uint32_t GetTarget(const uint8_t* data, uint64_t addr);
 
  public:
   static bool Info(const uint8_t* data, uint64_t addr, size_t maxLen,
@@ -506,8 +485,8 @@ class Jbc {
   static constexpr size_t flags =
       Flags::WRITE_Z;  // Required to model bit status
   static constexpr size_t length = 4;
-  static uint8_t GetRelativeOffset(const uint8_t* data, size_t len);
-  static uint32_t GetTarget(const uint8_t* data, uint64_t addr, size_t len);
+  static uint8_t GetRelativeOffset(const uint8_t* data);
+  static uint32_t GetTarget(const uint8_t* data, uint64_t addr);
 
  public:
   static bool Info(const uint8_t* data, uint64_t addr, size_t maxLen,
@@ -520,8 +499,8 @@ class Jbc {
 
 class Jmpa {
   static constexpr size_t length = 4;
-  static uint32_t GetTarget(const uint8_t* data, uint64_t addr, size_t len);
-  static uint32_t GetConditionCode(const uint8_t* data, size_t len);
+  static uint32_t GetTarget(const uint8_t* data, uint64_t addr);
+  static uint32_t GetConditionCode(const uint8_t* data);
 
  public:
   static bool Info(const uint8_t* data, uint64_t addr, size_t maxLen,
@@ -546,9 +525,9 @@ class Jmpi {
 
 class Jmpr {
   static constexpr size_t length = 2;
-  static uint8_t GetRelativeOffset(const uint8_t* data, size_t len);
-  static uint32_t GetTarget(const uint8_t* data, uint64_t addr, size_t len);
-  static uint32_t GetConditionCode(const uint8_t* data, size_t len);
+  static uint8_t GetRelativeOffset(const uint8_t* data);
+  static uint32_t GetTarget(const uint8_t* data, uint64_t addr);
+  static uint32_t GetConditionCode(const uint8_t* data);
 
  public:
   static bool Info(const uint8_t* data, uint64_t addr, size_t maxLen,
@@ -561,7 +540,7 @@ class Jmpr {
 
 class Jmps {
   static constexpr size_t length = 4;
-  static uint32_t GetTarget(const uint8_t* data, size_t len);
+  static uint32_t GetTarget(const uint8_t* data);
 
  public:
   static bool Info(const uint8_t* data, uint64_t addr, size_t maxLen,
@@ -573,11 +552,9 @@ class Jmps {
 };
 
 class Jnb {
-  static constexpr size_t flags =
-      Flags::WRITE_Z;  // Required to model bit status
   static constexpr size_t length = 4;
-  static uint8_t GetRelativeOffset(const uint8_t* data, size_t len);
-  static uint32_t GetTarget(const uint8_t* data, uint64_t addr, size_t len);
+  static uint8_t GetRelativeOffset(const uint8_t* data);
+  static uint32_t GetTarget(const uint8_t* data, uint64_t addr);
 
  public:
   static bool Info(const uint8_t* data, uint64_t addr, size_t maxLen,
@@ -592,8 +569,8 @@ class Jnbs {
   static constexpr size_t flags =
       Flags::WRITE_Z;  // Required to model bit status
   static constexpr size_t length = 4;
-  static uint8_t GetRelativeOffset(const uint8_t* data, size_t len);
-  static uint32_t GetTarget(const uint8_t* data, uint64_t addr, size_t len);
+  static uint8_t GetRelativeOffset(const uint8_t* data);
+  static uint32_t GetTarget(const uint8_t* data, uint64_t addr);
 
  public:
   static bool Info(const uint8_t* data, uint64_t addr, size_t maxLen,
@@ -616,10 +593,12 @@ class Mov {
                       BN::LowLevelILFunction& il);
   static bool Textx94(const uint8_t* data, uint64_t addr, size_t& len,
                       std::vector<BN::InstructionTextToken>& result);
+  template <Variant V>
   static bool Liftx88(const uint8_t* data, uint64_t addr, size_t& len,
                       BN::LowLevelILFunction& il);
   static bool Textx88(const uint8_t* data, uint64_t addr, size_t& len,
                       std::vector<BN::InstructionTextToken>& result);
+  template <Variant V>
   static bool Liftx98(const uint8_t* data, uint64_t addr, size_t& len,
                       BN::LowLevelILFunction& il);
   static bool Textx98(const uint8_t* data, uint64_t addr, size_t& len,
@@ -678,10 +657,12 @@ class Movb {
   static constexpr uint32_t flags = Flags::WRITE_EZN;
 
  public:
+  template <Variant V>
   static bool Liftx89(const uint8_t* data, uint64_t addr, size_t& len,
                       BN::LowLevelILFunction& il);
   static bool Textx89(const uint8_t* data, uint64_t addr, size_t& len,
                       std::vector<BN::InstructionTextToken>& result);
+  template <Variant V>
   static bool Liftx99(const uint8_t* data, uint64_t addr, size_t& len,
                       BN::LowLevelILFunction& il);
   static bool Textx99(const uint8_t* data, uint64_t addr, size_t& len,
@@ -782,7 +763,7 @@ class Movbz {
 
 class Mul {
   static constexpr size_t length = 2;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_ZNV;
 
  public:
   static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
@@ -793,7 +774,7 @@ class Mul {
 
 class Mulu {
   static constexpr size_t length = 2;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_ZNV;
 
  public:
   static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
@@ -835,7 +816,7 @@ class Nop {
 };
 
 class Or {
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_LOGIC;
 
  public:
   static bool Lift(uint8_t op, const uint8_t* data, uint64_t addr, size_t& len,
@@ -845,7 +826,7 @@ class Or {
 };
 
 class Orb {
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_LOGIC;
 
  public:
   static bool Lift(uint8_t op, const uint8_t* data, uint64_t addr, size_t& len,
@@ -854,6 +835,20 @@ class Orb {
                    std::vector<BN::InstructionTextToken>& result);
 };
 
+class Pcall {
+  static constexpr uint32_t flags = Flags::WRITE_EZN;
+  static constexpr size_t length = 4;
+  static uint32_t GetTarget(const uint8_t* data, uint64_t addr);
+
+ public:
+  static bool Info(const uint8_t* data, uint64_t addr, size_t maxLen,
+                   BN::InstructionInfo& result);
+  static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
+                   BN::LowLevelILFunction& il);
+  static bool Text(const uint8_t* data, uint64_t addr, size_t& len,
+                   std::vector<BN::InstructionTextToken>& result);
+};
+
 class Pop {
   static constexpr uint32_t flags = Flags::WRITE_EZN;
   static constexpr size_t length = 2;
@@ -867,7 +862,7 @@ class Pop {
 
 class Prior {
   static constexpr size_t length = 2;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_BIT;
 
  public:
   static bool Lift(const uint8_t* data, uint64_t addr, size_t& len,
@@ -918,6 +913,7 @@ class Reti {
 };
 
 class Retp {
+  static constexpr uint32_t flags = Flags::WRITE_EZN;
   static constexpr size_t length = 2;
 
  public:
@@ -939,7 +935,7 @@ class Rets {
 
 class Rol {
   static constexpr size_t length = 2;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_ZNC;
 
  public:
   static bool Liftx0C(const uint8_t* data, uint64_t addr, size_t& len,
@@ -954,7 +950,7 @@ class Rol {
 
 class Ror {
   static constexpr size_t length = 2;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_ZNVC;
 
  public:
   static bool Liftx2C(const uint8_t* data, uint64_t addr, size_t& len,
@@ -983,7 +979,7 @@ class Scxt {
 
 class Shl {
   static constexpr size_t length = 2;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_ZNC;
 
  public:
   static bool Liftx4C(const uint8_t* data, uint64_t addr, size_t& len,
@@ -998,7 +994,7 @@ class Shl {
 
 class Shr {
   static constexpr size_t length = 2;
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_ZNVC;
 
  public:
   static bool Liftx6C(const uint8_t* data, uint64_t addr, size_t& len,
@@ -1073,7 +1069,7 @@ class Subcb {
 
 class Trap {
   static constexpr size_t length = 2;
-  static uint32_t GetTarget(const uint8_t* data, uint64_t addr);
+  static uint32_t GetTarget(const uint8_t* data);
   static uint8_t GetTrap7(const uint8_t* data);
 
  public:
@@ -1086,7 +1082,7 @@ class Trap {
 };
 
 class Xor {
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_LOGIC;
 
  public:
   static bool Lift(uint8_t op, const uint8_t* data, uint64_t addr, size_t& len,
@@ -1096,7 +1092,7 @@ class Xor {
 };
 
 class Xorb {
-  static constexpr uint32_t flags = Flags::WRITE_ALL;
+  static constexpr uint32_t flags = Flags::WRITE_LOGIC;
 
  public:
   static bool Lift(uint8_t op, const uint8_t* data, uint64_t addr, size_t& len,
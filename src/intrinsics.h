@@ -0,0 +1,23 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_INTRINSICS_H_
+#define SRC_INTRINSICS_H_
+
+#include <cstdint>
+
+namespace C166::Intrinsics {
+/* System Control */
+constexpr uint8_t DISWDT = 0;
+constexpr uint8_t EINIT = 1;
+constexpr uint8_t IDLE = 2;
+constexpr uint8_t PWRDN = 3;
+constexpr uint8_t SRST = 4;
+constexpr uint8_t SRVWDT = 5;
+
+/* Interrupt Lock and Normalization */
+constexpr uint8_t ATOMIC = 6;
+constexpr uint8_t PRIOR = 7;
+}  // namespace C166::Intrinsics
+
+#endif  // SRC_INTRINSICS_H_
@@ -5,10 +5,12 @@
 #include <lowlevelilinstruction.h>
 
 #include <cstdint>
+#include <map>
 #include <vector>
 
 #include "conditions.h"
 #include "instructions.h"
+#include "intrinsics.h"
 #include "opcodes.h"
 #include "registers.h"
 #include "sfr.h"
@@ -29,6 +31,16 @@ namespace BN = BinaryNinja;
         std::forward<decltype(_3)>(_3), std::forward<decltype(_4)>(_4), \
         std::forward<decltype(_5)>(_5));                                \
   }
+// As IL_OP, for operations that also consume the carry flag (AddCarry,
+// SubBorrow)
+#define IL_CARRY_OP(m)                                                  \
+  [&il](auto &&_1, auto &&_2, auto &&_3, auto &&_4, auto &&_5) {        \
+    return il.m(                                                        \
+        std::forward<decltype(_1)>(_1), std::forward<decltype(_2)>(_2), \
+        std::forward<decltype(_3)>(_3), il.Flag(Flags::FLAG_CARRY),     \
+        std::forward<decltype(_4)>(_4),                                 \
+        std::forward<decltype(_5)>(_5));                                \
+  }
 #define NO_RETURN(length)           \
   il.AddInstruction(il.NoReturn()); \
   len = length;                     \
@@ -37,13 +49,17 @@ namespace BN = BinaryNinja;
   il.AddInstruction(il.Nop()); \
   len = length;                \
   return true
+#define INTRINSIC(id, length)                  \
+  il.AddInstruction(il.Intrinsic({}, id, {})); \
+  len = length;                                \
+  return true
 #define UNIMPLEMENTED(length)            \
   il.AddInstruction(il.Unimplemented()); \
   len = length;                          \
   return true
-#define STACK_RETURN(length)                                           \
-  il.AddInstruction(il.Return(il.Register(3, Registers::VIRTUAL_LR))); \
-  len = length;                                                        \
+#define STACK_RETURN(length, target)    \
+  il.AddInstruction(il.Return(target)); \
+  len = length;                         \
   return true
 
 namespace C166 {
@@ -70,28 +86,147 @@ static void UpdateExtSequence(const uint64_t addr, const size_t len) {
   }
 }
 
+// Return addresses, CSP and PSW are saved on the system stack (SP), which is
+// separate from the user stack that the architecture reports as its stack
+// pointer. Calls therefore leave the user stack unchanged; saying so up front
+// spares the core from inferring an adjustment at every call site.
+static void PushSystem(BN::LowLevelILFunction &il, const BN::ExprId value) {
+  il.AddInstruction(il.SetRegister(
+      2, Registers::SP,
+      il.Sub(2, il.Register(2, Registers::SP), il.Const(2, 2))));
+  il.AddInstruction(il.Store(2, il.Register(2, Registers::SP), value));
+}
+
+// Pops the top of the system stack into reg: a GPR, an IL temp, or the
+// address of an SFR (which may be register-modeled)
+static void PopSystem(BN::LowLevelILFunction &il, const uint32_t reg,
+                      const uint32_t flags = 0) {
+  const BN::ExprId top = il.Load(2, il.Register(2, Registers::SP));
+  if (reg <= 0xF || LLIL_REG_IS_TEMP(reg))
+    il.AddInstruction(il.SetRegister(2, reg, top, flags));
+  else
+    il.AddInstruction(Instruction::StoreDirect(il, 2, reg, top, flags));
+  il.AddInstruction(il.SetRegister(
+      2, Registers::SP,
+      il.Add(2, il.Register(2, Registers::SP), il.Const(2, 2))));
+}
+
+static void LiftCall(BN::LowLevelILFunction &il, const uint64_t ret,
+                     const BN::ExprId dest) {
+  PushSystem(il, il.Const(2, ret & 0xFFFF));
+  il.AddInstruction(
+      il.CallStackAdjust(dest, 0, std::map<uint32_t, int32_t>()));
+}
+
+// Return target for the IP a RET-family instruction popped into LLIL_TEMP(0).
+// Inter-segment returns have also restored CSP, which selects the segment;
+// the others return within the segment of the returning instruction.
+static BN::ExprId GetReturnAddress(BN::LowLevelILFunction &il,
+                                   const uint64_t addr,
+                                   const bool inter_segment) {
+  const BN::ExprId ip = il.ZeroExtend(3, il.Register(2, LLIL_TEMP(0)));
+  const BN::ExprId segment =
+      inter_segment
+          ? il.ShiftLeft(3, il.ZeroExtend(3, il.Register(2, Registers::CSP)),
+                         il.Const(1, 16))
+          : il.Const(3, addr & 0xFF0000);
+  return il.Or(3, segment, ip);
+}
+
+// Decodes the destination and source of a word ADD/ADDC/SUB/SUBC whose
+// operands are all GPRs or immediates. Returns the instruction length, or 0
+// for the forms that touch memory or SFRs.
+static size_t GetLongArithOperands(const uint8_t *data, uint8_t &rn,
+                                   bool &is_reg, uint16_t &src) {
+  switch (data[0] & 0xF) {
+    case 0x0:  // Rwn, Rwm
+      rn = Instruction::GetData4High(data);
+      src = Instruction::GetData4Low(data);
+      is_reg = true;
+      return 2;
+    case 0x8:  // Rwn, #data3
+      if (Formats::Get<Formats::Rr::mode>(data) >= 0b10) return 0;
+      rn = Instruction::GetData4High(data);
+      src = Instruction::GetData3(data);
+      is_reg = false;
+      return 2;
+    case 0x6:  // reg, #data16
+      rn = Formats::Get<Formats::RegData::reg>(data);
+      if (rn < 0xF0) return 0;
+      rn &= 0xF;
+      src = Instruction::GetData16(data);
+      is_reg = false;
+      return 4;
+    default:
+      return 0;
+  }
+}
+
+// Tasking lowers long addition and subtraction to ADD/ADDC (SUB/SUBC) on a
+// low/high register pair, e.g.
+//     add  r4, r6          sub  r12, #1
+//     addc r5, r7          subc r13, #0
+// Lift such pairs as a single 32-bit operation on the pair so that dataflow
+// can track the full value. The flags written match those left by the second
+// instruction, as ADDC/SUBC only keep Z set if the low word was also zero.
+static bool LiftLongArith(const uint8_t *data, const uint64_t addr,
+                          size_t &len, BN::LowLevelILFunction &il) {
+  uint8_t rn_lo, rn_hi;
+  bool reg_lo, reg_hi;
+  uint16_t src_lo, src_hi;
+
+  const size_t len_lo = GetLongArithOperands(data, rn_lo, reg_lo, src_lo);
+  if (len_lo == 0 || len < len_lo + 2) return false;
+
+  // ADD -> ADDC, SUB -> SUBC
+  const uint8_t *next = data + len_lo;
+  if ((next[0] & 0xF0) != (data[0] & 0xF0) + 0x10) return false;
+  const size_t len_hi = GetLongArithOperands(next, rn_hi, reg_hi, src_hi);
+  if (len_hi == 0 || len < len_lo + len_hi) return false;
+
+  if (rn_lo == 0xF || rn_hi != rn_lo + 1 || reg_lo != reg_hi) return false;
+  if (reg_lo && (src_lo == 0xF || src_hi != src_lo + 1)) return false;
+  // ADDC/SUBC would read the low result, e.g. add r5, r4 ; addc r6, r5
+  if (reg_lo && src_hi == rn_lo) return false;
+
+  const BN::ExprId dst = il.RegisterSplit(2, rn_hi, rn_lo);
+  const BN::ExprId src = reg_lo ? il.RegisterSplit(2, src_hi, src_lo)
+                                : il.Const(4, (src_hi << 16u) | src_lo);
+  const BN::ExprId result = ((data[0] & 0xF0) == 0x20)
+                                ? il.Sub(4, dst, src, Flags::WRITE_ALL)
+                                : il.Add(4, dst, src, Flags::WRITE_ALL);
+  il.AddInstruction(il.SetRegisterSplit(2, rn_hi, rn_lo, result));
+
+  UpdateExtSequence(addr, len_lo);
+  UpdateExtSequence(addr + len_lo, len_hi);
+  len = len_lo + len_hi;
+  return true;
+}
+
 bool Add::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
                size_t &len, BN::LowLevelILFunction &il) {
+  if (LiftLongArith(data, addr, len, il)) return true;
+
   switch (op) {
     case Opcodes::ADD_RWN_RWM:
       len = 2;
-      return Instruction::LiftOpRnRm(data, len, 2, flags, true, il,
+      return Instruction::LiftOpRnRm(data, 2, flags, true, il,
                                      IL_OP(BN::LowLevelILFunction::Add));
     case Opcodes::ADD_RWN_RWI_DATA3:
       len = 2;
-      return Instruction::LiftOpRnRwiData3(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpRnRwiData3(addr, data, 2, flags, true, il,
                                            IL_OP(BN::LowLevelILFunction::Add));
     case Opcodes::ADD_REG_DATA16:
       len = 4;
-      return Instruction::LiftOpRegData(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpRegData(addr, data, 2, flags, true, il,
                                         IL_OP(BN::LowLevelILFunction::Add));
     case Opcodes::ADD_REG_MEM:
       len = 4;
-      return Instruction::LiftOpRegMem(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpRegMem(addr, data, 2, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::Add));
     case Opcodes::ADD_MEM_REG:
       len = 4;
-      return Instruction::LiftOpMemReg(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpMemReg(addr, data, 2, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::Add));
     default:
       BN::LogError("0x%lx: Add::%s received invalid opcode: 0x%x", addr,
@@ -105,23 +240,23 @@ bool Addb::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
   switch (op) {
     case Opcodes::ADDB_RBN_RBM:
       len = 2;
-      return Instruction::LiftOpRnRm(data, len, 1, flags, true, il,
+      return Instruction::LiftOpRnRm(data, 1, flags, true, il,
                                      IL_OP(BN::LowLevelILFunction::Add));
     case Opcodes::ADDB_RBN_RWI_DATA3:
       len = 2;
-      return Instruction::LiftOpRnRwiData3(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpRnRwiData3(addr, data, 1, flags, true, il,
                                            IL_OP(BN::LowLevelILFunction::Add));
     case Opcodes::ADDB_REG_DATA8:
       len = 4;
-      return Instruction::LiftOpRegData(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpRegData(addr, data, 1, flags, true, il,
                                         IL_OP(BN::LowLevelILFunction::Add));
     case Opcodes::ADDB_REG_MEM:
       len = 4;
-      return Instruction::LiftOpRegMem(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpRegMem(addr, data, 1, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::Add));
     case Opcodes::ADDB_MEM_REG:
       len = 4;
-      return Instruction::LiftOpMemReg(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpMemReg(addr, data, 1, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::Add));
     default:
       BN::LogError("0x%lx: Add::%s received invalid opcode: 0x%x", addr,
@@ -132,28 +267,27 @@ bool Addb::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
 
 bool Addc::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
                 size_t &len, BN::LowLevelILFunction &il) {
-  // TODO: Handle carry
   switch (op) {
     case Opcodes::ADDC_RWN_RWM:
       len = 2;
-      return Instruction::LiftOpRnRm(data, len, 2, flags, true, il,
-                                     IL_OP(BN::LowLevelILFunction::Add));
+      return Instruction::LiftOpRnRm(data, 2, flags, true, il,
+                                     IL_CARRY_OP(AddCarry));
     case Opcodes::ADDC_RWN_RWI_DATA3:
       len = 2;
-      return Instruction::LiftOpRnRwiData3(addr, data, len, 2, flags, true, il,
-                                           IL_OP(BN::LowLevelILFunction::Add));
+      return Instruction::LiftOpRnRwiData3(addr, data, 2, flags, true, il,
+                                           IL_CARRY_OP(AddCarry));
     case Opcodes::ADDC_REG_DATA16:
       len = 4;
-      return Instruction::LiftOpRegData(addr, data, len, 2, flags, true, il,
-                                        IL_OP(BN::LowLevelILFunction::Add));
+      return Instruction::LiftOpRegData(addr, data, 2, flags, true, il,
+                                        IL_CARRY_OP(AddCarry));
     case Opcodes::ADDC_REG_MEM:
       len = 4;
-      return Instruction::LiftOpRegMem(addr, data, len, 2, flags, true, il,
-                                       IL_OP(BN::LowLevelILFunction::Add));
+      return Instruction::LiftOpRegMem(addr, data, 2, flags, true, il,
+                                       IL_CARRY_OP(AddCarry));
     case Opcodes::ADDC_MEM_REG:
       len = 4;
-      return Instruction::LiftOpMemReg(addr, data, len, 2, flags, true, il,
-                                       IL_OP(BN::LowLevelILFunction::Add));
+      return Instruction::LiftOpMemReg(addr, data, 2, flags, true, il,
+                                       IL_CARRY_OP(AddCarry));
     default:
       BN::LogError("0x%lx: Addc::%s received invalid opcode: 0x%x", addr,
                    __func__, op);
@@ -166,24 +300,24 @@ bool Addcb::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
   switch (op) {
     case Opcodes::ADDCB_RBN_RBM:
       len = 2;
-      return Instruction::LiftOpRnRm(data, len, 1, flags, true, il,
-                                     IL_OP(BN::LowLevelILFunction::Add));
+      return Instruction::LiftOpRnRm(data, 1, flags, true, il,
+                                     IL_CARRY_OP(AddCarry));
     case Opcodes::ADDCB_RBN_RWI_DATA3:
       len = 2;
-      return Instruction::LiftOpRnRwiData3(addr, data, len, 1, flags, true, il,
-                                           IL_OP(BN::LowLevelILFunction::Add));
+      return Instruction::LiftOpRnRwiData3(addr, data, 1, flags, true, il,
+                                           IL_CARRY_OP(AddCarry));
     case Opcodes::ADDCB_REG_DATA8:
       len = 4;
-      return Instruction::LiftOpRegData(addr, data, len, 1, flags, true, il,
-                                        IL_OP(BN::LowLevelILFunction::Add));
+      return Instruction::LiftOpRegData(addr, data, 1, flags, true, il,
+                                        IL_CARRY_OP(AddCarry));
     case Opcodes::ADDCB_REG_MEM:
       len = 4;
-      return Instruction::LiftOpRegMem(addr, data, len, 1, flags, true, il,
-                                       IL_OP(BN::LowLevelILFunction::Add));
+      return Instruction::LiftOpRegMem(addr, data, 1, flags, true, il,
+                                       IL_CARRY_OP(AddCarry));
     case Opcodes::ADDCB_MEM_REG:
       len = 4;
-      return Instruction::LiftOpMemReg(addr, data, len, 1, flags, true, il,
-                                       IL_OP(BN::LowLevelILFunction::Add));
+      return Instruction::LiftOpMemReg(addr, data, 1, flags, true, il,
+                                       IL_CARRY_OP(AddCarry));
     default:
       BN::LogError("0x%lx: Addcb::%s received invalid opcode: 0x%x", addr,
                    __func__, op);
@@ -196,23 +330,23 @@ bool And::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
   switch (op) {
     case Opcodes::AND_RWN_RWM:
       len = 2;
-      return Instruction::LiftOpRnRm(data, len, 2, flags, true, il,
+      return Instruction::LiftOpRnRm(data, 2, flags, true, il,
                                      IL_OP(BN::LowLevelILFunction::And));
     case Opcodes::AND_RWN_RWI_DATA3:
       len = 2;
-      return Instruction::LiftOpRnRwiData3(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpRnRwiData3(addr, data, 2, flags, true, il,
                                            IL_OP(BN::LowLevelILFunction::And));
     case Opcodes::AND_REG_DATA16:
       len = 4;
-      return Instruction::LiftOpRegData(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpRegData(addr, data, 2, flags, true, il,
                                         IL_OP(BN::LowLevelILFunction::And));
     case Opcodes::AND_REG_MEM:
       len = 4;
-      return Instruction::LiftOpRegMem(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpRegMem(addr, data, 2, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::And));
     case Opcodes::AND_MEM_REG:
       len = 4;
-      return Instruction::LiftOpMemReg(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpMemReg(addr, data, 2, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::And));
     default:
       BN::LogError("0x%lx: And::%s received invalid opcode: 0x%x", addr,
@@ -226,23 +360,23 @@ bool Andb::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
   switch (op) {
     case Opcodes::ANDB_RBN_RBM:
       len = 2;
-      return Instruction::LiftOpRnRm(data, len, 1, flags, true, il,
+      return Instruction::LiftOpRnRm(data, 1, flags, true, il,
                                      IL_OP(BN::LowLevelILFunction::And));
     case Opcodes::ANDB_RBN_RWI_DATA3:
       len = 2;
-      return Instruction::LiftOpRnRwiData3(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpRnRwiData3(addr, data, 1, flags, true, il,
                                            IL_OP(BN::LowLevelILFunction::And));
     case Opcodes::ANDB_REG_DATA8:
       len = 4;
-      return Instruction::LiftOpRegData(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpRegData(addr, data, 1, flags, true, il,
                                         IL_OP(BN::LowLevelILFunction::And));
     case Opcodes::ANDB_REG_MEM:
       len = 4;
-      return Instruction::LiftOpRegMem(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpRegMem(addr, data, 1, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::And));
     case Opcodes::ANDB_MEM_REG:
       len = 4;
-      return Instruction::LiftOpMemReg(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpMemReg(addr, data, 1, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::And));
     default:
       BN::LogError("0x%lx: Andb::%s received invalid opcode: 0x%x", addr,
@@ -253,11 +387,12 @@ bool Andb::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
 
 bool Ashr::LiftxAC(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, length);
-  const auto rwm = Instruction::GetData4Low(data, length);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   il.AddInstruction(il.SetRegister(
-      2, rwn, il.ArithShiftRight(2, il.Register(2, rwn), il.Register(2, rwm)),
+      2, rwn, il.ArithShiftRight(2, il.Register(2, rwn),
+                     il.And(2, il.Register(2, rwm), il.Const(2, 0xF))),
       flags));
 
   len = length;
@@ -268,8 +403,8 @@ bool Ashr::LiftxAC(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Ashr::LiftxBC(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4Low(data, length);
-  const auto data4 = Instruction::GetData4High(data, length);
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto data4 = Instruction::GetData4High(data);
 
   il.AddInstruction(il.SetRegister(
       2, rwn, il.ArithShiftRight(2, il.Register(2, rwn), il.Const(1, data4)),
@@ -281,46 +416,48 @@ bool Ashr::LiftxBC(const uint8_t *data, const uint64_t addr, size_t &len,
   return true;
 }
 
-bool Band::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
-                BN::LowLevelILFunction &il) {
-  const uint32_t qaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  const uint32_t zaddr = Instruction::TranslateBitOff(addr, *(data + 2));
-  const uint8_t qpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
-  const uint8_t zpos = *(data + 3) & 0xFu;
-
-  BN::ExprId qq, zz;
-
-  if (zaddr <= 0xF) {
-    zz = il.Register(2, zaddr);
-  } else {
-    zz = il.Load(2, il.ConstPointer(3, zaddr));
-  }
-
-  if (qaddr <= 0xF) {
-    qq = il.Register(2, qaddr);
-  } else {
-    qq = il.Load(2, il.ConstPointer(3, qaddr));
-  }
-
-  BN::ExprId zz_bit = il.LogicalShiftRight(2, zz, il.Const(2, zpos));
-  zz_bit = il.And(2, zz_bit, il.Const(2, 1));
-
-  BN::ExprId qq_bit = il.LogicalShiftRight(2, qq, il.Const(2, qpos));
-  qq_bit = il.And(2, qq_bit, il.Const(2, 1));
-
-  BN::ExprId res_bit =
-      il.ShiftLeft(2, il.And(2, qq_bit, zz_bit), il.Const(2, zpos));
-  BN::ExprId res_masked = il.And(2, zz, il.Const(2, ~(0b1u << zpos)));
-  BN::ExprId result = il.Or(2, res_bit, res_masked);
+// Flags of BSET/BCLR: Z and N reflect the previous state of the bit
+static void SetBitFlags(BN::LowLevelILFunction &il, const BN::ExprId bit) {
+  il.AddInstruction(il.SetFlag(Flags::FLAG_E, il.Const(0, 0)));
+  il.AddInstruction(il.SetFlag(Flags::FLAG_ZERO,
+                               il.CompareEqual(2, bit, il.Const(2, 0))));
+  il.AddInstruction(il.SetFlag(Flags::FLAG_OVERFLOW, il.Const(0, 0)));
+  il.AddInstruction(il.SetFlag(Flags::FLAG_CARRY, il.Const(0, 0)));
+  il.AddInstruction(il.SetFlag(Flags::FLAG_NEGATIVE, bit));
+}
 
-  BN::ExprId instr;
-  if (zaddr <= 0xF) {
-    instr = il.SetRegister(2, zaddr, result, flags);
-  } else {
-    instr = il.Store(2, il.ConstPointer(3, zaddr), result, flags);
-  }
+// Flags of the bit-bit instructions (BAND, BCMP, BMOV, BMOVN, BOR, BXOR),
+// taken from the previous state of both bits whatever the operation
+static void SetBitBitFlags(BN::LowLevelILFunction &il, const BN::ExprId zz,
+                           const BN::ExprId qq) {
+  il.AddInstruction(il.SetFlag(Flags::FLAG_E, il.Const(0, 0)));
+  il.AddInstruction(il.SetFlag(
+      Flags::FLAG_ZERO,
+      il.CompareEqual(2, il.Or(2, zz, qq), il.Const(2, 0))));
+  il.AddInstruction(il.SetFlag(Flags::FLAG_OVERFLOW, il.Or(2, zz, qq)));
+  il.AddInstruction(il.SetFlag(Flags::FLAG_CARRY, il.And(2, zz, qq)));
+  il.AddInstruction(il.SetFlag(Flags::FLAG_NEGATIVE, il.Xor(2, zz, qq)));
+}
 
-  il.AddInstruction(instr);
+bool Band::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
+                BN::LowLevelILFunction &il) {
+  const uint32_t qaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::qq>(data));
+  const uint32_t zaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::zz>(data));
+  const uint8_t qpos = Formats::Get<Formats::BitBit::q>(data);
+  const uint8_t zpos = Formats::Get<Formats::BitBit::z>(data);
+
+  // z.zpos &= q.qpos (clear z.zpos unless q.qpos is set)
+  const BN::ExprId zz = Instruction::GetBitWord(il, zaddr);
+  const BN::ExprId qq_bit = Instruction::GetBit(il, qaddr, qpos);
+  const BN::ExprId result =
+      il.And(2, zz,
+             il.Or(2, il.Const(2, 0xFFFFu & ~(0b1u << zpos)),
+                   il.ShiftLeft(2, qq_bit, il.Const(1, zpos))));
+
+  SetBitBitFlags(il, Instruction::GetBit(il, zaddr, zpos), qq_bit);
+  il.AddInstruction(Instruction::SetBitWord(il, zaddr, result));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -330,19 +467,15 @@ bool Band::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Bclr::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                 BN::LowLevelILFunction &il) {
-  uint8_t bitpos = Instruction::GetBitPosition(data, length);
-  uint32_t bitaddr = Instruction::TranslateBitOff(addr, *(data + 1));
+  uint8_t bitpos = Instruction::GetBitPosition(data);
+  uint32_t bitaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitShort::bitoff>(data));
 
-  if (bitaddr <= 0xF) {
-    il.AddInstruction(il.SetRegister(
-        2, bitaddr,
-        il.And(2, il.Register(2, bitaddr), il.Const(2, ~(0b1u << bitpos)))));
-  } else {
-    il.AddInstruction(
-        il.Store(2, il.ConstPointer(3, bitaddr),
-                 il.And(2, il.Load(2, il.ConstPointer(3, bitaddr)),
-                        il.Const(2, ~(0b1u << bitpos)))));
-  }
+  SetBitFlags(il, Instruction::GetBit(il, bitaddr, bitpos));
+  il.AddInstruction(Instruction::SetBitWord(
+      il, bitaddr,
+      il.And(2, Instruction::GetBitWord(il, bitaddr),
+             il.Const(2, 0xFFFFu & ~(0b1u << bitpos)))));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -352,46 +485,15 @@ bool Bclr::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Bcmp::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                 BN::LowLevelILFunction &il) {
-  const uint32_t qaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  const uint32_t zaddr = Instruction::TranslateBitOff(addr, *(data + 2));
-  const uint8_t qpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
-  const uint8_t zpos = *(data + 3) & 0xFu;
-
-  BN::ExprId qq, zz;
-
-  if (zaddr <= 0xF) {
-    zz = il.Register(2, zaddr);
-    if (qaddr <= 0xF) {  // reg <- reg
-      qq = il.Register(2, qaddr);
-    } else {  // reg <- mem
-      qq = il.Load(2, il.ConstPointer(3, qaddr));
-    }
-
-    qq = il.LogicalShiftRight(2, qq, il.Const(2, qpos));
-    qq = il.And(2, qq, il.Const(2, 0x0001));
-
-    zz = il.LogicalShiftRight(2, zz, il.Const(2, zpos));
-    zz = il.And(2, zz, il.Const(2, 0x0001));
-  } else {
-    zz = il.Load(2, il.ConstPointer(3, zaddr));
-    if (qaddr <= 0xF) {  // mem <- reg
-      qq = il.Register(2, qaddr);
-    } else {  // mem <- mem
-      qq = il.Load(2, il.ConstPointer(3, qaddr));
-    }
-
-    qq = il.LogicalShiftRight(2, qq, il.Const(2, qpos));
-    qq = il.And(2, qq, il.Const(2, 0x0001));
-
-    zz = il.LogicalShiftRight(2, zz, il.Const(2, zpos));
-    zz = il.And(2, zz, il.Const(2, 0x0001));
-  }
+  const uint32_t qaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::qq>(data));
+  const uint32_t zaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::zz>(data));
+  const uint8_t qpos = Formats::Get<Formats::BitBit::q>(data);
+  const uint8_t zpos = Formats::Get<Formats::BitBit::z>(data);
 
-  il.AddInstruction(il.SetFlag(Flags::FLAG_E, il.Const(2, 0)));
-  il.AddInstruction(il.SetFlag(Flags::FLAG_ZERO, il.Not(2, il.Or(2, qq, zz))));
-  il.AddInstruction(il.SetFlag(Flags::FLAG_OVERFLOW, il.Or(2, qq, zz)));
-  il.AddInstruction(il.SetFlag(Flags::FLAG_CARRY, il.And(2, qq, zz)));
-  il.AddInstruction(il.SetFlag(Flags::FLAG_NEGATIVE, il.Xor(2, qq, zz)));
+  SetBitBitFlags(il, Instruction::GetBit(il, zaddr, zpos),
+                 Instruction::GetBit(il, qaddr, qpos));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -400,18 +502,20 @@ bool Bcmp::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 }
 
 bool Bfldh::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
-                 BN::LowLevelILFunction &il) {  // TODO: Fully implement
-  char buf[32];
-  uint32_t bitoff = Instruction::TranslateBitOff(addr, *(data + 1));
-  uint8_t data8 = *(data + 2);
-  uint8_t mask8 = *(data + 3);
-
-  if (bitoff < 0xF) {
-    il.Unimplemented();  // TODO: Reference byte register (+17)
-  } else {
-    il.UnimplementedMemoryRef(
-        1, il.ConstPointer(3, bitoff + 1));  // TODO: Verify offset
-  }
+                 BN::LowLevelILFunction &il) {
+  const uint32_t bitoff = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitFieldHigh::bitoff>(data));
+  const uint16_t data8 = Formats::Get<Formats::BitFieldHigh::data8>(data);
+  const uint16_t mask8 = Formats::Get<Formats::BitFieldHigh::mask8>(data);
+
+  // bitoff.high = (bitoff.high & ~mask8) | (data8 & mask8)
+  il.AddInstruction(Instruction::SetBitWord(
+      il, bitoff,
+      il.Or(2,
+            il.And(2, Instruction::GetBitWord(il, bitoff),
+                   il.Const(2, 0xFFFFu & ~(mask8 << 8u))),
+            il.Const(2, (data8 & mask8) << 8u)),
+      flags));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -420,18 +524,20 @@ bool Bfldh::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 }
 
 bool Bfldl::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
-                 BN::LowLevelILFunction &il) {  // TODO: Fully implement
-  char buf[32];
-  uint32_t bitoff = Instruction::TranslateBitOff(addr, *(data + 1));
-  uint8_t mask8 = *(data + 2);
-  uint8_t data8 = *(data + 3);
-
-  if (bitoff < 0xF) {
-    il.Unimplemented();  // TODO: Reference byte register (+16)
-  } else {
-    il.UnimplementedMemoryRef(
-        1, il.ConstPointer(3, bitoff));  // TODO: Verify (non-)offset
-  }
+                 BN::LowLevelILFunction &il) {
+  const uint32_t bitoff = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitFieldLow::bitoff>(data));
+  const uint16_t mask8 = Formats::Get<Formats::BitFieldLow::mask8>(data);
+  const uint16_t data8 = Formats::Get<Formats::BitFieldLow::data8>(data);
+
+  // bitoff.low = (bitoff.low & ~mask8) | (data8 & mask8)
+  il.AddInstruction(Instruction::SetBitWord(
+      il, bitoff,
+      il.Or(2,
+            il.And(2, Instruction::GetBitWord(il, bitoff),
+                   il.Const(2, 0xFFFFu & ~mask8)),
+            il.Const(2, data8 & mask8)),
+      flags));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -441,40 +547,22 @@ bool Bfldl::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Bmov::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                 BN::LowLevelILFunction &il) {
-  const uint32_t qaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  const uint32_t zaddr = Instruction::TranslateBitOff(addr, *(data + 2));
-  const uint8_t qpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
-  const uint8_t zpos = *(data + 3) & 0xFu;
-
-  BN::ExprId qq, zz;
-
-  if (zaddr <= 0xF) {
-    zz = il.Register(2, zaddr);
-  } else {
-    zz = il.Load(2, il.ConstPointer(3, zaddr));
-  }
-
-  if (qaddr <= 0xF) {
-    qq = il.Register(2, qaddr);
-  } else {
-    qq = il.Load(2, il.ConstPointer(3, qaddr));
-  }
-
-  BN::ExprId qq_bit = il.LogicalShiftRight(2, qq, il.Const(2, qpos));
-  qq_bit = il.And(2, qq_bit, il.Const(2, 1));
-
-  BN::ExprId res_bit = il.ShiftLeft(2, qq_bit, il.Const(2, zpos));
-  BN::ExprId res_masked = il.And(2, zz, il.Const(2, ~(0b1u << zpos)));
-  BN::ExprId result = il.Or(2, res_bit, res_masked);
-
-  BN::ExprId instr;
-  if (zaddr <= 0xF) {
-    instr = il.SetRegister(2, zaddr, result, flags);
-  } else {
-    instr = il.Store(2, il.ConstPointer(3, zaddr), result, flags);
-  }
-
-  il.AddInstruction(instr);
+  const uint32_t qaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::qq>(data));
+  const uint32_t zaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::zz>(data));
+  const uint8_t qpos = Formats::Get<Formats::BitBit::q>(data);
+  const uint8_t zpos = Formats::Get<Formats::BitBit::z>(data);
+
+  // z.zpos = q.qpos
+  const BN::ExprId zz = Instruction::GetBitWord(il, zaddr);
+  const BN::ExprId qq_bit = Instruction::GetBit(il, qaddr, qpos);
+  const BN::ExprId result =
+      il.Or(2, il.And(2, zz, il.Const(2, 0xFFFFu & ~(0b1u << zpos))),
+            il.ShiftLeft(2, qq_bit, il.Const(1, zpos)));
+
+  SetBitBitFlags(il, Instruction::GetBit(il, zaddr, zpos), qq_bit);
+  il.AddInstruction(Instruction::SetBitWord(il, zaddr, result));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -484,40 +572,23 @@ bool Bmov::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Bmovn::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                  BN::LowLevelILFunction &il) {
-  const uint32_t qaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  const uint32_t zaddr = Instruction::TranslateBitOff(addr, *(data + 2));
-  const uint8_t qpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
-  const uint8_t zpos = *(data + 3) & 0xFu;
-
-  BN::ExprId qq, zz;
-
-  if (zaddr <= 0xF) {
-    zz = il.Register(2, zaddr);
-  } else {
-    zz = il.Load(2, il.ConstPointer(3, zaddr));
-  }
-
-  if (qaddr <= 0xF) {
-    qq = il.Register(2, qaddr);
-  } else {
-    qq = il.Load(2, il.ConstPointer(3, qaddr));
-  }
-
-  BN::ExprId qq_bit = il.Not(2, il.LogicalShiftRight(2, qq, il.Const(2, qpos)));
-  qq_bit = il.And(2, qq_bit, il.Const(2, 1));
-
-  BN::ExprId res_bit = il.ShiftLeft(2, qq_bit, il.Const(2, zpos));
-  BN::ExprId res_masked = il.And(2, zz, il.Const(2, ~(0b1u << zpos)));
-  BN::ExprId result = il.Or(2, res_bit, res_masked);
-
-  BN::ExprId instr;
-  if (zaddr <= 0xF) {
-    instr = il.SetRegister(2, zaddr, result, flags);
-  } else {
-    instr = il.Store(2, il.ConstPointer(3, zaddr), result, flags);
-  }
-
-  il.AddInstruction(instr);
+  const uint32_t qaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::qq>(data));
+  const uint32_t zaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::zz>(data));
+  const uint8_t qpos = Formats::Get<Formats::BitBit::q>(data);
+  const uint8_t zpos = Formats::Get<Formats::BitBit::z>(data);
+
+  // z.zpos = !q.qpos
+  const BN::ExprId zz = Instruction::GetBitWord(il, zaddr);
+  const BN::ExprId qq_bit = Instruction::GetBit(il, qaddr, qpos);
+  const BN::ExprId result =
+      il.Or(2, il.And(2, zz, il.Const(2, 0xFFFFu & ~(0b1u << zpos))),
+            il.ShiftLeft(2, il.Xor(2, qq_bit, il.Const(2, 1)),
+                         il.Const(1, zpos)));
+
+  SetBitBitFlags(il, Instruction::GetBit(il, zaddr, zpos), qq_bit);
+  il.AddInstruction(Instruction::SetBitWord(il, zaddr, result));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -527,44 +598,21 @@ bool Bmovn::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Bor::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                BN::LowLevelILFunction &il) {
-  const uint32_t qaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  const uint32_t zaddr = Instruction::TranslateBitOff(addr, *(data + 2));
-  const uint8_t qpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
-  const uint8_t zpos = *(data + 3) & 0xFu;
-
-  BN::ExprId qq, zz;
-
-  if (zaddr <= 0xF) {
-    zz = il.Register(2, zaddr);
-  } else {
-    zz = il.Load(2, il.ConstPointer(3, zaddr));
-  }
-
-  if (qaddr <= 0xF) {
-    qq = il.Register(2, qaddr);
-  } else {
-    qq = il.Load(2, il.ConstPointer(3, qaddr));
-  }
-
-  BN::ExprId zz_bit = il.LogicalShiftRight(2, zz, il.Const(2, zpos));
-  zz_bit = il.And(2, zz_bit, il.Const(2, 1));
-
-  BN::ExprId qq_bit = il.LogicalShiftRight(2, qq, il.Const(2, qpos));
-  qq_bit = il.And(2, qq_bit, il.Const(2, 1));
-
-  BN::ExprId res_bit =
-      il.ShiftLeft(2, il.Or(2, qq_bit, zz_bit), il.Const(2, zpos));
-  BN::ExprId res_masked = il.And(2, zz, il.Const(2, ~(0b1u << zpos)));
-  BN::ExprId result = il.Or(2, res_bit, res_masked);
-
-  BN::ExprId instr;
-  if (zaddr <= 0xF) {
-    instr = il.SetRegister(2, zaddr, result, flags);
-  } else {
-    instr = il.Store(2, il.ConstPointer(3, zaddr), result, flags);
-  }
-
-  il.AddInstruction(instr);
+  const uint32_t qaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::qq>(data));
+  const uint32_t zaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::zz>(data));
+  const uint8_t qpos = Formats::Get<Formats::BitBit::q>(data);
+  const uint8_t zpos = Formats::Get<Formats::BitBit::z>(data);
+
+  // z.zpos |= q.qpos
+  const BN::ExprId zz = Instruction::GetBitWord(il, zaddr);
+  const BN::ExprId qq_bit = Instruction::GetBit(il, qaddr, qpos);
+  const BN::ExprId result =
+      il.Or(2, zz, il.ShiftLeft(2, qq_bit, il.Const(1, zpos)));
+
+  SetBitBitFlags(il, Instruction::GetBit(il, zaddr, zpos), qq_bit);
+  il.AddInstruction(Instruction::SetBitWord(il, zaddr, result));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -574,44 +622,21 @@ bool Bor::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Bxor::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                 BN::LowLevelILFunction &il) {
-  const uint32_t qaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  const uint32_t zaddr = Instruction::TranslateBitOff(addr, *(data + 2));
-  const uint8_t qpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
-  const uint8_t zpos = *(data + 3) & 0xFu;
-
-  BN::ExprId qq, zz;
-
-  if (zaddr <= 0xF) {
-    zz = il.Register(2, zaddr);
-  } else {
-    zz = il.Load(2, il.ConstPointer(3, zaddr));
-  }
-
-  if (qaddr <= 0xF) {
-    qq = il.Register(2, qaddr);
-  } else {
-    qq = il.Load(2, il.ConstPointer(3, qaddr));
-  }
-
-  BN::ExprId zz_bit = il.LogicalShiftRight(2, zz, il.Const(2, zpos));
-  zz_bit = il.And(2, zz_bit, il.Const(2, 1));
-
-  BN::ExprId qq_bit = il.LogicalShiftRight(2, qq, il.Const(2, qpos));
-  qq_bit = il.And(2, qq_bit, il.Const(2, 1));
-
-  BN::ExprId res_bit =
-      il.ShiftLeft(2, il.Xor(2, qq_bit, zz_bit), il.Const(2, zpos));
-  BN::ExprId res_masked = il.And(2, zz, il.Const(2, ~(0b1u << zpos)));
-  BN::ExprId result = il.Or(2, res_bit, res_masked);
-
-  BN::ExprId instr;
-  if (zaddr <= 0xF) {
-    instr = il.SetRegister(2, zaddr, result, flags);
-  } else {
-    instr = il.Store(2, il.ConstPointer(3, zaddr), result, flags);
-  }
-
-  il.AddInstruction(instr);
+  const uint32_t qaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::qq>(data));
+  const uint32_t zaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::zz>(data));
+  const uint8_t qpos = Formats::Get<Formats::BitBit::q>(data);
+  const uint8_t zpos = Formats::Get<Formats::BitBit::z>(data);
+
+  // z.zpos ^= q.qpos
+  const BN::ExprId zz = Instruction::GetBitWord(il, zaddr);
+  const BN::ExprId qq_bit = Instruction::GetBit(il, qaddr, qpos);
+  const BN::ExprId result =
+      il.Xor(2, zz, il.ShiftLeft(2, qq_bit, il.Const(1, zpos)));
+
+  SetBitBitFlags(il, Instruction::GetBit(il, zaddr, zpos), qq_bit);
+  il.AddInstruction(Instruction::SetBitWord(il, zaddr, result));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -621,18 +646,15 @@ bool Bxor::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Bset::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                 BN::LowLevelILFunction &il) {
-  uint8_t bitpos = Instruction::GetBitPosition(data, length);
-  uint32_t bitaddr = Instruction::TranslateBitOff(addr, *(data + 1));
+  uint8_t bitpos = Instruction::GetBitPosition(data);
+  uint32_t bitaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitShort::bitoff>(data));
 
-  if (bitaddr <= 0xF) {
-    il.AddInstruction(il.SetRegister(
-        2, bitaddr,
-        il.Or(2, il.Register(2, bitaddr), il.Const(2, 0b1u << bitpos))));
-  } else {
-    il.AddInstruction(il.Store(2, il.ConstPointer(3, bitaddr),
-                               il.Or(2, il.Load(2, il.ConstPointer(3, bitaddr)),
-                                     il.Const(2, 0b1u << bitpos))));
-  }
+  SetBitFlags(il, Instruction::GetBit(il, bitaddr, bitpos));
+  il.AddInstruction(Instruction::SetBitWord(
+      il, bitaddr,
+      il.Or(2, Instruction::GetBitWord(il, bitaddr),
+            il.Const(2, 0b1u << bitpos))));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -642,24 +664,19 @@ bool Bset::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Calla::Lift(BN::Architecture *arch, const uint8_t *data,
                  const uint64_t addr, size_t &len, BN::LowLevelILFunction &il) {
-  const auto code = GetConditionCode(data, length);
-  const auto target = GetTarget(data, addr, length);
+  const auto code = GetConditionCode(data);
+  const auto target = GetTarget(data, addr);
 
   if (code == Conditions::CC_UC) {
-    il.AddInstruction(
-        il.Call(il.ConstPointer(3, GetTarget(data, addr, length))));
+    LiftCall(il, addr + length, il.ConstPointer(3, target));
   } else {
-    BN::ExprId condition =
-        il.FlagCondition(Instruction::GetFlagCondition(code));
-    BNLowLevelILLabel *t = il.GetLabelForAddress(arch, target);
-    BNLowLevelILLabel *f = il.GetLabelForAddress(arch, addr + length);
-
-    if (!t || !f) {  // This should never happen!
-      BN::LogDebug("0x%lx: Calla::%s Failed to find true/false labels!", addr,
-                   __func__);
-      return false;
-    }
-    il.AddInstruction(il.If(condition, *t, *f));
+    // Guard a real call so the callee stays a separate function and execution
+    // falls through to the next instruction on either path
+    BN::LowLevelILLabel call, skip;
+    il.AddInstruction(il.If(Instruction::GetCondition(il, code), call, skip));
+    il.MarkLabel(call);
+    LiftCall(il, addr + length, il.ConstPointer(3, target));
+    il.MarkLabel(skip);
   }
 
   len = length;
@@ -670,13 +687,17 @@ bool Calla::Lift(BN::Architecture *arch, const uint8_t *data,
 
 bool Calli::Lift(BN::Architecture *arch, const uint8_t *data,
                  const uint64_t addr, size_t &len, BN::LowLevelILFunction &il) {
-  const auto code = GetConditionCode(data, length);
-  const auto rwn = Instruction::GetData4Low(data, length);
+  const auto code = GetConditionCode(data);
+  const auto rwn = Instruction::GetData4Low(data);
 
   if (code == Conditions::CC_UC) {
-    il.AddInstruction(il.Call(il.Register(2, rwn)));
+    LiftCall(il, addr + length, il.Register(2, rwn));
   } else {
-    BN::LogDebug("[L] 0x%lx: Unhandled Calli variant", addr);
+    BN::LowLevelILLabel call, skip;
+    il.AddInstruction(il.If(Instruction::GetCondition(il, code), call, skip));
+    il.MarkLabel(call);
+    LiftCall(il, addr + length, il.Register(2, rwn));
+    il.MarkLabel(skip);
   }
 
   len = length;
@@ -687,7 +708,7 @@ bool Calli::Lift(BN::Architecture *arch, const uint8_t *data,
 
 bool Callr::Lift(BN::Architecture *arch, const uint8_t *data,
                  const uint64_t addr, size_t &len, BN::LowLevelILFunction &il) {
-  il.AddInstruction(il.Call(il.ConstPointer(3, GetTarget(data, addr, length))));
+  LiftCall(il, addr + length, il.ConstPointer(3, GetTarget(data, addr)));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -697,7 +718,12 @@ bool Callr::Lift(BN::Architecture *arch, const uint8_t *data,
 
 bool Calls::Lift(BN::Architecture *arch, const uint8_t *data,
                  const uint64_t addr, size_t &len, BN::LowLevelILFunction &il) {
-  il.AddInstruction(il.Call(il.ConstPointer(3, GetTarget(data, length))));
+  const auto target = GetTarget(data);
+
+  PushSystem(il, il.Register(2, Registers::CSP));
+  il.AddInstruction(
+      il.SetRegister(2, Registers::CSP, il.Const(2, target >> 16)));
+  LiftCall(il, addr + length, il.ConstPointer(3, target));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -711,22 +737,22 @@ bool Cmp::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
     case Opcodes::CMP_RWN_RWM:
       len = 2;
       UpdateExtSequence(addr, len);
-      return Instruction::LiftOpRnRm(data, len, 2, flags, false, il,
+      return Instruction::LiftOpRnRm(data, 2, flags, false, il,
                                      IL_OP(BN::LowLevelILFunction::Sub));
     case Opcodes::CMP_RWN_RWI_DATA3:
       len = 2;
       UpdateExtSequence(addr, len);
-      return Instruction::LiftOpRnRwiData3(addr, data, len, 2, flags, false, il,
+      return Instruction::LiftOpRnRwiData3(addr, data, 2, flags, false, il,
                                            IL_OP(BN::LowLevelILFunction::Sub));
     case Opcodes::CMP_REG_DATA16:
       len = 4;
       UpdateExtSequence(addr, len);
-      return Instruction::LiftOpRegData(addr, data, len, 2, flags, false, il,
+      return Instruction::LiftOpRegData(addr, data, 2, flags, false, il,
                                         IL_OP(BN::LowLevelILFunction::Sub));
     case Opcodes::CMP_REG_MEM:
       len = 4;
       UpdateExtSequence(addr, len);
-      return Instruction::LiftOpRegMem(addr, data, len, 2, flags, false, il,
+      return Instruction::LiftOpRegMem(addr, data, 2, flags, false, il,
                                        IL_OP(BN::LowLevelILFunction::Sub));
     default:
       BN::LogError("0x%lx: Cmp::%s received invalid opcode: 0x%x", addr,
@@ -741,22 +767,22 @@ bool Cmpb::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
     case Opcodes::CMPB_RBN_RBM:
       len = 2;
       UpdateExtSequence(addr, len);
-      return Instruction::LiftOpRnRm(data, len, 1, flags, false, il,
+      return Instruction::LiftOpRnRm(data, 1, flags, false, il,
                                      IL_OP(BN::LowLevelILFunction::Sub));
     case Opcodes::CMPB_RBN_RWI_DATA3:
       len = 2;
       UpdateExtSequence(addr, len);
-      return Instruction::LiftOpRnRwiData3(addr, data, len, 1, flags, false, il,
+      return Instruction::LiftOpRnRwiData3(addr, data, 1, flags, false, il,
                                            IL_OP(BN::LowLevelILFunction::Sub));
     case Opcodes::CMPB_REG_DATA8:
       len = 4;
       UpdateExtSequence(addr, len);
-      return Instruction::LiftOpRegData(addr, data, len, 1, flags, false, il,
+      return Instruction::LiftOpRegData(addr, data, 1, flags, false, il,
                                         IL_OP(BN::LowLevelILFunction::Sub));
     case Opcodes::CMPB_REG_MEM:
       len = 4;
       UpdateExtSequence(addr, len);
-      return Instruction::LiftOpRegMem(addr, data, len, 1, flags, false, il,
+      return Instruction::LiftOpRegMem(addr, data, 1, flags, false, il,
                                        IL_OP(BN::LowLevelILFunction::Sub));
     default:
       BN::LogError("0x%lx: Cmpb::%s received invalid opcode: 0x%x", addr,
@@ -767,8 +793,8 @@ bool Cmpb::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
 
 bool Cmpd1::LiftxA0(const uint8_t *data, const uint64_t addr, size_t &len,
                     BN::LowLevelILFunction &il) {
-  const auto data4 = Instruction::GetData4High(data, 2);
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto data4 = Instruction::GetData4High(data);
+  const auto rwn = Instruction::GetData4Low(data);
 
   il.AddInstruction(il.Sub(2, il.Register(2, rwn), il.Const(2, data4), flags));
   il.AddInstruction(
@@ -782,12 +808,11 @@ bool Cmpd1::LiftxA0(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Cmpd1::LiftxA2(const uint8_t *data, const uint64_t addr, size_t &len,
                     BN::LowLevelILFunction &il) {
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
+  const auto rwn = Instruction::GetData4Low(data);
 
   il.AddInstruction(il.Sub(2, il.Register(2, rwn),
-                           il.Load(2, il.ConstPointer(3, mem)), flags));
+                           Instruction::LoadDirect(il, 2, mem), flags));
   il.AddInstruction(
       il.SetRegister(2, rwn, il.Sub(2, il.Register(2, rwn), il.Const(2, 1))));
 
@@ -799,8 +824,8 @@ bool Cmpd1::LiftxA2(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Cmpd1::LiftxA6(const uint8_t *data, const uint64_t addr, size_t &len,
                     BN::LowLevelILFunction &il) {
-  const uint32_t data16 = Instruction::GetData16(data, 4);
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const uint32_t data16 = Instruction::GetData16(data);
+  const auto rwn = Instruction::GetData4Low(data);
 
   il.AddInstruction(il.Sub(2, il.Register(2, rwn), il.Const(2, data16), flags));
   il.AddInstruction(
@@ -814,8 +839,8 @@ bool Cmpd1::LiftxA6(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Cmpd2::LiftxB0(const uint8_t *data, const uint64_t addr, size_t &len,
                     BN::LowLevelILFunction &il) {
-  const auto data4 = Instruction::GetData4High(data, 2);
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto data4 = Instruction::GetData4High(data);
+  const auto rwn = Instruction::GetData4Low(data);
 
   il.AddInstruction(il.Sub(2, il.Register(2, rwn), il.Const(2, data4), flags));
   il.AddInstruction(
@@ -829,14 +854,13 @@ bool Cmpd2::LiftxB0(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Cmpd2::LiftxB2(const uint8_t *data, const uint64_t addr, size_t &len,
                     BN::LowLevelILFunction &il) {
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
+  const auto rwn = Instruction::GetData4Low(data);
 
   il.AddInstruction(il.Sub(2, il.Register(2, rwn),
-                           il.Load(2, il.ConstPointer(3, mem)), flags));
+                           Instruction::LoadDirect(il, 2, mem), flags));
   il.AddInstruction(
-      il.SetRegister(2, rwn, il.Sub(2, il.Register(2, rwn), il.Const(2, 1))));
+      il.SetRegister(2, rwn, il.Sub(2, il.Register(2, rwn), il.Const(2, 2))));
 
   len = 4;
   UpdateExtSequence(addr, len);
@@ -846,8 +870,8 @@ bool Cmpd2::LiftxB2(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Cmpd2::LiftxB6(const uint8_t *data, const uint64_t addr, size_t &len,
                     BN::LowLevelILFunction &il) {
-  const uint32_t data16 = Instruction::GetData16(data, 4);
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const uint32_t data16 = Instruction::GetData16(data);
+  const auto rwn = Instruction::GetData4Low(data);
 
   il.AddInstruction(il.Sub(2, il.Register(2, rwn), il.Const(2, data16), flags));
   il.AddInstruction(
@@ -861,8 +885,8 @@ bool Cmpd2::LiftxB6(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Cmpi1::Liftx80(const uint8_t *data, const uint64_t addr, size_t &len,
                     BN::LowLevelILFunction &il) {
-  const auto data4 = Instruction::GetData4High(data, 2);
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto data4 = Instruction::GetData4High(data);
+  const auto rwn = Instruction::GetData4Low(data);
 
   il.AddInstruction(il.Sub(2, il.Register(2, rwn), il.Const(2, data4), flags));
   il.AddInstruction(
@@ -876,12 +900,11 @@ bool Cmpi1::Liftx80(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Cmpi1::Liftx82(const uint8_t *data, const uint64_t addr, size_t &len,
                     BN::LowLevelILFunction &il) {
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
+  const auto rwn = Instruction::GetData4Low(data);
 
   il.AddInstruction(il.Sub(2, il.Register(2, rwn),
-                           il.Load(2, il.ConstPointer(3, mem)), flags));
+                           Instruction::LoadDirect(il, 2, mem), flags));
   il.AddInstruction(
       il.SetRegister(2, rwn, il.Add(2, il.Register(2, rwn), il.Const(2, 1))));
 
@@ -893,8 +916,8 @@ bool Cmpi1::Liftx82(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Cmpi1::Liftx86(const uint8_t *data, const uint64_t addr, size_t &len,
                     BN::LowLevelILFunction &il) {
-  const uint32_t data16 = Instruction::GetData16(data, 4);
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const uint32_t data16 = Instruction::GetData16(data);
+  const auto rwn = Instruction::GetData4Low(data);
 
   il.AddInstruction(il.Sub(2, il.Register(2, rwn), il.Const(2, data16), flags));
   il.AddInstruction(
@@ -908,8 +931,8 @@ bool Cmpi1::Liftx86(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Cmpi2::Liftx90(const uint8_t *data, const uint64_t addr, size_t &len,
                     BN::LowLevelILFunction &il) {
-  const auto data4 = Instruction::GetData4High(data, 2);
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto data4 = Instruction::GetData4High(data);
+  const auto rwn = Instruction::GetData4Low(data);
 
   il.AddInstruction(il.Sub(2, il.Register(2, rwn), il.Const(2, data4), flags));
   il.AddInstruction(
@@ -923,14 +946,13 @@ bool Cmpi2::Liftx90(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Cmpi2::Liftx92(const uint8_t *data, const uint64_t addr, size_t &len,
                     BN::LowLevelILFunction &il) {
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
+  const auto rwn = Instruction::GetData4Low(data);
 
   il.AddInstruction(il.Sub(2, il.Register(2, rwn),
-                           il.Load(2, il.ConstPointer(3, mem)), flags));
+                           Instruction::LoadDirect(il, 2, mem), flags));
   il.AddInstruction(
-      il.SetRegister(2, rwn, il.Add(2, il.Register(2, rwn), il.Const(2, 1))));
+      il.SetRegister(2, rwn, il.Add(2, il.Register(2, rwn), il.Const(2, 2))));
 
   len = 4;
   UpdateExtSequence(addr, len);
@@ -940,8 +962,8 @@ bool Cmpi2::Liftx92(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Cmpi2::Liftx96(const uint8_t *data, const uint64_t addr, size_t &len,
                     BN::LowLevelILFunction &il) {
-  const uint32_t data16 = Instruction::GetData16(data, 4);
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const uint32_t data16 = Instruction::GetData16(data);
+  const auto rwn = Instruction::GetData4Low(data);
 
   il.AddInstruction(il.Sub(2, il.Register(2, rwn), il.Const(2, data16), flags));
   il.AddInstruction(
@@ -955,9 +977,10 @@ bool Cmpi2::Liftx96(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Cpl::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, length);
+  const auto rwn = Instruction::GetData4High(data);
 
-  il.AddInstruction(il.Not(2, il.Register(2, rwn), flags));
+  il.AddInstruction(
+      il.SetRegister(2, rwn, il.Not(2, il.Register(2, rwn), flags)));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -967,9 +990,10 @@ bool Cpl::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Cplb::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                 BN::LowLevelILFunction &il) {
-  const uint32_t rbn = Instruction::GetData4High(data, length) + 16;
+  const uint32_t rbn = Instruction::GetData4High(data) + 16;
 
-  il.AddInstruction(il.Not(1, il.Register(1, rbn), flags));
+  il.AddInstruction(
+      il.SetRegister(1, rbn, il.Not(1, il.Register(1, rbn), flags)));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -980,20 +1004,21 @@ bool Cplb::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 bool Diswdt::Lift(const uint8_t *data, uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
   UpdateExtSequence(addr, length);
-  UNIMPLEMENTED(length);
+  INTRINSIC(Intrinsics::DISWDT, length);
 }
 
 bool Div::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, length);
-
-  const auto div = il.DivDoublePrecSigned(
-      2, il.Load(2, il.ConstPointer(3, Sfr::MDL)), il.Register(2, rwn), flags);
-  const auto mod = il.ModDoublePrecSigned(
-      2, il.Load(2, il.ConstPointer(3, Sfr::MDL)), il.Register(2, rwn), flags);
+  const auto rwn = Instruction::GetData4High(data);
 
-  il.AddInstruction(il.Store(2, il.ConstPointer(3, Sfr::MDL), div));
-  il.AddInstruction(il.Store(2, il.ConstPointer(3, Sfr::MDH), mod));
+  // MDH must be written first, as both results are computed from MDL
+  il.AddInstruction(il.SetRegister(
+      2, Registers::MDH,
+      il.ModSigned(2, il.Register(2, Registers::MDL), il.Register(2, rwn))));
+  il.AddInstruction(il.SetRegister(
+      2, Registers::MDL,
+      il.DivSigned(2, il.Register(2, Registers::MDL), il.Register(2, rwn),
+                   flags)));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -1003,15 +1028,19 @@ bool Div::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Divl::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                 BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, length);
-
-  const auto div = il.DivDoublePrecSigned(
-      2, il.Load(4, il.ConstPointer(3, Sfr::MD)), il.Register(2, rwn), flags);
-  const auto mod = il.ModDoublePrecSigned(
-      2, il.Load(4, il.ConstPointer(3, Sfr::MD)), il.Register(2, rwn), flags);
+  const auto rwn = Instruction::GetData4High(data);
 
-  il.AddInstruction(il.Store(2, il.ConstPointer(3, Sfr::MDL), div));
-  il.AddInstruction(il.Store(2, il.ConstPointer(3, Sfr::MDH), mod));
+  // Latch the 32-bit dividend before either half of MD is overwritten
+  il.AddInstruction(
+      il.SetRegister(4, LLIL_TEMP(0), il.Register(4, Registers::MD)));
+  il.AddInstruction(il.SetRegister(
+      2, Registers::MDL,
+      il.DivDoublePrecSigned(2, il.Register(4, LLIL_TEMP(0)),
+                             il.Register(2, rwn), flags)));
+  il.AddInstruction(il.SetRegister(
+      2, Registers::MDH,
+      il.ModDoublePrecSigned(2, il.Register(4, LLIL_TEMP(0)),
+                             il.Register(2, rwn))));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -1021,15 +1050,19 @@ bool Divl::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Divlu::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                  BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, length);
-
-  const auto div = il.DivDoublePrecUnsigned(
-      2, il.Load(4, il.ConstPointer(3, Sfr::MD)), il.Register(2, rwn), flags);
-  const auto mod = il.ModDoublePrecUnsigned(
-      2, il.Load(4, il.ConstPointer(3, Sfr::MD)), il.Register(2, rwn), flags);
+  const auto rwn = Instruction::GetData4High(data);
 
-  il.AddInstruction(il.Store(2, il.ConstPointer(3, Sfr::MDL), div));
-  il.AddInstruction(il.Store(2, il.ConstPointer(3, Sfr::MDH), mod));
+  // Latch the 32-bit dividend before either half of MD is overwritten
+  il.AddInstruction(
+      il.SetRegister(4, LLIL_TEMP(0), il.Register(4, Registers::MD)));
+  il.AddInstruction(il.SetRegister(
+      2, Registers::MDL,
+      il.DivDoublePrecUnsigned(2, il.Register(4, LLIL_TEMP(0)),
+                               il.Register(2, rwn), flags)));
+  il.AddInstruction(il.SetRegister(
+      2, Registers::MDH,
+      il.ModDoublePrecUnsigned(2, il.Register(4, LLIL_TEMP(0)),
+                               il.Register(2, rwn))));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -1039,15 +1072,16 @@ bool Divlu::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Divu::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                 BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, length);
-
-  auto div = il.DivDoublePrecUnsigned(
-      2, il.Load(2, il.ConstPointer(3, Sfr::MDL)), il.Register(2, rwn), flags);
-  auto mod = il.ModDoublePrecUnsigned(
-      2, il.Load(2, il.ConstPointer(3, Sfr::MDL)), il.Register(2, rwn), flags);
+  const auto rwn = Instruction::GetData4High(data);
 
-  il.AddInstruction(il.Store(2, il.ConstPointer(3, Sfr::MDL), div));
-  il.AddInstruction(il.Store(2, il.ConstPointer(3, Sfr::MDH), mod));
+  // MDH must be written first, as both results are computed from MDL
+  il.AddInstruction(il.SetRegister(
+      2, Registers::MDH,
+      il.ModUnsigned(2, il.Register(2, Registers::MDL), il.Register(2, rwn))));
+  il.AddInstruction(il.SetRegister(
+      2, Registers::MDL,
+      il.DivUnsigned(2, il.Register(2, Registers::MDL), il.Register(2, rwn),
+                     flags)));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -1058,72 +1092,78 @@ bool Divu::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 bool Einit::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                  BN::LowLevelILFunction &il) {
   UpdateExtSequence(addr, length);
-  UNIMPLEMENTED(length);
+  INTRINSIC(Intrinsics::EINIT, length);
 }
 
 bool ExtrAtomic::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                       BN::LowLevelILFunction &il) {
-  // EXTR/ATOMIC
-  uint8_t num_insns = ((data[1] & 0b00110000) >> 4) + 1;
-  Instruction::SetExtr(addr + length, num_insns - 1);
+  uint8_t num_insns = Formats::Get<Formats::Ext::irang2>(data) + 1;
+  if (Formats::Get<Formats::Ext::subop>(data) == 0b10) {
+    // EXTR only changes how the following instructions decode
+    Instruction::SetExtr(addr + length, num_insns - 1);
+    NO_OPERATION(length);
+  }
 
-  UNIMPLEMENTED(length);
+  // ATOMIC
+  il.AddInstruction(il.Intrinsic({}, Intrinsics::ATOMIC,
+                                 {il.Const(1, num_insns)}));
+  len = length;
+  return true;
 }
 
 bool Extprs::LiftxD7(const uint8_t *data, const uint64_t addr, size_t &len,
                      BN::LowLevelILFunction &il) {
-  uint8_t num_insns = ((data[1] & 0b00110000) >> 4) + 1;
-  if ((data[1] & 0b11000000) == 0b00000000) {
+  uint8_t num_insns = Formats::Get<Formats::Ext::irang2>(data) + 1;
+  const uint8_t subop = Formats::Get<Formats::Ext::subop>(data);
+  if (subop == 0b00) {
     // EXTS
-    uint16_t seg8 = data[2];
+    uint16_t seg8 = Formats::Get<Formats::Ext::seg8>(data);
     Instruction::SetExtsSeg8(addr + 4, seg8, num_insns - 1);
-  } else if ((data[1] & 0b11000000) == 0b01000000) {
+  } else if (subop == 0b01) {
     // EXTP
-    uint16_t pag10 = ((data[3] & 0b11) << 8) | data[2];
+    uint16_t pag10 = Formats::Get<Formats::Ext::pag10>(data);
     Instruction::SetExtpPag10(addr + 4, pag10, num_insns - 1);
-  } else if ((data[1] & 0b11000000) == 0b10000000) {
-    // TODO: EXTSR
+  } else if (subop == 0b10) {
+    // EXTSR
+    uint16_t seg8 = Formats::Get<Formats::Ext::seg8>(data);
+    Instruction::SetExtsSeg8(addr + 4, seg8, num_insns - 1);
+    Instruction::SetExtr(addr + 4, num_insns - 1);
   } else {
-    // TODO: EXTPR
+    // EXTPR
+    uint16_t pag10 = Formats::Get<Formats::Ext::pag10>(data);
+    Instruction::SetExtpPag10(addr + 4, pag10, num_insns - 1);
+    Instruction::SetExtr(addr + 4, num_insns - 1);
   }
 
-  UNIMPLEMENTED(4);
+  // The prefix only changes how the following instructions decode
+  NO_OPERATION(4);
 }
 
 bool Extprs::LiftxDC(const uint8_t *data, const uint64_t addr, size_t &len,
                      BN::LowLevelILFunction &il) {
-  // TODO: EXTP
+  // TODO: EXTP/EXTS Rwm -- the page or segment is only known at runtime, so
+  // the accesses that follow cannot be lifted faithfully
   UNIMPLEMENTED(2);
 }
 
 bool Idle::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                 BN::LowLevelILFunction &il) {
   UpdateExtSequence(addr, length);
-  UNIMPLEMENTED(length);
+  INTRINSIC(Intrinsics::IDLE, length);
 }
 
 bool Jb::Lift(BN::Architecture *arch, const uint8_t *data, const uint64_t addr,
               size_t &len, BN::LowLevelILFunction &il) {
-  const auto target = GetTarget(data, addr, length);
-  const uint32_t bitaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  const uint8_t bitpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
+  const auto target = GetTarget(data, addr);
+  const uint32_t bitaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitRel::bitoff>(data));
+  const uint8_t bitpos = Formats::Get<Formats::BitRel::bitpos>(data);
 
-  BN::ExprId bitval, condition;
-  BNLowLevelILLabel *t, *f;
+  // JB does not modify the PSW; branch directly on the bit value
+  const BN::ExprId condition = Instruction::TestBit(il, bitaddr, bitpos);
 
-  if (bitaddr <= 0xF) {
-    bitval =
-        il.And(2, il.Register(2, bitaddr), il.Const(2, 0b1u << bitpos), flags);
-  } else {
-    bitval = il.And(2, il.Load(2, il.ConstPointer(3, bitaddr)),
-                    il.Const(2, 0b1u << bitpos), flags);
-  }
-  il.AddInstruction(bitval);
-
-  condition =
-      il.FlagCondition(Instruction::GetFlagCondition(Conditions::CC_NZ));
-  t = il.GetLabelForAddress(arch, target);
-  f = il.GetLabelForAddress(arch, addr + length);
+  BNLowLevelILLabel *t = il.GetLabelForAddress(arch, target);
+  BNLowLevelILLabel *f = il.GetLabelForAddress(arch, addr + length);
 
   if (!t || !f) {  // This should never happen!
     BN::LogDebug("0x%lx: Jb::%s Failed to find true/false labels!", addr,
@@ -1140,32 +1180,23 @@ bool Jb::Lift(BN::Architecture *arch, const uint8_t *data, const uint64_t addr,
 
 bool Jbc::Lift(BN::Architecture *arch, const uint8_t *data, const uint64_t addr,
                size_t &len, BN::LowLevelILFunction &il) {
-  const auto target = GetTarget(data, addr, length);
-  const uint32_t bitaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  const uint8_t bitpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
-
-  BN::ExprId condition;
-  BNLowLevelILLabel *t, *f;
-
-  if (bitaddr <= 0xF) {
-    il.AddInstruction(
-        il.And(2, il.Register(2, bitaddr), il.Const(2, 0b1u << bitpos), flags));
-    il.AddInstruction(il.SetRegister(
-        2, bitaddr,
-        il.And(2, il.Register(2, bitaddr), il.Const(2, ~(0b1u << bitpos)))));
-  } else {
-    il.AddInstruction(il.And(2, il.Load(2, il.ConstPointer(3, bitaddr)),
-                             il.Const(2, 0b1u << bitpos)));
-    il.AddInstruction(
-        il.Store(2, il.ConstPointer(3, bitaddr),
-                 il.And(2, il.Load(2, il.ConstPointer(3, bitaddr)),
-                        il.Const(2, ~(0b1u << bitpos)))));
-  }
-
-  condition =
-      il.FlagCondition(Instruction::GetFlagCondition(Conditions::CC_NZ));
-  t = il.GetLabelForAddress(arch, target);
-  f = il.GetLabelForAddress(arch, addr + length);
+  const auto target = GetTarget(data, addr);
+  const uint32_t bitaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitRel::bitoff>(data));
+  const uint8_t bitpos = Formats::Get<Formats::BitRel::bitpos>(data);
+
+  // The flags capture the bit value before it is cleared
+  il.AddInstruction(il.And(2, Instruction::GetBitWord(il, bitaddr),
+                           il.Const(2, 0b1u << bitpos), flags));
+  il.AddInstruction(Instruction::SetBitWord(
+      il, bitaddr,
+      il.And(2, Instruction::GetBitWord(il, bitaddr),
+             il.Const(2, 0xFFFFu & ~(0b1u << bitpos)))));
+  const BN::ExprId condition =
+      Instruction::GetCondition(il, Conditions::CC_NZ);
+
+  BNLowLevelILLabel *t = il.GetLabelForAddress(arch, target);
+  BNLowLevelILLabel *f = il.GetLabelForAddress(arch, addr + length);
 
   if (!t || !f) {  // This should never happen!
     BN::LogDebug("0x%lx: Jbc::%s Failed to find true/false labels!", addr,
@@ -1182,8 +1213,8 @@ bool Jbc::Lift(BN::Architecture *arch, const uint8_t *data, const uint64_t addr,
 
 bool Jmpa::Lift(BN::Architecture *arch, const uint8_t *data,
                 const uint64_t addr, size_t &len, BN::LowLevelILFunction &il) {
-  const auto code = GetConditionCode(data, length);
-  const auto target = GetTarget(data, addr, length);
+  const auto code = GetConditionCode(data);
+  const auto target = GetTarget(data, addr);
 
   if (code == Conditions::CC_UC) {
     len = length;
@@ -1191,8 +1222,7 @@ bool Jmpa::Lift(BN::Architecture *arch, const uint8_t *data,
 
     return Instruction::JumpDirect(arch, il, target);
   } else {
-    BN::ExprId condition =
-        il.FlagCondition(Instruction::GetFlagCondition(code));
+    BN::ExprId condition = Instruction::GetCondition(il, code);
     BNLowLevelILLabel *t = il.GetLabelForAddress(arch, target);
     BNLowLevelILLabel *f = il.GetLabelForAddress(arch, addr + length);
 
@@ -1212,8 +1242,8 @@ bool Jmpa::Lift(BN::Architecture *arch, const uint8_t *data,
 
 bool Jmpi::Lift(BN::Architecture *arch, const uint8_t *data,
                 const uint64_t addr, size_t &len, BN::LowLevelILFunction &il) {
-  const auto code = Instruction::GetData4High(data, length);
-  const auto rwn = Instruction::GetData4Low(data, length);
+  const auto code = Instruction::GetData4High(data);
+  const auto rwn = Instruction::GetData4Low(data);
 
   if (code == Conditions::CC_UC) {
     len = length;
@@ -1229,8 +1259,8 @@ bool Jmpi::Lift(BN::Architecture *arch, const uint8_t *data,
 
 bool Jmpr::Lift(BN::Architecture *arch, const uint8_t *data,
                 const uint64_t addr, size_t &len, BN::LowLevelILFunction &il) {
-  const auto code = GetConditionCode(data, length);
-  const auto target = GetTarget(data, addr, length);
+  const auto code = GetConditionCode(data);
+  const auto target = GetTarget(data, addr);
 
   if (code == Conditions::CC_UC) {
     len = length;
@@ -1238,8 +1268,7 @@ bool Jmpr::Lift(BN::Architecture *arch, const uint8_t *data,
 
     return Instruction::JumpDirect(arch, il, target);
   } else {
-    BN::ExprId condition =
-        il.FlagCondition(Instruction::GetFlagCondition(code));
+    BN::ExprId condition = Instruction::GetCondition(il, code);
     BNLowLevelILLabel *t = il.GetLabelForAddress(arch, target);
     BNLowLevelILLabel *f = il.GetLabelForAddress(arch, addr + length);
 
@@ -1262,29 +1291,22 @@ bool Jmps::Lift(BN::Architecture *arch, const uint8_t *data,
   len = length;
   UpdateExtSequence(addr, len);
 
-  return Instruction::JumpDirect(arch, il, GetTarget(data, length));
+  return Instruction::JumpDirect(arch, il, GetTarget(data));
 }
 
 bool Jnb::Lift(BN::Architecture *arch, const uint8_t *data, const uint64_t addr,
                size_t &len, BN::LowLevelILFunction &il) {
-  const auto target = GetTarget(data, addr, length);
-  const uint32_t bitaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  const uint8_t bitpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
-
-  BN::ExprId condition;
-  BNLowLevelILLabel *t, *f;
+  const auto target = GetTarget(data, addr);
+  const uint32_t bitaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitRel::bitoff>(data));
+  const uint8_t bitpos = Formats::Get<Formats::BitRel::bitpos>(data);
 
-  if (bitaddr <= 0xF) {
-    il.AddInstruction(
-        il.And(2, il.Register(2, bitaddr), il.Const(2, 0b1u << bitpos), flags));
-  } else {
-    il.AddInstruction(il.And(2, il.Load(2, il.ConstPointer(3, bitaddr)),
-                             il.Const(2, 0b1u << bitpos), flags));
-  }
+  // JNB does not modify the PSW; branch directly on the bit value
+  const BN::ExprId condition =
+      Instruction::TestBit(il, bitaddr, bitpos, false);
 
-  condition = il.FlagCondition(Instruction::GetFlagCondition(Conditions::CC_Z));
-  t = il.GetLabelForAddress(arch, target);
-  f = il.GetLabelForAddress(arch, addr + length);
+  BNLowLevelILLabel *t = il.GetLabelForAddress(arch, target);
+  BNLowLevelILLabel *f = il.GetLabelForAddress(arch, addr + length);
 
   if (!t || !f) {  // This should never happen!
     BN::LogDebug("0x%lx: Jnb::%s Failed to find true/false labels!", addr,
@@ -1301,30 +1323,23 @@ bool Jnb::Lift(BN::Architecture *arch, const uint8_t *data, const uint64_t addr,
 
 bool Jnbs::Lift(BN::Architecture *arch, const uint8_t *data,
                 const uint64_t addr, size_t &len, BN::LowLevelILFunction &il) {
-  const auto target = GetTarget(data, addr, length);
-  const uint32_t bitaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  const uint8_t bitpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
-
-  BN::ExprId condition;
-  BNLowLevelILLabel *t, *f;
-
-  if (bitaddr <= 0xF) {
-    il.AddInstruction(
-        il.And(2, il.Register(2, bitaddr), il.Const(2, 0b1u << bitpos), flags));
-    il.AddInstruction(il.SetRegister(
-        2, bitaddr,
-        il.Or(2, il.Register(2, bitaddr), il.Const(2, 0b1u << bitpos))));
-  } else {
-    il.AddInstruction(il.And(2, il.Load(2, il.ConstPointer(3, bitaddr)),
-                             il.Const(2, 0b1u << bitpos)));
-    il.AddInstruction(il.Store(2, il.ConstPointer(3, bitaddr),
-                               il.Or(2, il.Load(2, il.ConstPointer(3, bitaddr)),
-                                     il.Const(2, 0b1u << bitpos))));
-  }
-
-  condition = il.FlagCondition(Instruction::GetFlagCondition(Conditions::CC_Z));
-  t = il.GetLabelForAddress(arch, target);
-  f = il.GetLabelForAddress(arch, addr + length);
+  const auto target = GetTarget(data, addr);
+  const uint32_t bitaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitRel::bitoff>(data));
+  const uint8_t bitpos = Formats::Get<Formats::BitRel::bitpos>(data);
+
+  // The flags capture the bit value before it is set
+  il.AddInstruction(il.And(2, Instruction::GetBitWord(il, bitaddr),
+                           il.Const(2, 0b1u << bitpos), flags));
+  il.AddInstruction(Instruction::SetBitWord(
+      il, bitaddr,
+      il.Or(2, Instruction::GetBitWord(il, bitaddr),
+            il.Const(2, 0b1u << bitpos))));
+  const BN::ExprId condition =
+      Instruction::GetCondition(il, Conditions::CC_Z);
+
+  BNLowLevelILLabel *t = il.GetLabelForAddress(arch, target);
+  BNLowLevelILLabel *f = il.GetLabelForAddress(arch, addr + length);
 
   if (!t || !f) {  // This should never happen!
     BN::LogDebug("0x%lx: Jnbs::%s Failed to find true/false labels!", addr,
@@ -1341,12 +1356,11 @@ bool Jnbs::Lift(BN::Architecture *arch, const uint8_t *data,
 
 bool Mov::Liftx84(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4Low(data, 2);
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
 
   il.AddInstruction(il.Store(2, il.Register(2, rwn),
-                             il.Load(2, il.ConstPointer(3, mem)), flags));
+                             Instruction::LoadDirect(il, 2, mem), flags));
 
   len = 4;
   UpdateExtSequence(addr, len);
@@ -1356,10 +1370,11 @@ bool Mov::Liftx84(const uint8_t *data, const uint64_t addr, size_t &len,
 
 // MOV [-Rw_m], Rw_n
 // Format: 88 nm
+template <Variant V>
 bool Mov::Liftx88(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   BN::ExprId DstIndAddr;
   uint32_t seg8, pag10;
@@ -1369,21 +1384,13 @@ bool Mov::Liftx88(const uint8_t *data, const uint64_t addr, size_t &len,
   } else if (Instruction::ShouldUseExtp(addr, &pag10)) {
     DstIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwm);
   } else {
-    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwm);
+    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwm);
   }
 
-  auto arch = il.GetArchitecture();
-  uint32_t sp;
-  if (arch.GetPtr() == nullptr) {
-    BN::LogDebug("0x%lx: %s GetBN::Architecture returned nullptr", addr,
-                 __PRETTY_FUNCTION__);
-    sp = Registers::R0;
-  } else {
-    sp = arch->GetStackPointerRegister();
-  }
-
-  if (rwm == sp)
-    il.AddInstruction(il.Push(2, il.Register(2, rwn)));
+  // A push (pop) of the stack pointer itself would use its value before
+  // (after) the adjustment, so that case stays a plain store (load)
+  if (rwm == V.stack_pointer && rwn != rwm)
+    il.AddInstruction(il.Push(2, il.Register(2, rwn), flags));
   else {
     il.AddInstruction(
         il.SetRegister(2, rwm, il.Sub(2, il.Register(2, rwm), il.Const(2, 2))));
@@ -1398,12 +1405,11 @@ bool Mov::Liftx88(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Mov::Liftx94(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4Low(data, 2);
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
 
-  il.AddInstruction(il.Store(2, il.ConstPointer(3, mem),
-                             il.Load(2, il.Register(2, rwn)), flags));
+  il.AddInstruction(Instruction::StoreDirect(
+      il, 2, mem, il.Load(2, il.Register(2, rwn)), flags));
 
   len = 4;
   UpdateExtSequence(addr, len);
@@ -1413,10 +1419,11 @@ bool Mov::Liftx94(const uint8_t *data, const uint64_t addr, size_t &len,
 
 // MOV Rw_n, [Rw_m+]
 // Format:
+template <Variant V>
 bool Mov::Liftx98(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   BN::ExprId SrcIndAddr;
   uint32_t seg8, pag10;
@@ -1426,21 +1433,11 @@ bool Mov::Liftx98(const uint8_t *data, const uint64_t addr, size_t &len,
   } else if (Instruction::ShouldUseExtp(addr, &pag10)) {
     SrcIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwm);
   } else {
-    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwm);
+    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwm);
   }
 
-  auto arch = il.GetArchitecture();
-  uint32_t sp;
-  if (arch.GetPtr() == nullptr) {
-    BN::LogDebug("0x%lx: %s GetBN::Architecture returned nullptr", addr,
-                 __PRETTY_FUNCTION__);
-    sp = Registers::R0;
-  } else {
-    sp = arch->GetStackPointerRegister();
-  }
-
-  if (rwm == sp)
-    il.AddInstruction(il.SetRegister(2, rwn, il.Pop(2)));
+  if (rwm == V.stack_pointer && rwn != rwm)
+    il.AddInstruction(il.SetRegister(2, rwn, il.Pop(2), flags));
   else {
     il.AddInstruction(il.SetRegister(2, rwn, il.Load(2, SrcIndAddr), flags));
     il.AddInstruction(il.SetRegister(
@@ -1457,8 +1454,8 @@ bool Mov::Liftx98(const uint8_t *data, const uint64_t addr, size_t &len,
 // Format: A8 nm
 bool Mov::LiftxA8(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   BN::ExprId SrcIndAddr;
   uint32_t seg8, pag10;
@@ -1468,7 +1465,7 @@ bool Mov::LiftxA8(const uint8_t *data, const uint64_t addr, size_t &len,
   } else if (Instruction::ShouldUseExtp(addr, &pag10)) {
     SrcIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwm);
   } else {
-    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwm);
+    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwm);
   }
 
   il.AddInstruction(il.SetRegister(2, rwn, il.Load(2, SrcIndAddr), flags));
@@ -1483,8 +1480,8 @@ bool Mov::LiftxA8(const uint8_t *data, const uint64_t addr, size_t &len,
 // Format: B8 nm
 bool Mov::LiftxB8(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   BN::ExprId DstIndAddr;
   uint32_t seg8, pag10;
@@ -1494,7 +1491,7 @@ bool Mov::LiftxB8(const uint8_t *data, const uint64_t addr, size_t &len,
   } else if (Instruction::ShouldUseExtp(addr, &pag10)) {
     DstIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwm);
   } else {
-    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwm);
+    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwm);
   }
 
   il.AddInstruction(il.Store(2, DstIndAddr, il.Register(2, rwn), flags));
@@ -1509,9 +1506,9 @@ bool Mov::LiftxB8(const uint8_t *data, const uint64_t addr, size_t &len,
 // Format: C4 nm ## ##
 bool Mov::LiftxC4(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
-  const auto data16 = Instruction::GetData16(data, 4);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
+  const auto data16 = Instruction::GetData16(data);
 
   BN::ExprId DstIndAddr;
   uint32_t seg8, pag10;
@@ -1522,7 +1519,7 @@ bool Mov::LiftxC4(const uint8_t *data, const uint64_t addr, size_t &len,
     DstIndAddr =
         Instruction::GetIndAddrExpr_Extp_Rw_data16(il, pag10, rwm, data16);
   } else {
-    DstIndAddr = Instruction::GetIndAddrExpr_Rw_data16(il, rwm, data16);
+    DstIndAddr = Instruction::GetIndAddrExpr_Rw_data16(il, addr, rwm, data16);
   }
 
   il.AddInstruction(il.Store(2, DstIndAddr, il.Register(2, rwn), flags));
@@ -1537,8 +1534,8 @@ bool Mov::LiftxC4(const uint8_t *data, const uint64_t addr, size_t &len,
 // Format: C8 nm
 bool Mov::LiftxC8(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   BN::ExprId DstIndAddr, SrcIndAddr;
   uint32_t seg8, pag10;
@@ -1550,8 +1547,8 @@ bool Mov::LiftxC8(const uint8_t *data, const uint64_t addr, size_t &len,
     DstIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwn);
     SrcIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwm);
   } else {
-    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwn);
-    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwm);
+    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwn);
+    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwm);
   }
 
   il.AddInstruction(il.Store(2, DstIndAddr, il.Load(2, SrcIndAddr), flags));
@@ -1566,9 +1563,9 @@ bool Mov::LiftxC8(const uint8_t *data, const uint64_t addr, size_t &len,
 // Format: D4 nm ##  ##
 bool Mov::LiftxD4(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
-  const auto data16 = Instruction::GetData16(data, 4);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
+  const auto data16 = Instruction::GetData16(data);
 
   BN::ExprId SrcIndAddr;
   uint32_t seg8, pag10;
@@ -1579,10 +1576,10 @@ bool Mov::LiftxD4(const uint8_t *data, const uint64_t addr, size_t &len,
     SrcIndAddr =
         Instruction::GetIndAddrExpr_Extp_Rw_data16(il, pag10, rwm, data16);
   } else {
-    SrcIndAddr = Instruction::GetIndAddrExpr_Rw_data16(il, rwm, data16);
+    SrcIndAddr = Instruction::GetIndAddrExpr_Rw_data16(il, addr, rwm, data16);
   }
 
-  il.AddInstruction(il.Store(2, il.Register(2, rwn), SrcIndAddr, flags));
+  il.AddInstruction(il.SetRegister(2, rwn, il.Load(2, SrcIndAddr), flags));
 
   len = 4;
   UpdateExtSequence(addr, len);
@@ -1594,8 +1591,8 @@ bool Mov::LiftxD4(const uint8_t *data, const uint64_t addr, size_t &len,
 // Format: D8 nm
 bool Mov::LiftxD8(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   BN::ExprId DstIndAddr, SrcIndAddr;
   uint32_t seg8, pag10;
@@ -1607,8 +1604,8 @@ bool Mov::LiftxD8(const uint8_t *data, const uint64_t addr, size_t &len,
     DstIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwn);
     SrcIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwm);
   } else {
-    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwn);
-    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwm);
+    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwn);
+    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwm);
   }
 
   il.AddInstruction(il.Store(2, DstIndAddr, il.Load(2, SrcIndAddr), flags));
@@ -1623,8 +1620,8 @@ bool Mov::LiftxD8(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Mov::LiftxE0(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4Low(data, 2);
-  const auto data4 = Instruction::GetData4High(data, 2);
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto data4 = Instruction::GetData4High(data);
 
   il.AddInstruction(il.SetRegister(2, rwn, il.Const(2, data4), flags));
 
@@ -1637,14 +1634,14 @@ bool Mov::LiftxE0(const uint8_t *data, const uint64_t addr, size_t &len,
 bool Mov::LiftxE6(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
   const auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, len));
-  const auto data16 = Instruction::GetData16(data, 4);
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
+  const auto data16 = Instruction::GetData16(data);
 
   if (reg <= 0xF) {
     il.AddInstruction(il.SetRegister(2, reg, il.Const(2, data16), flags));
   } else {
     il.AddInstruction(
-        il.Store(2, il.ConstPointer(3, reg), il.Const(2, data16), flags));
+        Instruction::StoreDirect(il, 2, reg, il.Const(2, data16), flags));
   }
 
   len = 4;
@@ -1657,8 +1654,8 @@ bool Mov::LiftxE6(const uint8_t *data, const uint64_t addr, size_t &len,
 // Format: E8 Nm
 bool Mov::LiftxE8(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   BN::ExprId DstIndAddr, SrcIndAddr;
   uint32_t seg8, pag10;
@@ -1670,8 +1667,8 @@ bool Mov::LiftxE8(const uint8_t *data, const uint64_t addr, size_t &len,
     DstIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwn);
     SrcIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwm);
   } else {
-    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwn);
-    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwm);
+    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwn);
+    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwm);
   }
 
   il.AddInstruction(il.Store(2, DstIndAddr, il.Load(2, SrcIndAddr), flags));
@@ -1686,8 +1683,8 @@ bool Mov::LiftxE8(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Mov::LiftxF0(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   il.AddInstruction(il.SetRegister(2, rwn, il.Register(2, rwm), flags));
 
@@ -1700,15 +1697,15 @@ bool Mov::LiftxF0(const uint8_t *data, const uint64_t addr, size_t &len,
 bool Mov::LiftxF2(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
   const auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, len));
-  const auto mem = Instruction::GetMem(addr, data, len);
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
+  const auto mem = Instruction::GetMem(addr, data);
 
   if (reg <= 0xF) {
     il.AddInstruction(
-        il.SetRegister(2, reg, il.Load(2, il.ConstPointer(3, mem)), flags));
+        il.SetRegister(2, reg, Instruction::LoadDirect(il, 2, mem), flags));
   } else {
-    il.AddInstruction(il.Store(2, il.ConstPointer(3, reg),
-                               il.Load(2, il.ConstPointer(3, mem)), flags));
+    il.AddInstruction(Instruction::StoreDirect(
+        il, 2, reg, Instruction::LoadDirect(il, 2, mem), flags));
   }
 
   len = 4;
@@ -1719,16 +1716,16 @@ bool Mov::LiftxF2(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Mov::LiftxF6(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto mem = Instruction::GetMem(addr, data, len);
+  const auto mem = Instruction::GetMem(addr, data);
   const auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, len));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
 
   if (reg <= 0xF) {
     il.AddInstruction(
-        il.Store(2, il.ConstPointer(3, mem), il.Register(2, reg), flags));
+        Instruction::StoreDirect(il, 2, mem, il.Register(2, reg), flags));
   } else {
-    il.AddInstruction(il.Store(2, il.ConstPointer(3, mem),
-                               Instruction::ElideReg(il, reg, 2), flags));
+    il.AddInstruction(Instruction::StoreDirect(
+        il, 2, mem, Instruction::ElideReg(il, reg, 2), flags));
   }
 
   len = 4;
@@ -1739,10 +1736,11 @@ bool Mov::LiftxF6(const uint8_t *data, const uint64_t addr, size_t &len,
 
 // MOVB [-Rw_m], Rb_n
 // Format: 89 nm
+template <Variant V>
 bool Movb::Liftx89(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
-  const uint32_t rbn = Instruction::GetData4High(data, 2) + 16;
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const uint32_t rbn = Instruction::GetData4High(data) + 16;
+  const auto rwm = Instruction::GetData4Low(data);
 
   BN::ExprId DstIndAddr;
   uint32_t seg8, pag10;
@@ -1752,20 +1750,10 @@ bool Movb::Liftx89(const uint8_t *data, const uint64_t addr, size_t &len,
   } else if (Instruction::ShouldUseExtp(addr, &pag10)) {
     DstIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwm);
   } else {
-    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwm);
-  }
-
-  auto arch = il.GetArchitecture();
-  uint32_t sp;
-  if (arch.GetPtr() == nullptr) {
-    BN::LogDebug("0x%lx: %s GetBN::Architecture returned nullptr", addr,
-                 __PRETTY_FUNCTION__);
-    sp = Registers::R0;
-  } else {
-    sp = arch->GetStackPointerRegister();
+    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwm);
   }
 
-  if (rwm == sp)
+  if (rwm == V.stack_pointer && (rbn - 16) / 2 != rwm)
     il.AddInstruction(il.Push(1, il.Register(1, rbn), flags));
   else {
     il.AddInstruction(
@@ -1781,10 +1769,11 @@ bool Movb::Liftx89(const uint8_t *data, const uint64_t addr, size_t &len,
 
 // MOVB Rb_n, [Rw_m+]
 // Format: 99 nm
+template <Variant V>
 bool Movb::Liftx99(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
-  const uint32_t rbn = Instruction::GetData4High(data, 2) + 16;
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const uint32_t rbn = Instruction::GetData4High(data) + 16;
+  const auto rwm = Instruction::GetData4Low(data);
 
   BN::ExprId SrcIndAddr;
   uint32_t seg8, pag10;
@@ -1794,21 +1783,11 @@ bool Movb::Liftx99(const uint8_t *data, const uint64_t addr, size_t &len,
   } else if (Instruction::ShouldUseExtp(addr, &pag10)) {
     SrcIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwm);
   } else {
-    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwm);
-  }
-
-  auto arch = il.GetArchitecture();
-  uint32_t sp;
-  if (arch.GetPtr() == nullptr) {
-    BN::LogDebug("0x%lx: %s GetBN::Architecture returned nullptr", addr,
-                 __PRETTY_FUNCTION__);
-    sp = Registers::R0;
-  } else {
-    sp = arch->GetStackPointerRegister();
+    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwm);
   }
 
-  if (rwm == sp)
-    il.AddInstruction(il.SetRegister(1, rbn, il.Pop(2), flags));
+  if (rwm == V.stack_pointer && (rbn - 16) / 2 != rwm)
+    il.AddInstruction(il.SetRegister(1, rbn, il.Pop(1), flags));
   else {
     il.AddInstruction(il.SetRegister(1, rbn, il.Load(1, SrcIndAddr), flags));
     il.AddInstruction(il.SetRegister(
@@ -1825,9 +1804,8 @@ bool Movb::Liftx99(const uint8_t *data, const uint64_t addr, size_t &len,
 // Format: A4 0n MM MM
 bool Movb::LiftxA4(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4Low(data, 2);
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
 
   BN::ExprId DstIndAddr;
   uint32_t seg8, pag10;
@@ -1837,11 +1815,11 @@ bool Movb::LiftxA4(const uint8_t *data, const uint64_t addr, size_t &len,
   } else if (Instruction::ShouldUseExtp(addr, &pag10)) {
     DstIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwn);
   } else {
-    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwn);
+    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwn);
   }
 
   il.AddInstruction(
-      il.Store(1, DstIndAddr, il.Load(1, il.ConstPointer(3, mem)), flags));
+      il.Store(1, DstIndAddr, Instruction::LoadDirect(il, 1, mem), flags));
 
   len = 4;
   UpdateExtSequence(addr, len);
@@ -1853,9 +1831,8 @@ bool Movb::LiftxA4(const uint8_t *data, const uint64_t addr, size_t &len,
 // Format: B4 0n MM MM
 bool Movb::LiftxB4(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4Low(data, 2);
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
 
   BN::ExprId SrcIndAddr;
   uint32_t seg8, pag10;
@@ -1865,11 +1842,11 @@ bool Movb::LiftxB4(const uint8_t *data, const uint64_t addr, size_t &len,
   } else if (Instruction::ShouldUseExtp(addr, &pag10)) {
     SrcIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwn);
   } else {
-    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwn);
+    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwn);
   }
 
   il.AddInstruction(
-      il.Store(1, il.ConstPointer(3, mem), il.Load(1, SrcIndAddr), flags));
+      Instruction::StoreDirect(il, 1, mem, il.Load(1, SrcIndAddr), flags));
 
   len = 4;
   UpdateExtSequence(addr, len);
@@ -1881,8 +1858,8 @@ bool Movb::LiftxB4(const uint8_t *data, const uint64_t addr, size_t &len,
 // Format: A9 nm
 bool Movb::LiftxA9(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
-  const uint32_t rbn = Instruction::GetData4High(data, 2) + 16;
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const uint32_t rbn = Instruction::GetData4High(data) + 16;
+  const auto rwm = Instruction::GetData4Low(data);
 
   BN::ExprId SrcIndAddr;
   uint32_t seg8, pag10;
@@ -1891,7 +1868,7 @@ bool Movb::LiftxA9(const uint8_t *data, const uint64_t addr, size_t &len,
   } else if (Instruction::ShouldUseExtp(addr, &pag10)) {
     SrcIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwm);
   } else {
-    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwm);
+    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwm);
   }
   il.AddInstruction(il.SetRegister(1, rbn, il.Load(1, SrcIndAddr), flags));
 
@@ -1905,8 +1882,8 @@ bool Movb::LiftxA9(const uint8_t *data, const uint64_t addr, size_t &len,
 // Format: B9 nm
 bool Movb::LiftxB9(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
-  const uint32_t rbn = Instruction::GetData4High(data, 2) + 16;
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const uint32_t rbn = Instruction::GetData4High(data) + 16;
+  const auto rwm = Instruction::GetData4Low(data);
 
   BN::ExprId DstIndAddr;
   uint32_t seg8, pag10;
@@ -1916,7 +1893,7 @@ bool Movb::LiftxB9(const uint8_t *data, const uint64_t addr, size_t &len,
   } else if (Instruction::ShouldUseExtp(addr, &pag10)) {
     DstIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwm);
   } else {
-    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwm);
+    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwm);
   }
   il.AddInstruction(il.Store(1, DstIndAddr, il.Register(1, rbn), flags));
 
@@ -1930,8 +1907,8 @@ bool Movb::LiftxB9(const uint8_t *data, const uint64_t addr, size_t &len,
 // Format: C9 nm
 bool Movb::LiftxC9(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   BN::ExprId DstIndAddr, SrcIndAddr;
   uint32_t seg8, pag10;
@@ -1943,8 +1920,8 @@ bool Movb::LiftxC9(const uint8_t *data, const uint64_t addr, size_t &len,
     DstIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwn);
     SrcIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwm);
   } else {
-    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwn);
-    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwm);
+    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwn);
+    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwm);
   }
 
   il.AddInstruction(il.Store(1, DstIndAddr, il.Load(1, SrcIndAddr), flags));
@@ -1959,8 +1936,8 @@ bool Movb::LiftxC9(const uint8_t *data, const uint64_t addr, size_t &len,
 // Format: D9 nm
 bool Movb::LiftxD9(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   BN::ExprId DstIndAddr, SrcIndAddr;
   uint32_t seg8, pag10;
@@ -1972,8 +1949,8 @@ bool Movb::LiftxD9(const uint8_t *data, const uint64_t addr, size_t &len,
     DstIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwn);
     SrcIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwm);
   } else {
-    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwn);
-    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwm);
+    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwn);
+    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwm);
   }
 
   il.AddInstruction(il.Store(1, DstIndAddr, il.Load(1, SrcIndAddr), flags));
@@ -1990,9 +1967,9 @@ bool Movb::LiftxD9(const uint8_t *data, const uint64_t addr, size_t &len,
 // Format: E4 nm ## ##
 bool Movb::LiftxE4(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
-  const uint32_t rbn = Instruction::GetData4High(data, 2) + 16;
-  const auto rwm = Instruction::GetData4Low(data, 2);
-  const auto data16 = Instruction::GetData16(data, 4);
+  const uint32_t rbn = Instruction::GetData4High(data) + 16;
+  const auto rwm = Instruction::GetData4Low(data);
+  const auto data16 = Instruction::GetData16(data);
 
   BN::ExprId DstIndAddr;
   uint32_t seg8, pag10;
@@ -2003,7 +1980,7 @@ bool Movb::LiftxE4(const uint8_t *data, const uint64_t addr, size_t &len,
     DstIndAddr =
         Instruction::GetIndAddrExpr_Extp_Rw_data16(il, pag10, rwm, data16);
   } else {
-    DstIndAddr = Instruction::GetIndAddrExpr_Rw_data16(il, rwm, data16);
+    DstIndAddr = Instruction::GetIndAddrExpr_Rw_data16(il, addr, rwm, data16);
   }
 
   il.AddInstruction(il.Store(1, DstIndAddr, il.Register(1, rbn), flags));
@@ -2018,8 +1995,8 @@ bool Movb::LiftxE4(const uint8_t *data, const uint64_t addr, size_t &len,
 // Format: E9 nm
 bool Movb::LiftxE9(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   BN::ExprId DstIndAddr, SrcIndAddr;
   uint32_t seg8, pag10;
@@ -2031,8 +2008,8 @@ bool Movb::LiftxE9(const uint8_t *data, const uint64_t addr, size_t &len,
     DstIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwn);
     SrcIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwm);
   } else {
-    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwn);
-    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwm);
+    DstIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwn);
+    SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwm);
   }
 
   il.AddInstruction(il.Store(1, DstIndAddr, il.Load(1, SrcIndAddr), flags));
@@ -2047,8 +2024,8 @@ bool Movb::LiftxE9(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Movb::LiftxE1(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
-  const uint32_t rbn = Instruction::GetData4Low(data, 2) + 16;
-  const auto data4 = Instruction::GetData4High(data, 2);
+  const uint32_t rbn = Instruction::GetData4Low(data) + 16;
+  const auto data4 = Instruction::GetData4High(data);
 
   il.AddInstruction(il.SetRegister(1, rbn, il.Const(1, data4), flags));
 
@@ -2061,15 +2038,15 @@ bool Movb::LiftxE1(const uint8_t *data, const uint64_t addr, size_t &len,
 bool Movb::LiftxE7(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
   auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, len));
-  const auto data8 = Instruction::GetData8Low(data, 4);
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
+  const auto data8 = Instruction::GetData8Low(data);
 
   if (reg <= 0xF) {
     reg += 16;
     il.AddInstruction(il.SetRegister(1, reg, il.Const(1, data8), flags));
   } else {
     il.AddInstruction(
-        il.Store(2, il.ConstPointer(3, reg), il.Const(1, data8), flags));
+        Instruction::StoreDirect(il, 1, reg, il.Const(1, data8), flags));
   }
 
   len = 4;
@@ -2080,8 +2057,8 @@ bool Movb::LiftxE7(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Movb::LiftxF1(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, 2) + 16;
-  const auto rwm = Instruction::GetData4Low(data, 2) + 16;
+  const auto rwn = Instruction::GetData4High(data) + 16;
+  const auto rwm = Instruction::GetData4Low(data) + 16;
 
   il.AddInstruction(il.SetRegister(1, rwn, il.Register(1, rwm), flags));
 
@@ -2094,16 +2071,16 @@ bool Movb::LiftxF1(const uint8_t *data, const uint64_t addr, size_t &len,
 bool Movb::LiftxF3(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
   uint32_t reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, len));
-  const auto mem = Instruction::GetMem(addr, data, len);
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
+  const auto mem = Instruction::GetMem(addr, data);
 
   if (reg <= 0xF) {
     reg += 16;
     il.AddInstruction(
-        il.SetRegister(1, reg, il.Load(1, il.ConstPointer(3, mem)), flags));
+        il.SetRegister(1, reg, Instruction::LoadDirect(il, 1, mem), flags));
   } else {
-    il.AddInstruction(il.Store(1, il.ConstPointer(3, reg),
-                               il.Load(1, il.ConstPointer(3, mem)), flags));
+    il.AddInstruction(Instruction::StoreDirect(
+        il, 1, reg, Instruction::LoadDirect(il, 1, mem), flags));
   }
 
   len = 4;
@@ -2116,9 +2093,9 @@ bool Movb::LiftxF3(const uint8_t *data, const uint64_t addr, size_t &len,
 // Format: F4 nm ## ##
 bool Movb::LiftxF4(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
-  const uint32_t rbn = Instruction::GetData4High(data, 2) + 16;
-  const auto rwm = Instruction::GetData4Low(data, 2);
-  const auto data16 = Instruction::GetData16(data, 4);
+  const uint32_t rbn = Instruction::GetData4High(data) + 16;
+  const auto rwm = Instruction::GetData4Low(data);
+  const auto data16 = Instruction::GetData16(data);
 
   BN::ExprId SrcIndAddr;
   uint32_t seg8, pag10;
@@ -2129,7 +2106,7 @@ bool Movb::LiftxF4(const uint8_t *data, const uint64_t addr, size_t &len,
     SrcIndAddr =
         Instruction::GetIndAddrExpr_Extp_Rw_data16(il, pag10, rwm, data16);
   } else {
-    SrcIndAddr = Instruction::GetIndAddrExpr_Rw_data16(il, rwm, data16);
+    SrcIndAddr = Instruction::GetIndAddrExpr_Rw_data16(il, addr, rwm, data16);
   }
 
   il.AddInstruction(il.SetRegister(1, rbn, il.Load(1, SrcIndAddr), flags));
@@ -2142,17 +2119,17 @@ bool Movb::LiftxF4(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Movb::LiftxF7(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
-  const auto mem = Instruction::GetMem(addr, data, len);
+  const auto mem = Instruction::GetMem(addr, data);
   uint32_t reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, len));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
 
   if (reg <= 0xF) {
     reg += 16;
     il.AddInstruction(
-        il.Store(1, il.ConstPointer(3, mem), il.Register(1, reg), flags));
+        Instruction::StoreDirect(il, 1, mem, il.Register(1, reg), flags));
   } else {
-    il.AddInstruction(il.Store(1, il.ConstPointer(3, mem),
-                               Instruction::ElideReg(il, reg, 1), flags));
+    il.AddInstruction(Instruction::StoreDirect(
+        il, 1, mem, Instruction::ElideReg(il, reg, 1), flags));
   }
 
   len = 4;
@@ -2163,11 +2140,11 @@ bool Movb::LiftxF7(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Movbs::LiftxD0(const uint8_t *data, const uint64_t addr, size_t &len,
                     BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4Low(data, 2);
-  const auto rbm = Instruction::GetData4High(data, 2) + 16;
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto rbm = Instruction::GetData4High(data) + 16;
 
   il.AddInstruction(
-      il.SetRegister(2, rwn, il.SignExtend(2, il.Register(1, rbm)), flags));
+      il.SetRegister(2, rwn, il.SignExtend(2, il.Register(1, rbm), flags)));
 
   len = 2;
   UpdateExtSequence(addr, len);
@@ -2178,16 +2155,16 @@ bool Movbs::LiftxD0(const uint8_t *data, const uint64_t addr, size_t &len,
 bool Movbs::LiftxD2(const uint8_t *data, const uint64_t addr, size_t &len,
                     BN::LowLevelILFunction &il) {
   const auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, len));
-  const auto mem = Instruction::GetMem(addr, data, len);
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
+  const auto mem = Instruction::GetMem(addr, data);
 
   if (reg <= 0xF) {
     il.AddInstruction(il.SetRegister(
-        2, reg, il.SignExtend(2, il.Load(1, il.ConstPointer(3, mem))), flags));
+        2, reg, il.SignExtend(2, Instruction::LoadDirect(il, 1, mem), flags)));
   } else {
-    il.AddInstruction(
-        il.Store(2, il.ConstPointer(3, reg),
-                 il.SignExtend(2, il.Load(1, il.ConstPointer(3, mem))), flags));
+    il.AddInstruction(Instruction::StoreDirect(
+        il, 2, reg,
+        il.SignExtend(2, Instruction::LoadDirect(il, 1, mem), flags)));
   }
 
   len = 4;
@@ -2198,18 +2175,18 @@ bool Movbs::LiftxD2(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Movbs::LiftxD5(const uint8_t *data, const uint64_t addr, size_t &len,
                     BN::LowLevelILFunction &il) {
-  const auto mem = Instruction::GetMem(addr, data, len);
+  const auto mem = Instruction::GetMem(addr, data);
   uint32_t reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, len));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
 
   if (reg <= 0xF) {
     reg += 16;
-    il.AddInstruction(il.Store(2, il.ConstPointer(3, mem),
-                               il.SignExtend(2, il.Register(1, reg)), flags));
+    il.AddInstruction(Instruction::StoreDirect(
+        il, 2, mem, il.SignExtend(2, il.Register(1, reg), flags)));
   } else {
-    il.AddInstruction(
-        il.Store(2, il.ConstPointer(3, mem),
-                 il.SignExtend(2, il.Load(1, il.ConstPointer(3, reg))), flags));
+    il.AddInstruction(Instruction::StoreDirect(
+        il, 2, mem,
+        il.SignExtend(2, Instruction::LoadDirect(il, 1, reg), flags)));
   }
 
   len = 4;
@@ -2220,11 +2197,11 @@ bool Movbs::LiftxD5(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Movbz::LiftxC0(const uint8_t *data, const uint64_t addr, size_t &len,
                     BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4Low(data, 2);
-  const auto rbm = Instruction::GetData4High(data, 2) + 16;
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto rbm = Instruction::GetData4High(data) + 16;
 
   il.AddInstruction(
-      il.SetRegister(2, rwn, il.ZeroExtend(2, il.Register(1, rbm)), flags));
+      il.SetRegister(2, rwn, il.ZeroExtend(2, il.Register(1, rbm), flags)));
 
   len = 2;
   UpdateExtSequence(addr, len);
@@ -2235,16 +2212,16 @@ bool Movbz::LiftxC0(const uint8_t *data, const uint64_t addr, size_t &len,
 bool Movbz::LiftxC2(const uint8_t *data, const uint64_t addr, size_t &len,
                     BN::LowLevelILFunction &il) {
   const auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, len));
-  const auto mem = Instruction::GetMem(addr, data, len);
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
+  const auto mem = Instruction::GetMem(addr, data);
 
   if (reg <= 0xF) {
     il.AddInstruction(il.SetRegister(
-        2, reg, il.ZeroExtend(2, il.Load(1, il.ConstPointer(3, mem))), flags));
+        2, reg, il.ZeroExtend(2, Instruction::LoadDirect(il, 1, mem), flags)));
   } else {
-    il.AddInstruction(
-        il.Store(2, il.ConstPointer(3, reg),
-                 il.ZeroExtend(2, il.Load(1, il.ConstPointer(3, mem))), flags));
+    il.AddInstruction(Instruction::StoreDirect(
+        il, 2, reg,
+        il.ZeroExtend(2, Instruction::LoadDirect(il, 1, mem), flags)));
   }
 
   len = 4;
@@ -2255,18 +2232,18 @@ bool Movbz::LiftxC2(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Movbz::LiftxC5(const uint8_t *data, const uint64_t addr, size_t &len,
                     BN::LowLevelILFunction &il) {
-  const auto mem = Instruction::GetMem(addr, data, len);
+  const auto mem = Instruction::GetMem(addr, data);
   uint32_t reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, len));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
 
   if (reg <= 0xF) {
     reg += 16;
-    il.AddInstruction(il.Store(2, il.ConstPointer(3, mem),
-                               il.ZeroExtend(2, il.Register(1, reg)), flags));
+    il.AddInstruction(Instruction::StoreDirect(
+        il, 2, mem, il.ZeroExtend(2, il.Register(1, reg), flags)));
   } else {
-    il.AddInstruction(
-        il.Store(2, il.ConstPointer(3, mem),
-                 il.ZeroExtend(2, il.Load(1, il.ConstPointer(3, reg))), flags));
+    il.AddInstruction(Instruction::StoreDirect(
+        il, 2, mem,
+        il.ZeroExtend(2, Instruction::LoadDirect(il, 1, reg), flags)));
   }
 
   len = 4;
@@ -2277,13 +2254,13 @@ bool Movbz::LiftxC5(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Mul::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, length);
-  const auto rwm = Instruction::GetData4Low(data, length);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
-  il.AddInstruction(
-      il.Store(4, il.ConstPointer(3, Sfr::MD),
-               il.MultDoublePrecSigned(4, il.Register(2, rwn),
-                                       il.Register(2, rwm), flags)));
+  il.AddInstruction(il.SetRegister(
+      4, Registers::MD,
+      il.MultDoublePrecSigned(4, il.Register(2, rwn), il.Register(2, rwm),
+                              flags)));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -2293,13 +2270,13 @@ bool Mul::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Mulu::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                 BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, length);
-  const auto rwm = Instruction::GetData4Low(data, length);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
-  il.AddInstruction(
-      il.Store(4, il.ConstPointer(3, Sfr::MD),
-               il.MultDoublePrecUnsigned(4, il.Register(2, rwn),
-                                         il.Register(2, rwm), flags)));
+  il.AddInstruction(il.SetRegister(
+      4, Registers::MD,
+      il.MultDoublePrecUnsigned(4, il.Register(2, rwn), il.Register(2, rwm),
+                                flags)));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -2309,7 +2286,7 @@ bool Mulu::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Neg::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, length);
+  const auto rwn = Instruction::GetData4High(data);
 
   il.AddInstruction(
       il.SetRegister(2, rwn, il.Neg(2, il.Register(2, rwn), flags)));
@@ -2322,7 +2299,7 @@ bool Neg::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Negb::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                 BN::LowLevelILFunction &il) {
-  const uint32_t rbn = Instruction::GetData4High(data, length) + 16;
+  const uint32_t rbn = Instruction::GetData4High(data) + 16;
 
   il.AddInstruction(
       il.SetRegister(1, rbn, il.Neg(1, il.Register(1, rbn), flags)));
@@ -2346,31 +2323,31 @@ bool Or::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
       len = 2;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRnRm(data, len, 2, flags, true, il,
+      return Instruction::LiftOpRnRm(data, 2, flags, true, il,
                                      IL_OP(BN::LowLevelILFunction::Or));
     case Opcodes::OR_RWN_RWI_DATA3:
       len = 2;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRnRwiData3(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpRnRwiData3(addr, data, 2, flags, true, il,
                                            IL_OP(BN::LowLevelILFunction::Or));
     case Opcodes::OR_REG_DATA16:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRegData(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpRegData(addr, data, 2, flags, true, il,
                                         IL_OP(BN::LowLevelILFunction::Or));
     case Opcodes::OR_REG_MEM:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRegMem(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpRegMem(addr, data, 2, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::Or));
     case Opcodes::OR_MEM_REG:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpMemReg(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpMemReg(addr, data, 2, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::Or));
     default:
       BN::LogError("0x%lx: Or::%s received invalid opcode: 0x%x", addr,
@@ -2386,31 +2363,31 @@ bool Orb::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
       len = 2;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRnRm(data, len, 1, flags, true, il,
+      return Instruction::LiftOpRnRm(data, 1, flags, true, il,
                                      IL_OP(BN::LowLevelILFunction::Or));
     case Opcodes::ORB_RBN_RWI_DATA3:
       len = 2;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRnRwiData3(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpRnRwiData3(addr, data, 1, flags, true, il,
                                            IL_OP(BN::LowLevelILFunction::Or));
     case Opcodes::ORB_REG_DATA8:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRegData(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpRegData(addr, data, 1, flags, true, il,
                                         IL_OP(BN::LowLevelILFunction::Or));
     case Opcodes::ORB_REG_MEM:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRegMem(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpRegMem(addr, data, 1, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::Or));
     case Opcodes::ORB_MEM_REG:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpMemReg(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpMemReg(addr, data, 1, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::Or));
     default:
       BN::LogError("0x%lx: Orb::%s received invalid opcode: 0x%x", addr,
@@ -2419,14 +2396,34 @@ bool Orb::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
   }
 }
 
+// PCALL reg, caddr
+// Format: E2 RR MM MM
+bool Pcall::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
+                 BN::LowLevelILFunction &il) {
+  const auto reg = Instruction::TranslateReg(
+      addr, Formats::Get<Formats::RegCaddr::reg>(data));
+
+  if (reg <= 0xF) {
+    PushSystem(il, il.Register(2, reg));
+  } else {
+    PushSystem(il, Instruction::LoadDirect(il, 2, reg));
+  }
+  LiftCall(il, addr + length, il.ConstPointer(3, GetTarget(data, addr)));
+
+  len = length;
+  UpdateExtSequence(addr, len);
+
+  return true;
+}
+
 bool Pop::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                BN::LowLevelILFunction &il) {
   const auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, len));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
   if (reg <= 0xF) {
     il.AddInstruction(il.SetRegister(2, reg, il.Pop(2), flags));
   } else {
-    il.AddInstruction(il.Store(2, il.ConstPointer(3, reg), il.Pop(2), flags));
+    il.AddInstruction(Instruction::StoreDirect(il, 2, reg, il.Pop(2), flags));
   }
 
   len = length;
@@ -2438,11 +2435,11 @@ bool Pop::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 bool Push::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                 BN::LowLevelILFunction &il) {
   const auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, len));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
   if (reg <= 0xF) {
     il.AddInstruction(il.Push(2, il.Register(2, reg), flags));
   } else {
-    il.AddInstruction(il.Push(2, il.Load(2, il.Const(3, reg)), flags));
+    il.AddInstruction(il.Push(2, Instruction::LoadDirect(il, 2, reg), flags));
   }
 
   len = length;
@@ -2453,14 +2450,22 @@ bool Push::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Prior::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                  BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, length);
-  const auto rwm = Instruction::GetData4Low(data, length);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
-  std::vector<BN::RegisterOrFlag> out = {BN::RegisterOrFlag::Register(rwn)};
+  const std::vector<BN::RegisterOrFlag> out = {
+      BN::RegisterOrFlag::Register(rwn)};
   const std::vector<BN::ExprId> in = {il.Register(2, rwm)};
 
-  //        il.AddInstruction(il.Intrinsic(out, 0, in, flags));
-  il.AddInstruction(il.SetRegister(2, rwn, il.Unimplemented(), flags));
+  // Z is set for a zero source; the flags go first as Rwn may be Rwm
+  il.AddInstruction(il.SetFlag(Flags::FLAG_E, il.Const(0, 0)));
+  il.AddInstruction(il.SetFlag(
+      Flags::FLAG_ZERO,
+      il.CompareEqual(2, il.Register(2, rwm), il.Const(2, 0))));
+  il.AddInstruction(il.SetFlag(Flags::FLAG_OVERFLOW, il.Const(0, 0)));
+  il.AddInstruction(il.SetFlag(Flags::FLAG_CARRY, il.Const(0, 0)));
+  il.AddInstruction(il.SetFlag(Flags::FLAG_NEGATIVE, il.Const(0, 0)));
+  il.AddInstruction(il.Intrinsic(out, Intrinsics::PRIOR, in));
 
   len = length;
   UpdateExtSequence(addr, len);
@@ -2471,40 +2476,58 @@ bool Prior::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
 bool Pwrdn::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                  BN::LowLevelILFunction &il) {
   UpdateExtSequence(addr, length);
+  il.AddInstruction(il.Intrinsic({}, Intrinsics::PWRDN, {}));
   NO_RETURN(length);
 }
 
+// The pops mirror the pushes of the matching call: IP (LiftCall), then CSP
+// (CALLS, TRAP), PSW (TRAP) or the PCALL operand
 bool Ret::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                BN::LowLevelILFunction &il) {
   UpdateExtSequence(addr, length);
-  STACK_RETURN(length);
+  PopSystem(il, LLIL_TEMP(0));  // IP
+  STACK_RETURN(length, GetReturnAddress(il, addr, false));
 }
 
+// Pops IP, CSP and PSW, as in segmented mode
 bool Reti::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                 BN::LowLevelILFunction &il) {
   UpdateExtSequence(addr, length);
-  STACK_RETURN(length);
+  PopSystem(il, LLIL_TEMP(0));  // IP
+  PopSystem(il, Sfr::CSP);
+  PopSystem(il, Sfr::PSW);
+  STACK_RETURN(length, GetReturnAddress(il, addr, true));
 }
 
+// RETP reg
+// Format: EB RR
 bool Retp::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                 BN::LowLevelILFunction &il) {
+  const auto reg = Instruction::TranslateReg(
+      addr, Instruction::GetRegShortAddr(data));
+
   UpdateExtSequence(addr, length);
-  STACK_RETURN(length);
+  PopSystem(il, LLIL_TEMP(0));  // IP
+  PopSystem(il, reg, flags);
+  STACK_RETURN(length, GetReturnAddress(il, addr, false));
 }
 
 bool Rets::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                 BN::LowLevelILFunction &il) {
   UpdateExtSequence(addr, length);
-  STACK_RETURN(length);
+  PopSystem(il, LLIL_TEMP(0));  // IP
+  PopSystem(il, Sfr::CSP);
+  STACK_RETURN(length, GetReturnAddress(il, addr, true));
 }
 
 bool Rol::Liftx0C(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, length);
-  const auto rwm = Instruction::GetData4Low(data, length);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   il.AddInstruction(il.SetRegister(
-      2, rwn, il.RotateLeft(2, il.Register(2, rwn), il.Register(2, rwm)),
+      2, rwn, il.RotateLeft(2, il.Register(2, rwn),
+                     il.And(2, il.Register(2, rwm), il.Const(2, 0xF))),
       flags));
 
   len = length;
@@ -2515,8 +2538,8 @@ bool Rol::Liftx0C(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Rol::Liftx1C(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4Low(data, length);
-  const auto data4 = Instruction::GetData4High(data, length);
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto data4 = Instruction::GetData4High(data);
 
   il.AddInstruction(il.SetRegister(
       2, rwn, il.RotateLeft(2, il.Register(2, rwn), il.Const(1, data4)),
@@ -2530,11 +2553,12 @@ bool Rol::Liftx1C(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Ror::Liftx2C(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, length);
-  const auto rwm = Instruction::GetData4Low(data, length);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   il.AddInstruction(il.SetRegister(
-      2, rwn, il.RotateRight(2, il.Register(2, rwn), il.Register(2, rwm)),
+      2, rwn, il.RotateRight(2, il.Register(2, rwn),
+                     il.And(2, il.Register(2, rwm), il.Const(2, 0xF))),
       flags));
 
   len = length;
@@ -2545,8 +2569,8 @@ bool Ror::Liftx2C(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Ror::Liftx3C(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4Low(data, length);
-  const auto data4 = Instruction::GetData4High(data, length);
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto data4 = Instruction::GetData4High(data);
 
   il.AddInstruction(il.SetRegister(
       2, rwn, il.RotateRight(2, il.Register(2, rwn), il.Const(1, data4)),
@@ -2561,16 +2585,16 @@ bool Ror::Liftx3C(const uint8_t *data, const uint64_t addr, size_t &len,
 bool Scxt::LiftxC6(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
   const auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, len));
-  const auto data16 = Instruction::GetData16(data, len);
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
+  const auto data16 = Instruction::GetData16(data);
 
   if (reg <= 0xF) {
     il.AddInstruction(il.Push(2, il.Register(2, reg)));
     il.AddInstruction(il.SetRegister(2, reg, il.Const(2, data16)));
   } else {
-    il.AddInstruction(il.Push(2, il.Load(2, il.Const(3, reg))));
+    il.AddInstruction(il.Push(2, Instruction::LoadDirect(il, 2, reg)));
     il.AddInstruction(
-        il.Store(2, il.ConstPointer(3, reg), il.Const(2, data16)));
+        Instruction::StoreDirect(il, 2, reg, il.Const(2, data16)));
   }
 
   len = length;
@@ -2582,18 +2606,17 @@ bool Scxt::LiftxC6(const uint8_t *data, const uint64_t addr, size_t &len,
 bool Scxt::LiftxD6(const uint8_t *data, const uint64_t addr, size_t &len,
                    BN::LowLevelILFunction &il) {
   const auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, len));
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, length));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
 
   if (reg <= 0xF) {
     il.AddInstruction(il.Push(2, il.Register(2, reg)));
     il.AddInstruction(
-        il.SetRegister(2, reg, il.Load(2, il.ConstPointer(3, mem))));
+        il.SetRegister(2, reg, Instruction::LoadDirect(il, 2, mem)));
   } else {
-    il.AddInstruction(il.Push(2, il.Load(2, il.Const(3, reg))));
-    il.AddInstruction(il.Store(2, il.ConstPointer(3, reg),
-                               il.Load(2, il.ConstPointer(3, mem))));
+    il.AddInstruction(il.Push(2, Instruction::LoadDirect(il, 2, reg)));
+    il.AddInstruction(Instruction::StoreDirect(
+        il, 2, reg, Instruction::LoadDirect(il, 2, mem)));
   }
 
   len = length;
@@ -2604,11 +2627,12 @@ bool Scxt::LiftxD6(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Shl::Liftx4C(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, length);
-  const auto rwm = Instruction::GetData4Low(data, length);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   il.AddInstruction(il.SetRegister(
-      2, rwn, il.ShiftLeft(2, il.Register(2, rwn), il.Register(2, rwm)),
+      2, rwn, il.ShiftLeft(2, il.Register(2, rwn),
+                     il.And(2, il.Register(2, rwm), il.Const(2, 0xF))),
       flags));
 
   len = length;
@@ -2619,8 +2643,8 @@ bool Shl::Liftx4C(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Shl::Liftx5C(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4Low(data, length);
-  const auto data4 = Instruction::GetData4High(data, length);
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto data4 = Instruction::GetData4High(data);
 
   il.AddInstruction(il.SetRegister(
       2, rwn, il.ShiftLeft(2, il.Register(2, rwn), il.Const(1, data4)), flags));
@@ -2633,11 +2657,12 @@ bool Shl::Liftx5C(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Shr::Liftx6C(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4High(data, length);
-  const auto rwm = Instruction::GetData4Low(data, length);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   il.AddInstruction(il.SetRegister(
-      2, rwn, il.LogicalShiftRight(2, il.Register(2, rwn), il.Register(2, rwm)),
+      2, rwn, il.LogicalShiftRight(2, il.Register(2, rwn),
+                     il.And(2, il.Register(2, rwm), il.Const(2, 0xF))),
       flags));
 
   len = length;
@@ -2648,8 +2673,8 @@ bool Shr::Liftx6C(const uint8_t *data, const uint64_t addr, size_t &len,
 
 bool Shr::Liftx7C(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
-  const auto rwn = Instruction::GetData4Low(data, length);
-  const auto data4 = Instruction::GetData4High(data, length);
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto data4 = Instruction::GetData4High(data);
 
   il.AddInstruction(il.SetRegister(
       2, rwn, il.LogicalShiftRight(2, il.Register(2, rwn), il.Const(1, data4)),
@@ -2664,47 +2689,50 @@ bool Shr::Liftx7C(const uint8_t *data, const uint64_t addr, size_t &len,
 bool Srst::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                 BN::LowLevelILFunction &il) {
   UpdateExtSequence(addr, length);
+  il.AddInstruction(il.Intrinsic({}, Intrinsics::SRST, {}));
   NO_RETURN(length);
 }
 
 bool Srvwdt::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                   BN::LowLevelILFunction &il) {
   UpdateExtSequence(addr, length);
-  UNIMPLEMENTED(length);
+  INTRINSIC(Intrinsics::SRVWDT, length);
 }
 
 bool Sub::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
                size_t &len, BN::LowLevelILFunction &il) {
+  if (LiftLongArith(data, addr, len, il)) return true;
+
   switch (op) {
     case Opcodes::SUB_RWN_RWM:
       len = 2;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRnRm(data, len, 2, flags, true, il,
+      return Instruction::LiftOpRnRm(data, 2, flags, true, il,
                                      IL_OP(BN::LowLevelILFunction::Sub));
     case Opcodes::SUB_RWN_RWI_DATA3:
       len = 2;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRnRwiData3(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpRnRwiData3(addr, data, 2, flags, true, il,
                                            IL_OP(BN::LowLevelILFunction::Sub));
     case Opcodes::SUB_REG_DATA16:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRegData(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpRegData(addr, data, 2, flags, true, il,
                                         IL_OP(BN::LowLevelILFunction::Sub));
     case Opcodes::SUB_REG_MEM:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRegMem(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpRegMem(addr, data, 2, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::Sub));
     case Opcodes::SUB_MEM_REG:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpMemReg(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpMemReg(addr, data, 2, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::Sub));
     default:
       BN::LogError("0x%lx: Sub::%s received invalid opcode: 0x%x", addr,
@@ -2720,31 +2748,31 @@ bool Subb::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
       len = 2;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRnRm(data, len, 1, flags, true, il,
+      return Instruction::LiftOpRnRm(data, 1, flags, true, il,
                                      IL_OP(BN::LowLevelILFunction::Sub));
     case Opcodes::SUBB_RBN_RWI_DATA3:
       len = 2;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRnRwiData3(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpRnRwiData3(addr, data, 1, flags, true, il,
                                            IL_OP(BN::LowLevelILFunction::Sub));
     case Opcodes::SUBB_REG_DATA8:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRegData(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpRegData(addr, data, 1, flags, true, il,
                                         IL_OP(BN::LowLevelILFunction::Sub));
     case Opcodes::SUBB_REG_MEM:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRegMem(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpRegMem(addr, data, 1, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::Sub));
     case Opcodes::SUBB_MEM_REG:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpMemReg(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpMemReg(addr, data, 1, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::Sub));
     default:
       BN::LogError("0x%lx: Subb::%s received invalid opcode: 0x%x", addr,
@@ -2755,38 +2783,37 @@ bool Subb::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
 
 bool Subc::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
                 size_t &len, BN::LowLevelILFunction &il) {
-  // TODO: Handle carry
   switch (op) {
     case Opcodes::SUBC_RWN_RWM:
       len = 2;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRnRm(data, len, 2, flags, true, il,
-                                     IL_OP(BN::LowLevelILFunction::Sub));
+      return Instruction::LiftOpRnRm(data, 2, flags, true, il,
+                                     IL_CARRY_OP(SubBorrow));
     case Opcodes::SUBC_RWN_RWI_DATA3:
       len = 2;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRnRwiData3(addr, data, len, 2, flags, true, il,
-                                           IL_OP(BN::LowLevelILFunction::Sub));
+      return Instruction::LiftOpRnRwiData3(addr, data, 2, flags, true, il,
+                                           IL_CARRY_OP(SubBorrow));
     case Opcodes::SUBC_REG_DATA16:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRegData(addr, data, len, 2, flags, true, il,
-                                        IL_OP(BN::LowLevelILFunction::Sub));
+      return Instruction::LiftOpRegData(addr, data, 2, flags, true, il,
+                                        IL_CARRY_OP(SubBorrow));
     case Opcodes::SUBC_REG_MEM:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRegMem(addr, data, len, 2, flags, true, il,
-                                       IL_OP(BN::LowLevelILFunction::Sub));
+      return Instruction::LiftOpRegMem(addr, data, 2, flags, true, il,
+                                       IL_CARRY_OP(SubBorrow));
     case Opcodes::SUBC_MEM_REG:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpMemReg(addr, data, len, 2, flags, true, il,
-                                       IL_OP(BN::LowLevelILFunction::Sub));
+      return Instruction::LiftOpMemReg(addr, data, 2, flags, true, il,
+                                       IL_CARRY_OP(SubBorrow));
     default:
       BN::LogError("0x%lx: Subc::%s received invalid opcode: 0x%x", addr,
                    __func__, op);
@@ -2801,32 +2828,32 @@ bool Subcb::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
       len = 2;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRnRm(data, len, 1, flags, true, il,
-                                     IL_OP(BN::LowLevelILFunction::Sub));
+      return Instruction::LiftOpRnRm(data, 1, flags, true, il,
+                                     IL_CARRY_OP(SubBorrow));
     case Opcodes::SUBCB_RBN_RWI_DATA3:
       len = 2;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRnRwiData3(addr, data, len, 1, flags, true, il,
-                                           IL_OP(BN::LowLevelILFunction::Sub));
+      return Instruction::LiftOpRnRwiData3(addr, data, 1, flags, true, il,
+                                           IL_CARRY_OP(SubBorrow));
     case Opcodes::SUBCB_REG_DATA8:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRegData(addr, data, len, 1, flags, true, il,
-                                        IL_OP(BN::LowLevelILFunction::Sub));
+      return Instruction::LiftOpRegData(addr, data, 1, flags, true, il,
+                                        IL_CARRY_OP(SubBorrow));
     case Opcodes::SUBCB_REG_MEM:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRegMem(addr, data, len, 1, flags, true, il,
-                                       IL_OP(BN::LowLevelILFunction::Sub));
+      return Instruction::LiftOpRegMem(addr, data, 1, flags, true, il,
+                                       IL_CARRY_OP(SubBorrow));
     case Opcodes::SUBCB_MEM_REG:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpMemReg(addr, data, len, 1, flags, true, il,
-                                       IL_OP(BN::LowLevelILFunction::Sub));
+      return Instruction::LiftOpMemReg(addr, data, 1, flags, true, il,
+                                       IL_CARRY_OP(SubBorrow));
     default:
       BN::LogError("0x%lx: Subcb::%s received invalid opcode: 0x%x", addr,
                    __func__, op);
@@ -2834,10 +2861,22 @@ bool Subcb::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
   }
 }
 
+// TRAP #trap7
+// Format: 9B tt (tt = trap7 << 1)
+// The vector slot holds code (usually a JMPS to the handler), so the trap is a
+// call to the slot itself. PSW and CSP are saved as in segmented mode, and
+// CSP is cleared as the vector table is in segment 0.
 bool Trap::Lift(const uint8_t *data, const uint64_t addr, size_t &len,
                 BN::LowLevelILFunction &il) {
-  UpdateExtSequence(addr, length);
-  UNIMPLEMENTED(length);
+  PushSystem(il, il.Register(2, Registers::PSW));
+  PushSystem(il, il.Register(2, Registers::CSP));
+  il.AddInstruction(il.SetRegister(2, Registers::CSP, il.Const(2, 0)));
+  LiftCall(il, addr + length, il.ConstPointer(3, GetTarget(data)));
+
+  len = length;
+  UpdateExtSequence(addr, len);
+
+  return true;
 }
 
 bool Xor::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
@@ -2847,31 +2886,31 @@ bool Xor::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
       len = 2;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRnRm(data, len, 2, flags, true, il,
+      return Instruction::LiftOpRnRm(data, 2, flags, true, il,
                                      IL_OP(BN::LowLevelILFunction::Xor));
     case Opcodes::XOR_RWN_RWI_DATA3:
       len = 2;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRnRwiData3(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpRnRwiData3(addr, data, 2, flags, true, il,
                                            IL_OP(BN::LowLevelILFunction::Xor));
     case Opcodes::XOR_REG_DATA16:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRegData(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpRegData(addr, data, 2, flags, true, il,
                                         IL_OP(BN::LowLevelILFunction::Xor));
     case Opcodes::XOR_REG_MEM:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRegMem(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpRegMem(addr, data, 2, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::Xor));
     case Opcodes::XOR_MEM_REG:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpMemReg(addr, data, len, 2, flags, true, il,
+      return Instruction::LiftOpMemReg(addr, data, 2, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::Xor));
     default:
       BN::LogError("0x%lx: Xor::%s received invalid opcode: 0x%x", addr,
@@ -2887,31 +2926,31 @@ bool Xorb::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
       len = 2;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRnRm(data, len, 1, flags, true, il,
+      return Instruction::LiftOpRnRm(data, 1, flags, true, il,
                                      IL_OP(BN::LowLevelILFunction::Xor));
     case Opcodes::XORB_RBN_RWI_DATA3:
       len = 2;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRnRwiData3(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpRnRwiData3(addr, data, 1, flags, true, il,
                                            IL_OP(BN::LowLevelILFunction::Xor));
     case Opcodes::XORB_REG_DATA8:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRegData(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpRegData(addr, data, 1, flags, true, il,
                                         IL_OP(BN::LowLevelILFunction::Xor));
     case Opcodes::XORB_REG_MEM:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpRegMem(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpRegMem(addr, data, 1, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::Xor));
     case Opcodes::XORB_MEM_REG:
       len = 4;
       UpdateExtSequence(addr, len);
 
-      return Instruction::LiftOpMemReg(addr, data, len, 1, flags, true, il,
+      return Instruction::LiftOpMemReg(addr, data, 1, flags, true, il,
                                        IL_OP(BN::LowLevelILFunction::Xor));
     default:
       BN::LogError("0x%lx: Xorb::%s received invalid opcode: 0x%x", addr,
@@ -2919,4 +2958,20 @@ bool Xorb::Lift(const uint8_t op, const uint8_t *data, const uint64_t addr,
       return false;
   }
 }
+
+// One instantiation of each variant-dependent handler per registered
+// architecture, see CorePluginInit
+#define INSTANTIATE_VARIANT(V)                                              \
+  template bool Mov::Liftx88<V>(const uint8_t *, uint64_t, size_t &,        \
+                                BN::LowLevelILFunction &);                  \
+  template bool Mov::Liftx98<V>(const uint8_t *, uint64_t, size_t &,        \
+                                BN::LowLevelILFunction &);                  \
+  template bool Movb::Liftx89<V>(const uint8_t *, uint64_t, size_t &,       \
+                                 BN::LowLevelILFunction &);                 \
+  template bool Movb::Liftx99<V>(const uint8_t *, uint64_t, size_t &,       \
+                                 BN::LowLevelILFunction &);
+
+INSTANTIATE_VARIANT(Variants::TC)
+INSTANTIATE_VARIANT(Variants::TVX)
+INSTANTIATE_VARIANT(Variants::V2)
 }  // namespace C166
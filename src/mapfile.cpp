@@ -0,0 +1,289 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "mapfile.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "util.h"
+
+namespace BN = BinaryNinja;
+
+namespace C166 {
+
+MapSection::MapSection() : start(0), size(0), code(false) {}
+
+MapSymbol::MapSymbol() : addr(0) {}
+
+LinkerMap::LinkerMap() : dpp{0, 0, 0, 0}, dpps_known(false) {}
+
+static std::string Trim(const std::string &s) {
+  const size_t first = s.find_first_not_of(" \t\r\n");
+  if (first == std::string::npos) return "";
+  return s.substr(first, s.find_last_not_of(" \t\r\n") - first + 1);
+}
+
+static std::string ToLower(std::string s) {
+  for (char &c : s) c = static_cast<char>(std::tolower(c));
+  return s;
+}
+
+static std::vector<std::string> Tokenize(const std::string &line) {
+  std::vector<std::string> tokens;
+  std::istringstream stream(line);
+  for (std::string token; stream >> token;) tokens.push_back(token);
+  return tokens;
+}
+
+// 0x-prefixed or 'h'-suffixed hexadecimal (as l166 prints it), else decimal
+static bool ParseNumber(const std::string &text, uint64_t &value) {
+  if (text.empty()) return false;
+
+  char *end;
+  const char last = text.back();
+  if (text.size() > 1 && (last == 'h' || last == 'H')) {
+    const std::string digits = text.substr(0, text.size() - 1);
+    value = strtoull(digits.c_str(), &end, 16);
+  } else {
+    value = strtoull(text.c_str(), &end, 0);
+  }
+  return *end == '\0';
+}
+
+// Header cells are matched case-insensitively against the lk166 column names
+static int FindColumn(const std::vector<std::string> &header,
+                      const char *name) {
+  for (size_t i = 0; i < header.size(); i++) {
+    if (header[i].rfind(name, 0) == 0) return static_cast<int>(i);
+  }
+  return -1;
+}
+
+bool MapImport::ParseVxRow(const std::vector<std::string> &header,
+                           const std::vector<std::string> &cells,
+                           LinkerMap &map) {
+  int addr_col = FindColumn(header, "space addr");
+  if (addr_col < 0) addr_col = FindColumn(header, "chip addr");
+  if (addr_col < 0 || addr_col >= static_cast<int>(cells.size())) return false;
+
+  uint64_t addr;
+  if (!ParseNumber(cells[addr_col], addr)) return false;
+
+  const int section_col = FindColumn(header, "section");
+  const int size_col = FindColumn(header, "size");
+  if (section_col >= 0 && size_col >= 0) {
+    if (std::max(section_col, size_col) >= static_cast<int>(cells.size()))
+      return false;
+
+    MapSection section;
+    section.start = addr;
+    if (!ParseNumber(cells[size_col], section.size)) return false;
+
+    // Drop the input section count, e.g. ".text.main (12)"
+    section.name = cells[section_col];
+    const size_t paren = section.name.find(" (");
+    if (paren != std::string::npos) section.name.resize(paren);
+    if (section.name.empty()) return false;
+
+    section.code = section.name.rfind(".text", 0) == 0;
+    map.sections.push_back(section);
+    return true;
+  }
+
+  const int name_col = FindColumn(header, "name");
+  if (name_col < 0 || name_col >= static_cast<int>(cells.size()) ||
+      cells[name_col].empty())
+    return false;
+
+  MapSymbol symbol;
+  symbol.name = cells[name_col];
+  symbol.addr = addr;
+  map.symbols.push_back(symbol);
+  return true;
+}
+
+// Memory map rows start with "start stop length"; symbol table rows with the
+// value, followed by the scope and ending in the name
+bool MapImport::ParseClassicRow(const std::vector<std::string> &tokens,
+                                LinkerMap &map) {
+  const auto is_hex = [](const std::string &token) {
+    uint64_t value;
+    return (token.back() == 'h' || token.back() == 'H') &&
+           ParseNumber(token, value);
+  };
+
+  if (tokens.size() < 3 || !is_hex(tokens[0])) return false;
+
+  uint64_t start, stop, length;
+  if (tokens.size() >= 4 && is_hex(tokens[1]) && is_hex(tokens[2])) {
+    ParseNumber(tokens[0], start);
+    ParseNumber(tokens[1], stop);
+    ParseNumber(tokens[2], length);
+    if (stop < start || stop - start + 1 != length) return false;
+
+    MapSection section;
+    section.name = tokens.back();
+    section.start = start;
+    section.size = length;
+    for (size_t i = 3; i < tokens.size() - 1; i++) {
+      if (tokens[i] == "CODE" || tokens[i].find("PROGRAM") != std::string::npos)
+        section.code = true;
+    }
+    map.sections.push_back(section);
+    return true;
+  }
+
+  for (size_t i = 1; i < tokens.size() - 1; i++) {
+    if (tokens[i] != "PUBLIC" && tokens[i] != "GLOBAL") continue;
+
+    MapSymbol symbol;
+    ParseNumber(tokens[0], symbol.addr);
+    symbol.name = tokens.back();
+    map.symbols.push_back(symbol);
+    return true;
+  }
+
+  return false;
+}
+
+// "DPPn = page" or "DPPn: page"; returns the register number or -1
+int MapImport::ParseDpp(const std::string &line, LinkerMap &map) {
+  std::string text = line;
+  std::replace(text.begin(), text.end(), '=', ' ');
+  std::replace(text.begin(), text.end(), ':', ' ');
+
+  const std::vector<std::string> tokens = Tokenize(text);
+  if (tokens.size() < 2 || tokens[0].size() != 4 ||
+      ToLower(tokens[0].substr(0, 3)) != "dpp" || tokens[0][3] < '0' ||
+      tokens[0][3] > '3')
+    return -1;
+
+  uint64_t page;
+  if (!ParseNumber(tokens[1], page) || page > 0x3FF) return -1;
+
+  const int n = tokens[0][3] - '0';
+  map.dpp[n] = static_cast<uint16_t>(page);
+  return n;
+}
+
+bool MapImport::Load(const std::string &filename, LinkerMap &map) {
+  std::ifstream file(filename);
+  if (!file.is_open()) {
+    BN::LogError("%s: Unable to open %s", __func__, filename.c_str());
+    return false;
+  }
+
+  std::vector<std::string> header;
+  unsigned dpps_seen = 0;
+  std::string line;
+  while (std::getline(file, line)) {
+    line = Trim(line);
+
+    if (line.empty() || line[0] != '|') {
+      header.clear();
+      if (line.empty() || line[0] == '+') continue;
+
+      const int dpp = ParseDpp(line, map);
+      if (dpp >= 0) {
+        dpps_seen |= 1u << dpp;
+      } else {
+        ParseClassicRow(Tokenize(line), map);
+      }
+      continue;
+    }
+
+    // lk166 table row; the header row precedes a "|====|" rule
+    if (line.find("==") != std::string::npos) continue;
+
+    std::vector<std::string> cells;
+    std::istringstream stream(line.substr(1));
+    for (std::string cell; std::getline(stream, cell, '|');)
+      cells.push_back(Trim(cell));
+
+    if (header.empty()) {
+      for (auto &cell : cells) header.push_back(ToLower(cell));
+      continue;
+    }
+    ParseVxRow(header, cells, map);
+  }
+
+  map.dpps_known = dpps_seen == 0xF;
+  return true;
+}
+
+void MapImport::DeriveRanges(const LinkerMap &map,
+                             std::vector<StateRange> &ranges) {
+  if (!map.dpps_known) return;
+
+  for (const auto &section : map.sections) {
+    if (!section.code || !section.size ||
+        section.start + section.size > StateTable::address_limit)
+      continue;
+
+    ranges.push_back({StateRange::Dpp,
+                      section.start,
+                      section.start + section.size - 1,
+                      {map.dpp[0], map.dpp[1], map.dpp[2], map.dpp[3]}});
+  }
+}
+
+void MapImport::Apply(BN::BinaryView *view, const LinkerMap &map) {
+  std::vector<StateRange> ranges;
+  DeriveRanges(map, ranges);
+  if (map.dpps_known) {
+    Instruction::SetDefaultDpps(map.dpp[0], map.dpp[1], map.dpp[2],
+                                map.dpp[3]);
+  }
+  Instruction::ApplyStateRanges(ranges);
+
+  // Sorted [start, end) spans of the code sections, to classify symbols
+  std::vector<std::pair<uint64_t, uint64_t>> code;
+  for (const auto &section : map.sections) {
+    if (!section.size || !view->IsValidOffset(section.start)) continue;
+
+    BNSectionSemantics semantics = ReadWriteDataSectionSemantics;
+    if (section.code) {
+      semantics = ReadOnlyCodeSectionSemantics;
+      code.emplace_back(section.start, section.start + section.size);
+    } else if (section.name.rfind(".rodata", 0) == 0) {
+      semantics = ReadOnlyDataSectionSemantics;
+    }
+    view->AddUserSection(section.name, section.start, section.size, semantics);
+  }
+  std::sort(code.begin(), code.end());
+
+  BN::Ref<BN::Platform> platform = view->GetDefaultPlatform();
+  size_t functions = 0;
+  view->BeginBulkModifySymbols();
+  for (const auto &symbol : map.symbols) {
+    if (!view->IsValidOffset(symbol.addr)) continue;
+
+    // Last span starting at or before the symbol
+    auto it = std::upper_bound(
+        code.begin(), code.end(), symbol.addr,
+        [](uint64_t addr, const auto &span) { return addr < span.first; });
+    const bool is_code = it != code.begin() && symbol.addr < (--it)->second;
+
+    view->DefineUserSymbol(new BN::Symbol(
+        is_code ? FunctionSymbol : DataSymbol, symbol.name, symbol.addr));
+    if (is_code) {
+      view->AddFunctionForAnalysis(platform, symbol.addr);
+      functions++;
+    }
+  }
+  view->EndBulkModifySymbols();
+
+  BN::LogInfo("Imported %zu section(s), %zu symbol(s) (%zu function(s)) and "
+              "%zu DPP range(s)",
+              map.sections.size(), map.symbols.size(), functions,
+              ranges.size());
+}
+}  // namespace C166
@@ -0,0 +1,72 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_MAPFILE_H_
+#define SRC_MAPFILE_H_
+
+#include <binaryninjaapi.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "state.h"
+
+namespace BN = BinaryNinja;
+
+namespace C166 {
+
+class MapSection {
+ public:
+  std::string name;
+  uint64_t start;
+  uint64_t size;
+  bool code;
+
+  MapSection();
+};
+
+class MapSymbol {
+ public:
+  std::string name;
+  uint64_t addr;
+
+  MapSymbol();
+};
+
+// Sections, global symbols and DPP assignments read from a Tasking linker map
+class LinkerMap {
+ public:
+  std::vector<MapSection> sections;
+  std::vector<MapSymbol> symbols;
+  uint16_t dpp[4];
+  bool dpps_known;
+
+  LinkerMap();
+};
+
+// Reads the map files written by the Tasking VX linker (lk166), whose locate
+// and symbol tables are '|'-delimited, and by the classic linker (l166), whose
+// memory map and symbol table are whitespace-delimited with 'h'-suffixed hex
+// values. Lines of the form "DPPn = page" record the linker's DPP assignment.
+// Anything else in the file is ignored.
+class MapImport {
+  static bool ParseVxRow(const std::vector<std::string> &header,
+                         const std::vector<std::string> &cells,
+                         LinkerMap &map);
+  static bool ParseClassicRow(const std::vector<std::string> &tokens,
+                              LinkerMap &map);
+  static int ParseDpp(const std::string &line, LinkerMap &map);
+
+ public:
+  static bool Load(const std::string &filename, LinkerMap &map);
+  // Ranges assigning the linker's DPPs to every code section
+  static void DeriveRanges(const LinkerMap &map,
+                           std::vector<StateRange> &ranges);
+  // Feeds the derived DPP ranges into the instruction state store, then
+  // defines the sections, symbols and functions. Does not start analysis.
+  static void Apply(BN::BinaryView *view, const LinkerMap &map);
+};
+}  // namespace C166
+
+#endif  // SRC_MAPFILE_H_
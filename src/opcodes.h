@@ -323,4 +323,131 @@ constexpr uint8_t XORB_REG_MEM = 0x53;
 constexpr uint8_t XORB_MEM_REG = 0x55;
 }  // namespace C166::Opcodes
 
+/*
+ * Instruction formats
+ *
+ * Each format lists the position of its operand fields within the instruction,
+ * numbered from bit 0 of the opcode byte (i.e. bits 0-15 are the first
+ * little-endian word and bits 16-31 the second). Fields are decoded with
+ * Formats::Get<Format::field>(data), which resolves the bytes, shift and mask
+ * at compile time.
+ */
+namespace C166::Formats {
+struct Field {
+  uint8_t lsb;
+  uint8_t width;
+};
+
+template <Field f>
+constexpr uint32_t Get(const uint8_t* data) {
+  static_assert(f.width > 0 && f.lsb + f.width <= 32, "Invalid field");
+  constexpr unsigned first = f.lsb / 8;
+  constexpr unsigned last = (f.lsb + f.width - 1) / 8;
+  constexpr uint32_t mask = (f.width == 32) ? 0xFFFFFFFFu : (1u << f.width) - 1;
+
+  uint32_t raw = data[first];
+  if constexpr (last > first) raw |= (uint32_t)data[first + 1] << 8u;
+  if constexpr (last > first + 1) raw |= (uint32_t)data[first + 2] << 16u;
+  if constexpr (last > first + 2) raw |= (uint32_t)data[first + 3] << 24u;
+  return (raw >> (f.lsb % 8)) & mask;
+}
+
+/* op nm -- Rwn/Rbn, Rwm/Rbm (also Rwn, #data4 and Rwn, [Rwi + #data3]) */
+struct Rr {
+  static constexpr Field n{12, 4};
+  static constexpr Field m{8, 4};
+  static constexpr Field data4{12, 4};
+  static constexpr Field data3{8, 3};
+  static constexpr Field rwi{8, 2};
+  static constexpr Field mode{10, 2};  // #data3 (0b0x), [Rwi] or [Rwi+]
+};
+
+/* op RR MM MM -- reg, mem */
+struct RegMem {
+  static constexpr Field reg{8, 8};
+  static constexpr Field mem{16, 16};
+};
+
+/* op RR ## ## -- reg, #data16 (#data8 uses the low byte) */
+struct RegData {
+  static constexpr Field reg{8, 8};
+  static constexpr Field data16{16, 16};
+  static constexpr Field data8{16, 8};
+  static constexpr Field data8_high{24, 8};
+};
+
+/* op QQ @@ ## -- BFLDL bitoff, #mask8, #data8 */
+struct BitFieldLow {
+  static constexpr Field bitoff{8, 8};
+  static constexpr Field mask8{16, 8};
+  static constexpr Field data8{24, 8};
+};
+
+/* op QQ ## @@ -- BFLDH bitoff, #mask8, #data8 */
+struct BitFieldHigh {
+  static constexpr Field bitoff{8, 8};
+  static constexpr Field data8{16, 8};
+  static constexpr Field mask8{24, 8};
+};
+
+/* qE/qF QQ -- BCLR/BSET bitoff.q */
+struct BitShort {
+  static constexpr Field bitpos{4, 4};
+  static constexpr Field bitoff{8, 8};
+};
+
+/* op QQ ZZ qz -- BAND/BCMP/BMOV/BMOVN/BOR/BXOR bitoffZ.z, bitoffQ.q */
+struct BitBit {
+  static constexpr Field qq{8, 8};
+  static constexpr Field zz{16, 8};
+  static constexpr Field z{24, 4};
+  static constexpr Field q{28, 4};
+};
+
+/* op QQ rr q0 -- JB/JBC/JNB/JNBS bitaddrQ.q, rel */
+struct BitRel {
+  static constexpr Field bitoff{8, 8};
+  static constexpr Field rel{16, 8};
+  static constexpr Field bitpos{28, 4};
+};
+
+/* cD rr -- JMPR cc, rel (CALLR only has rel) */
+struct CondRel {
+  static constexpr Field cc{4, 4};
+  static constexpr Field rel{8, 8};
+};
+
+/* op cn -- CALLI/JMPI cc, [Rwn] */
+struct CondReg {
+  static constexpr Field n{8, 4};
+  static constexpr Field cc{12, 4};
+};
+
+/* op c0 MM MM -- cc, caddr */
+struct CondCaddr {
+  static constexpr Field cc{12, 4};
+  static constexpr Field caddr{16, 16};
+};
+
+/* op RR MM MM -- reg, caddr */
+struct RegCaddr {
+  static constexpr Field reg{8, 8};
+  static constexpr Field caddr{16, 16};
+};
+
+/* op SS MM MM -- seg, caddr */
+struct SegCaddr {
+  static constexpr Field seg{8, 8};
+  static constexpr Field caddr{16, 16};
+};
+/* op :m (## 0#) -- ATOMIC/EXTR #irang2, EXTP/EXTS Rwm or #pag10/#seg8 */
+struct Ext {
+  static constexpr Field m{8, 4};
+  static constexpr Field irang2{12, 2};  // Instruction count - 1
+  static constexpr Field subop{14, 2};
+  static constexpr Field seg8{16, 8};
+  static constexpr Field pag10{16, 10};
+};
+}  // namespace C166::Formats
+
 #endif  // OPCODES_H
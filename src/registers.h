@@ -48,6 +48,21 @@ constexpr uint8_t CPUCON2 = 34;
 constexpr uint8_t PSW = 35;
 constexpr uint8_t CP = 36;
 constexpr uint8_t VIRTUAL_LR = 37;
+
+/* Multiply/Divide Unit (MD = MDH:MDL) */
+constexpr uint8_t MD = 38;
+constexpr uint8_t MDH = 39;
+constexpr uint8_t MDL = 40;
+
+/* Data Page Pointers (DPP = DPP3:DPP2:DPP1:DPP0, in SFR address order) */
+constexpr uint8_t DPP = 41;
+constexpr uint8_t DPP0 = 42;
+constexpr uint8_t DPP1 = 43;
+constexpr uint8_t DPP2 = 44;
+constexpr uint8_t DPP3 = 45;
+
+/* System Stack Pointer */
+constexpr uint8_t SP = 46;
 }  // namespace C166::Registers
 
 #endif  // SRC_REGISTERS_H_
@@ -6,11 +6,34 @@
 
 namespace C166::Sfr {
 constexpr uint16_t DPP0 = 0xFE00;
+constexpr uint16_t DPP1 = 0xFE02;
+constexpr uint16_t DPP2 = 0xFE04;
+constexpr uint16_t DPP3 = 0xFE06;
+constexpr uint16_t CSP = 0xFE08;
+
+/* Context and Stack Pointers */
+constexpr uint16_t CP = 0xFE10;
+constexpr uint16_t SP = 0xFE12;
 
 /* Hardware Multiply/Divide Registers */
 constexpr uint16_t MD = 0xFE0C;
 constexpr uint16_t MDH = 0xFE0C;
 constexpr uint16_t MDL = 0xFE0E;
+
+/* External Bus Controller */
+constexpr uint16_t ADDRSEL1 = 0xFE18;
+constexpr uint16_t ADDRSEL2 = 0xFE1A;
+constexpr uint16_t ADDRSEL3 = 0xFE1C;
+constexpr uint16_t ADDRSEL4 = 0xFE1E;
+
+/* Bit-addressable System Registers */
+constexpr uint16_t BUSCON0 = 0xFF0C;
+constexpr uint16_t PSW = 0xFF10;
+constexpr uint16_t SYSCON = 0xFF12;
+constexpr uint16_t BUSCON1 = 0xFF14;
+constexpr uint16_t BUSCON2 = 0xFF16;
+constexpr uint16_t BUSCON3 = 0xFF18;
+constexpr uint16_t BUSCON4 = 0xFF1A;
 }  // namespace C166::Sfr
 
 #endif  // SRC_SFR_H_
@@ -0,0 +1,232 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "signatures.h"
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "opcodes.h"
+
+namespace BN = BinaryNinja;
+
+namespace C166 {
+
+RuntimeSignature::RuntimeSignature() : hash(0), length(0) {}
+
+// Instructions whose second word is a mem/caddr (or EXTP/EXTS page/segment)
+// operand. These depend on where the routine was linked and on the DPP layout,
+// so they are masked before hashing.
+bool Signature::MasksAddress(const uint8_t op) {
+  switch (op) {
+    case Opcodes::ADD_REG_MEM:
+    case Opcodes::ADD_MEM_REG:
+    case Opcodes::ADDB_REG_MEM:
+    case Opcodes::ADDB_MEM_REG:
+    case Opcodes::ADDC_REG_MEM:
+    case Opcodes::ADDC_MEM_REG:
+    case Opcodes::ADDCB_REG_MEM:
+    case Opcodes::ADDCB_MEM_REG:
+    case Opcodes::AND_REG_MEM:
+    case Opcodes::AND_MEM_REG:
+    case Opcodes::ANDB_REG_MEM:
+    case Opcodes::ANDB_MEM_REG:
+    case Opcodes::CALLA:
+    case Opcodes::CALLS:
+    case Opcodes::CMP_REG_MEM:
+    case Opcodes::CMPB_REG_MEM:
+    case Opcodes::CMPD1_RWN_MEM:
+    case Opcodes::CMPD2_RWN_MEM:
+    case Opcodes::CMPI1_RWN_MEM:
+    case Opcodes::CMPI2_RWN_MEM:
+    case Opcodes::EXTPRS_PAG_SEG_COUNT:
+    case Opcodes::JMPA:
+    case Opcodes::JMPS:
+    case Opcodes::MOV_REF_RWN_MEM:
+    case Opcodes::MOV_MEM_REF_RWN:
+    case Opcodes::MOV_REG_MEM:
+    case Opcodes::MOV_MEM_REG:
+    case Opcodes::MOVB_REF_RWN_MEM:
+    case Opcodes::MOVB_MEM_REF_RWN:
+    case Opcodes::MOVB_REG_MEM:
+    case Opcodes::MOVB_MEM_REG:
+    case Opcodes::MOVBS_REG_MEM:
+    case Opcodes::MOVBS_MEM_REG:
+    case Opcodes::MOVBZ_REG_MEM:
+    case Opcodes::MOVBZ_MEM_REG:
+    case Opcodes::OR_REG_MEM:
+    case Opcodes::OR_MEM_REG:
+    case Opcodes::ORB_REG_MEM:
+    case Opcodes::ORB_MEM_REG:
+    case Opcodes::PCALL:
+    case Opcodes::SCXT_REG_MEM:
+    case Opcodes::SUB_REG_MEM:
+    case Opcodes::SUB_MEM_REG:
+    case Opcodes::SUBB_REG_MEM:
+    case Opcodes::SUBB_MEM_REG:
+    case Opcodes::SUBC_REG_MEM:
+    case Opcodes::SUBC_MEM_REG:
+    case Opcodes::SUBCB_REG_MEM:
+    case Opcodes::SUBCB_MEM_REG:
+    case Opcodes::XOR_REG_MEM:
+    case Opcodes::XOR_MEM_REG:
+    case Opcodes::XORB_REG_MEM:
+    case Opcodes::XORB_MEM_REG:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool Signature::IsReturn(const uint8_t op) {
+  return op == Opcodes::RET || op == Opcodes::RETP || op == Opcodes::RETS ||
+         op == Opcodes::RETI;
+}
+
+// Copies the instructions starting at data into out, with address operands
+// zeroed, stopping after the first return or once max_length is reached.
+// Returns the number of bytes normalized.
+size_t Signature::Normalize(BN::Architecture* arch, const uint8_t* data,
+                            const uint64_t addr, const size_t len,
+                            std::vector<uint8_t>& out) {
+  const size_t limit = (len < max_length) ? len : max_length;
+  size_t off = 0;
+
+  out.clear();
+  while (off + 2 <= limit) {
+    BN::InstructionInfo info;
+    if (!arch->GetInstructionInfo(data + off, addr + off, limit - off, info) ||
+        info.length == 0 || off + info.length > limit)
+      break;
+
+    const uint8_t op = data[off];
+    out.insert(out.end(), data + off, data + off + info.length);
+    if (info.length == 4 && MasksAddress(op)) {
+      out[off + 2] = 0;
+      out[off + 3] = 0;
+      // Segment number of a far call/jump
+      if (op == Opcodes::CALLS || op == Opcodes::JMPS) out[off + 1] = 0;
+    }
+
+    off += info.length;
+    if (IsReturn(op)) break;
+  }
+
+  return off;
+}
+
+// 64-bit FNV-1a
+uint64_t Signature::Hash(const uint8_t* data, const size_t len) {
+  uint64_t hash = 0xCBF29CE484222325ull;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= data[i];
+    hash *= 0x100000001B3ull;
+  }
+  return hash;
+}
+
+bool Signature::Compute(BN::BinaryView* view, BN::Function* func,
+                        RuntimeSignature& sig) {
+  const uint64_t start = func->GetStart();
+  BN::DataBuffer buf = view->ReadBuffer(start, max_length);
+
+  std::vector<uint8_t> normalized;
+  const size_t len =
+      Normalize(func->GetArchitecture(), (const uint8_t*)buf.GetData(), start,
+                buf.GetLength(), normalized);
+  if (len == 0) return false;
+
+  sig.hash = Hash(normalized.data(), normalized.size());
+  sig.length = len;
+  return true;
+}
+
+std::string Signature::ToString(const RuntimeSignature& sig) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%016" PRIx64 " %u", sig.hash, sig.length);
+
+  std::string line = std::string(buf) + " " + sig.name;
+  if (!sig.type.empty()) line += " " + sig.type;
+  return line;
+}
+
+// Database format, one routine per line:
+//   <hash (hex)> <length> <name> [<C type declaration>]
+// Empty lines and lines starting with '#' are ignored.
+bool Signature::LoadDatabase(const std::string& filename,
+                             std::vector<RuntimeSignature>& db) {
+  std::ifstream file(filename);
+  if (!file.is_open()) {
+    BN::LogError("%s: Unable to open %s", __func__, filename.c_str());
+    return false;
+  }
+
+  std::string line;
+  size_t lineno = 0;
+  while (std::getline(file, line)) {
+    lineno++;
+    if (line.empty() || line[0] == '#') continue;
+
+    std::istringstream fields(line);
+    std::string hash;
+    RuntimeSignature sig;
+    if (!(fields >> hash >> sig.length >> sig.name)) {
+      BN::LogWarn("%s: %s:%zu: Malformed signature", __func__,
+                  filename.c_str(), lineno);
+      continue;
+    }
+    sig.hash = strtoull(hash.c_str(), nullptr, 16);
+
+    std::getline(fields >> std::ws, sig.type);
+    db.push_back(sig);
+  }
+
+  return true;
+}
+
+// Matches every analyzed function against the database in a single pass and
+// names/types the ones found. Returns the number of functions matched.
+size_t Signature::Apply(BN::BinaryView* view,
+                        const std::vector<RuntimeSignature>& db) {
+  // Signatures of different lengths may share a hash
+  std::unordered_multimap<uint64_t, const RuntimeSignature*> index;
+  for (const auto& sig : db) index.emplace(sig.hash, &sig);
+
+  size_t matched = 0;
+  for (const auto& func : view->GetAnalysisFunctionList()) {
+    RuntimeSignature sig;
+    if (!Compute(view, func, sig)) continue;
+
+    const RuntimeSignature* known = nullptr;
+    const auto [first, last] = index.equal_range(sig.hash);
+    for (auto it = first; it != last && !known; ++it) {
+      if (it->second->length == sig.length) known = it->second;
+    }
+    if (!known) continue;
+
+    view->DefineUserSymbol(
+        new BN::Symbol(FunctionSymbol, known->name, func->GetStart()));
+
+    if (!known->type.empty()) {
+      BN::QualifiedNameAndType result;
+      std::string errors;
+      if (view->ParseTypeString(known->type, result, errors))
+        func->SetUserType(result.type);
+      else
+        BN::LogWarn("%s: Invalid type for %s: %s", __func__,
+                    known->name.c_str(), errors.c_str());
+    }
+
+    matched++;
+  }
+
+  return matched;
+}
+}  // namespace C166
@@ -0,0 +1,50 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_SIGNATURES_H_
+#define SRC_SIGNATURES_H_
+
+#include <binaryninjaapi.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace BN = BinaryNinja;
+
+namespace C166 {
+
+// A known runtime routine (e.g. Tasking long multiply/divide, __memcpy, switch
+// helpers) identified by a hash of its normalized instruction bytes.
+class RuntimeSignature {
+ public:
+  uint64_t hash;
+  uint16_t length;
+  std::string name;
+  std::string type;
+
+  RuntimeSignature();
+};
+
+class Signature {
+  static bool MasksAddress(uint8_t op);
+  static bool IsReturn(uint8_t op);
+
+ public:
+  // Upper bound on the number of bytes hashed from the start of a routine
+  static constexpr size_t max_length = 256;
+
+  static size_t Normalize(BN::Architecture *arch, const uint8_t *data,
+                          uint64_t addr, size_t len, std::vector<uint8_t> &out);
+  static uint64_t Hash(const uint8_t *data, size_t len);
+  static bool Compute(BN::BinaryView *view, BN::Function *func,
+                      RuntimeSignature &sig);
+  static std::string ToString(const RuntimeSignature &sig);
+  static bool LoadDatabase(const std::string &filename,
+                           std::vector<RuntimeSignature> &db);
+  static size_t Apply(BN::BinaryView *view,
+                      const std::vector<RuntimeSignature> &db);
+};
+}  // namespace C166
+
+#endif  // SRC_SIGNATURES_H_
@@ -0,0 +1,259 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "state.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+namespace C166 {
+
+static constexpr unsigned pag10_shift = 0;
+static constexpr unsigned seg8_shift = 10;
+static constexpr unsigned ext_state_shift = 18;
+static constexpr unsigned num_insns_shift = 26;
+static constexpr unsigned dpp_set_shift = 34;
+static constexpr uint64_t dpp_set_mask = (uint64_t{1} << 29) - 1;
+static constexpr uint64_t present = uint64_t{1} << 63;
+
+static uint64_t PackDpps(const uint32_t *dpp) {
+  return uint64_t{dpp[0] & 0xFFFFu} | (uint64_t{dpp[1] & 0xFFFFu} << 16) |
+         (uint64_t{dpp[2] & 0xFFFFu} << 32) |
+         (uint64_t{dpp[3] & 0xFFFFu} << 48);
+}
+
+// Shared by StateTable and StateFile, which store DPP sets the same way
+static void UnpackEntry(const uint64_t entry, const uint64_t *dpp_sets,
+                        const size_t dpp_set_count, InstructionState &state) {
+  state.pag10 = (entry >> pag10_shift) & 0x3FF;
+  state.seg8 = (entry >> seg8_shift) & 0xFF;
+  state.ext_state = (entry >> ext_state_shift) & 0xFF;
+  state.num_insns = (entry >> num_insns_shift) & 0xFF;
+
+  // Set 0 keeps the defaults the caller's state was constructed with
+  const uint64_t dpp_set = (entry >> dpp_set_shift) & dpp_set_mask;
+  if (dpp_set && dpp_set <= dpp_set_count) {
+    const uint64_t dpps = dpp_sets[dpp_set - 1];
+    for (int i = 0; i < 4; i++) state.dpp[i] = (dpps >> (16 * i)) & 0xFFFF;
+  }
+}
+
+StateTable::StateTable() : count(0) {}
+
+uint32_t StateTable::InternDpps(const uint32_t *dpp) {
+  const uint64_t key = PackDpps(dpp);
+
+  if (const auto it = dpp_set_ids.find(key); it != dpp_set_ids.end()) {
+    return it->second;
+  }
+
+  dpp_sets.push_back(key);
+  const auto id = static_cast<uint32_t>(dpp_sets.size());
+  dpp_set_ids.emplace(key, id);
+  return id;
+}
+
+uint64_t StateTable::Pack(const InstructionState &state) {
+  uint64_t dpp_set = 0;
+  if (state.ext_state & ExtNoneCustomDpps) {
+    dpp_set = InternDpps(state.dpp) & dpp_set_mask;
+  }
+
+  return present | (uint64_t{state.pag10 & 0x3FFu} << pag10_shift) |
+         (uint64_t{state.seg8 & 0xFFu} << seg8_shift) |
+         (uint64_t{state.ext_state} << ext_state_shift) |
+         (uint64_t{state.num_insns} << num_insns_shift) |
+         (dpp_set << dpp_set_shift);
+}
+
+void StateTable::Unpack(const uint64_t entry, InstructionState &state) const {
+  UnpackEntry(entry, dpp_sets.data(), dpp_sets.size(), state);
+}
+
+bool StateTable::Find(const uint64_t addr, InstructionState &state) const {
+  if (addr >= address_limit) return false;
+
+  const uint64_t index = addr >> 1;
+  const auto &page = pages[index >> page_bits];
+  if (!page) return false;
+
+  const uint64_t entry = (*page)[index & (page_size - 1)];
+  if (!entry) return false;
+
+  Unpack(entry, state);
+  return true;
+}
+
+void StateTable::Set(const uint64_t addr, const InstructionState &state) {
+  if (addr >= address_limit) return;
+
+  const uint64_t index = addr >> 1;
+  auto &page = pages[index >> page_bits];
+  if (!page) page = std::make_unique<Page>();  // Value-initialized to zero
+
+  uint64_t &entry = (*page)[index & (page_size - 1)];
+  if (!entry) count++;
+  entry = Pack(state);
+}
+
+void StateTable::Clear() {
+  for (auto &page : pages) page.reset();
+  dpp_sets.clear();
+  dpp_set_ids.clear();
+  count = 0;
+}
+
+StateFile::StateFile()
+    : base(nullptr),
+      size(0),
+      file_handle(nullptr),
+      map_handle(nullptr),
+      dpp_sets(nullptr),
+      dpp_set_count(0),
+      records(nullptr),
+      record_count(0) {}
+
+StateFile::~StateFile() { Close(); }
+
+bool StateFile::Open(const std::string &filename) {
+  Close();
+
+#ifdef _WIN32
+  HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                            nullptr);
+  if (file == INVALID_HANDLE_VALUE) return false;
+
+  LARGE_INTEGER file_size;
+  HANDLE mapping = nullptr;
+  const void *view = nullptr;
+  if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0) {
+    mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping) view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  }
+  if (!view) {
+    if (mapping) CloseHandle(mapping);
+    CloseHandle(file);
+    return false;
+  }
+
+  file_handle = file;
+  map_handle = mapping;
+  base = static_cast<const uint8_t *>(view);
+  size = static_cast<size_t>(file_size.QuadPart);
+#else
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+
+  struct stat st {};
+  void *view = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && st.st_size > 0) {
+    view = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  close(fd);  // The mapping stays valid
+  if (view == MAP_FAILED) return false;
+
+  base = static_cast<const uint8_t *>(view);
+  size = static_cast<size_t>(st.st_size);
+#endif
+
+  Header header;
+  if (size < sizeof(header)) {
+    Close();
+    return false;
+  }
+  std::memcpy(&header, base, sizeof(header));
+
+  const uint64_t expected = sizeof(header) +
+                            uint64_t{header.dpp_set_count} * sizeof(uint64_t) +
+                            header.record_count * sizeof(Record);
+  if (std::memcmp(header.magic, file_magic, sizeof(file_magic)) != 0 ||
+      header.version != file_version ||
+      header.record_count > size / sizeof(Record) || expected != size) {
+    Close();
+    return false;
+  }
+
+  // The header and the 8-byte DPP sets keep the records 8-byte aligned
+  dpp_sets = reinterpret_cast<const uint64_t *>(base + sizeof(header));
+  dpp_set_count = header.dpp_set_count;
+  records = reinterpret_cast<const Record *>(dpp_sets + dpp_set_count);
+  record_count = header.record_count;
+  return true;
+}
+
+void StateFile::Close() {
+#ifdef _WIN32
+  if (base) UnmapViewOfFile(base);
+  if (map_handle) CloseHandle(map_handle);
+  if (file_handle) CloseHandle(file_handle);
+#else
+  if (base) munmap(const_cast<uint8_t *>(base), size);
+#endif
+
+  base = nullptr;
+  size = 0;
+  file_handle = nullptr;
+  map_handle = nullptr;
+  dpp_sets = nullptr;
+  dpp_set_count = 0;
+  records = nullptr;
+  record_count = 0;
+}
+
+void StateFile::Unpack(const uint64_t entry, InstructionState &state) const {
+  UnpackEntry(entry, dpp_sets, dpp_set_count, state);
+}
+
+bool StateFile::Find(const uint64_t addr, InstructionState &state) const {
+  const Record *end = records + record_count;
+  const Record *it = std::lower_bound(
+      records, end, addr,
+      [](const Record &record, uint64_t key) { return record.addr < key; });
+  if (it == end || it->addr != addr) return false;
+
+  Unpack(it->entry, state);
+  return true;
+}
+
+// Records are written in host byte order; the magic and version reject files
+// that do not match the layout above
+bool StateFile::Write(const std::string &filename, const StateTable &table) {
+  std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) return false;
+
+  Header header{};
+  std::memcpy(header.magic, file_magic, sizeof(file_magic));
+  header.version = file_version;
+  header.dpp_set_count = static_cast<uint32_t>(table.dpp_sets.size());
+  header.record_count = table.count;
+  file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char *>(table.dpp_sets.data()),
+             table.dpp_sets.size() * sizeof(uint64_t));
+
+  // Pages are visited in address order, so the records come out sorted
+  for (size_t p = 0; p < StateTable::page_count; p++) {
+    if (!table.pages[p]) continue;
+    for (size_t i = 0; i < StateTable::page_size; i++) {
+      const Record record{((p << StateTable::page_bits) | i) << 1,
+                          (*table.pages[p])[i]};
+      if (!record.entry) continue;
+      file.write(reinterpret_cast<const char *>(&record), sizeof(record));
+    }
+  }
+
+  return file.good();
+}
+}  // namespace C166
@@ -0,0 +1,161 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_STATE_H_
+#define SRC_STATE_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace C166 {
+
+enum ExtState {
+  ExtNone = 0x0,
+  ExtRegister = 0x1,
+  ExtSegment = 0x2,
+  ExtPage = 0x4,
+  ExtAtomic = 0x8,
+  ExtNoneCustomDpps = 0x10,
+};
+
+class InstructionState {
+ public:
+  uint8_t ext_state;
+  uint8_t num_insns;
+  uint32_t pag10;
+  uint32_t seg8;
+  uint32_t dpp[4];
+
+  InstructionState();
+};
+
+// A user configuration applied to every instruction in [start, end]
+struct StateRange {
+  enum Kind : uint8_t { Dpp, Extp, Exts, Extr };
+
+  Kind kind;
+  uint64_t start;
+  uint64_t end;
+  uint16_t value[4];  // DPP0-3, or the pag10/seg8 operand in value[0]
+};
+
+// Per-address instruction state over the 24-bit address space. Instructions
+// are word aligned, so entries are indexed by addr >> 1 through a two-level
+// radix table whose leaf pages are allocated on first write. Each entry is a
+// packed 64-bit word; DPP assignments are interned and referenced by id since
+// a firmware image only uses a handful of distinct sets.
+class StateTable {
+  // Entry layout: pag10[9:0] seg8[17:10] ext_state[25:18] num_insns[33:26]
+  // dpp_set[62:34] present[63]. DPP set 0 means the configured defaults.
+  static constexpr unsigned index_bits = 23;
+  static constexpr unsigned page_bits = 12;
+  static constexpr size_t page_size = size_t{1} << page_bits;
+  static constexpr size_t page_count = size_t{1} << (index_bits - page_bits);
+
+  using Page = std::array<uint64_t, page_size>;
+
+  std::array<std::unique_ptr<Page>, page_count> pages;
+  std::vector<uint64_t> dpp_sets;  // Packed DPP0-3, indexed by set id - 1
+  std::unordered_map<uint64_t, uint32_t> dpp_set_ids;
+  size_t count;
+
+  uint32_t InternDpps(const uint32_t *dpp);
+  uint64_t Pack(const InstructionState &state);
+  void Unpack(uint64_t entry, InstructionState &state) const;
+
+  friend class StateFile;
+
+ public:
+  static constexpr uint64_t address_limit = uint64_t{1} << (index_bits + 1);
+
+  StateTable();
+
+  // Fills state and returns true if addr has an entry; otherwise leaves state
+  // untouched
+  bool Find(uint64_t addr, InstructionState &state) const;
+  // Stores state at addr; addresses beyond the 24-bit space are ignored
+  void Set(uint64_t addr, const InstructionState &state);
+  void Clear();
+  size_t Size() const { return count; }
+
+  // Calls f(addr, state) for every entry in ascending address order
+  template <typename F>
+  void ForEach(F f) const {
+    for (size_t p = 0; p < page_count; p++) {
+      if (!pages[p]) continue;
+      for (size_t i = 0; i < page_size; i++) {
+        const uint64_t entry = (*pages[p])[i];
+        if (!entry) continue;
+
+        InstructionState state;
+        Unpack(entry, state);
+        f(((p << page_bits) | i) << 1, state);
+      }
+    }
+  }
+};
+
+// Read-only view of a state sidecar file mapped into memory. The file holds a
+// header, the interned DPP sets and {addr, entry} records sorted by address,
+// with entries packed as in StateTable. Lookups binary-search the mapping in
+// place, so opening a file costs the same regardless of its size.
+class StateFile {
+  struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t dpp_set_count;
+    uint64_t record_count;
+  };
+
+  struct Record {
+    uint64_t addr;
+    uint64_t entry;
+  };
+
+  static constexpr char file_magic[8] = {'C', '1', '6', '6', 'S', 'T', 'M', 0};
+  static constexpr uint32_t file_version = 1;
+
+  const uint8_t *base;
+  size_t size;
+  void *file_handle;  // Win32 only
+  void *map_handle;   // Win32 only
+  const uint64_t *dpp_sets;
+  uint32_t dpp_set_count;
+  const Record *records;
+  uint64_t record_count;
+
+  void Unpack(uint64_t entry, InstructionState &state) const;
+
+ public:
+  StateFile();
+  ~StateFile();
+  StateFile(const StateFile &) = delete;
+  StateFile &operator=(const StateFile &) = delete;
+
+  bool Open(const std::string &filename);
+  void Close();
+  bool IsOpen() const { return base != nullptr; }
+  size_t Size() const { return record_count; }
+
+  bool Find(uint64_t addr, InstructionState &state) const;
+
+  // Calls f(addr, state) for every record in ascending address order
+  template <typename F>
+  void ForEach(F f) const {
+    for (uint64_t i = 0; i < record_count; i++) {
+      InstructionState state;
+      Unpack(records[i].entry, state);
+      f(records[i].addr, state);
+    }
+  }
+
+  static bool Write(const std::string &filename, const StateTable &table);
+};
+}  // namespace C166
+
+#endif  // SRC_STATE_H_
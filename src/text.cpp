@@ -24,19 +24,19 @@ bool Add::Text(const uint8_t op, const uint8_t* data, const uint64_t addr,
   switch (op) {
     case Opcodes::ADD_RWN_RWM:
       len = 2;
-      return Instruction::TextOpRnRm(data, len, 2, result, "add");
+      return Instruction::TextOpRnRm(data, 2, result, "add");
     case Opcodes::ADD_RWN_RWI_DATA3:
       len = 2;
-      return Instruction::TextOpRnRwiData3(data, len, 2, result, "add");
+      return Instruction::TextOpRnRwiData3(data, 2, result, "add");
     case Opcodes::ADD_REG_DATA16:
       len = 4;
-      return Instruction::TextOpRegData(addr, data, len, 2, result, "add");
+      return Instruction::TextOpRegData(addr, data, 2, result, "add");
     case Opcodes::ADD_REG_MEM:
       len = 4;
-      return Instruction::TextOpRegMem(addr, data, len, 2, result, "add");
+      return Instruction::TextOpRegMem(addr, data, 2, result, "add");
     case Opcodes::ADD_MEM_REG:
       len = 4;
-      return Instruction::TextOpMemReg(addr, data, len, 2, result, "add");
+      return Instruction::TextOpMemReg(addr, data, 2, result, "add");
     default:
       BN::LogError("0x%lx: Add::%s received invalid opcode 0x%x", addr,
                    __func__, op);
@@ -49,19 +49,19 @@ bool Addb::Text(const uint8_t op, const uint8_t* data, const uint64_t addr,
   switch (op) {
     case Opcodes::ADDB_RBN_RBM:
       len = 2;
-      return Instruction::TextOpRnRm(data, len, 1, result, "addb");
+      return Instruction::TextOpRnRm(data, 1, result, "addb");
     case Opcodes::ADDB_RBN_RWI_DATA3:
       len = 2;
-      return Instruction::TextOpRnRwiData3(data, len, 1, result, "addb");
+      return Instruction::TextOpRnRwiData3(data, 1, result, "addb");
     case Opcodes::ADDB_REG_DATA8:
       len = 4;
-      return Instruction::TextOpRegData(addr, data, len, 1, result, "addb");
+      return Instruction::TextOpRegData(addr, data, 1, result, "addb");
     case Opcodes::ADDB_REG_MEM:
       len = 4;
-      return Instruction::TextOpRegMem(addr, data, len, 1, result, "addb");
+      return Instruction::TextOpRegMem(addr, data, 1, result, "addb");
     case Opcodes::ADDB_MEM_REG:
       len = 4;
-      return Instruction::TextOpMemReg(addr, data, len, 1, result, "addb");
+      return Instruction::TextOpMemReg(addr, data, 1, result, "addb");
     default:
       BN::LogError("0x%lx: Addb::%s received invalid opcode 0x%x", addr,
                    __func__, op);
@@ -75,19 +75,19 @@ bool Addc::Text(const uint8_t op, const uint8_t* data, const uint64_t addr,
   switch (op) {
     case Opcodes::ADDC_RWN_RWM:
       len = 2;
-      return Instruction::TextOpRnRm(data, len, 2, result, "addc");
+      return Instruction::TextOpRnRm(data, 2, result, "addc");
     case Opcodes::ADDC_RWN_RWI_DATA3:
       len = 2;
-      return Instruction::TextOpRnRwiData3(data, len, 2, result, "addc");
+      return Instruction::TextOpRnRwiData3(data, 2, result, "addc");
     case Opcodes::ADDC_REG_DATA16:
       len = 4;
-      return Instruction::TextOpRegData(addr, data, len, 2, result, "addc");
+      return Instruction::TextOpRegData(addr, data, 2, result, "addc");
     case Opcodes::ADDC_REG_MEM:
       len = 4;
-      return Instruction::TextOpRegMem(addr, data, len, 2, result, "addc");
+      return Instruction::TextOpRegMem(addr, data, 2, result, "addc");
     case Opcodes::ADDC_MEM_REG:
       len = 4;
-      return Instruction::TextOpMemReg(addr, data, len, 2, result, "addc");
+      return Instruction::TextOpMemReg(addr, data, 2, result, "addc");
     default:
       BN::LogError("0x%lx: Addc::%s received invalid opcode 0x%x", addr,
                    __func__, op);
@@ -100,19 +100,19 @@ bool Addcb::Text(const uint8_t op, const uint8_t* data, const uint64_t addr,
   switch (op) {
     case Opcodes::ADDCB_RBN_RBM:
       len = 2;
-      return Instruction::TextOpRnRm(data, len, 1, result, "addcb");
+      return Instruction::TextOpRnRm(data, 1, result, "addcb");
     case Opcodes::ADDCB_RBN_RWI_DATA3:
       len = 2;
-      return Instruction::TextOpRnRwiData3(data, len, 1, result, "addcb");
+      return Instruction::TextOpRnRwiData3(data, 1, result, "addcb");
     case Opcodes::ADDCB_REG_DATA8:
       len = 4;
-      return Instruction::TextOpRegData(addr, data, len, 1, result, "addcb");
+      return Instruction::TextOpRegData(addr, data, 1, result, "addcb");
     case Opcodes::ADDCB_REG_MEM:
       len = 4;
-      return Instruction::TextOpRegMem(addr, data, len, 1, result, "addcb");
+      return Instruction::TextOpRegMem(addr, data, 1, result, "addcb");
     case Opcodes::ADDCB_MEM_REG:
       len = 4;
-      return Instruction::TextOpMemReg(addr, data, len, 1, result, "addcb");
+      return Instruction::TextOpMemReg(addr, data, 1, result, "addcb");
     default:
       BN::LogError("0x%lx: Addcb::%s received invalid opcode 0x%x", addr,
                    __func__, op);
@@ -125,19 +125,19 @@ bool And::Text(const uint8_t op, const uint8_t* data, const uint64_t addr,
   switch (op) {
     case Opcodes::AND_RWN_RWM:
       len = 2;
-      return Instruction::TextOpRnRm(data, len, 2, result, "and");
+      return Instruction::TextOpRnRm(data, 2, result, "and");
     case Opcodes::AND_RWN_RWI_DATA3:
       len = 2;
-      return Instruction::TextOpRnRwiData3(data, len, 2, result, "and");
+      return Instruction::TextOpRnRwiData3(data, 2, result, "and");
     case Opcodes::AND_REG_DATA16:
       len = 4;
-      return Instruction::TextOpRegData(addr, data, len, 2, result, "and");
+      return Instruction::TextOpRegData(addr, data, 2, result, "and");
     case Opcodes::AND_REG_MEM:
       len = 4;
-      return Instruction::TextOpRegMem(addr, data, len, 2, result, "and");
+      return Instruction::TextOpRegMem(addr, data, 2, result, "and");
     case Opcodes::AND_MEM_REG:
       len = 4;
-      return Instruction::TextOpMemReg(addr, data, len, 2, result, "and");
+      return Instruction::TextOpMemReg(addr, data, 2, result, "and");
     default:
       BN::LogError("0x%lx: And::%s received invalid opcode 0x%x", addr,
                    __func__, op);
@@ -150,19 +150,19 @@ bool Andb::Text(const uint8_t op, const uint8_t* data, const uint64_t addr,
   switch (op) {
     case Opcodes::ANDB_RBN_RBM:
       len = 2;
-      return Instruction::TextOpRnRm(data, len, 1, result, "andb");
+      return Instruction::TextOpRnRm(data, 1, result, "andb");
     case Opcodes::ANDB_RBN_RWI_DATA3:
       len = 2;
-      return Instruction::TextOpRnRwiData3(data, len, 1, result, "andb");
+      return Instruction::TextOpRnRwiData3(data, 1, result, "andb");
     case Opcodes::ANDB_REG_DATA8:
       len = 4;
-      return Instruction::TextOpRegData(addr, data, len, 1, result, "andb");
+      return Instruction::TextOpRegData(addr, data, 1, result, "andb");
     case Opcodes::ANDB_REG_MEM:
       len = 4;
-      return Instruction::TextOpRegMem(addr, data, len, 1, result, "andb");
+      return Instruction::TextOpRegMem(addr, data, 1, result, "andb");
     case Opcodes::ANDB_MEM_REG:
       len = 4;
-      return Instruction::TextOpMemReg(addr, data, len, 1, result, "andb");
+      return Instruction::TextOpMemReg(addr, data, 1, result, "andb");
     default:
       BN::LogError("0x%lx: Andb::%s received invalid opcode 0x%x", addr,
                    __func__, op);
@@ -173,8 +173,8 @@ bool Andb::Text(const uint8_t op, const uint8_t* data, const uint64_t addr,
 bool Ashr::TextxAC(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, length);
-  const auto rwm = Instruction::GetData4Low(data, length);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   ITEXT("ashr")
 
@@ -192,8 +192,8 @@ bool Ashr::TextxAC(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Ashr::TextxBC(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4Low(data, length);
-  const auto data4 = Instruction::GetData4High(data, length);
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto data4 = Instruction::GetData4High(data);
 
   ITEXT("ashr")
 
@@ -211,10 +211,12 @@ bool Ashr::TextxBC(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Band::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto qaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  const auto zaddr = Instruction::TranslateBitOff(addr, *(data + 2));
-  const uint8_t qpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
-  const uint8_t zpos = *(data + 3) & 0xFu;
+  const auto qaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::qq>(data));
+  const auto zaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::zz>(data));
+  const uint8_t qpos = Formats::Get<Formats::BitBit::q>(data);
+  const uint8_t zpos = Formats::Get<Formats::BitBit::z>(data);
 
   ITEXT("band")
 
@@ -249,8 +251,9 @@ bool Band::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Bclr::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto bitpos = Instruction::GetBitPosition(data, length);
-  const auto bitaddr = Instruction::TranslateBitOff(addr, *(data + 1));
+  const auto bitpos = Instruction::GetBitPosition(data);
+  const auto bitaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitShort::bitoff>(data));
 
   ITEXT("bclr")
 
@@ -273,10 +276,12 @@ bool Bclr::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Bcmp::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  auto qaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  auto zaddr = Instruction::TranslateBitOff(addr, *(data + 2));
-  uint8_t qpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
-  uint8_t zpos = *(data + 3) & 0xFu;
+  auto qaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::qq>(data));
+  auto zaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::zz>(data));
+  uint8_t qpos = Formats::Get<Formats::BitBit::q>(data);
+  uint8_t zpos = Formats::Get<Formats::BitBit::z>(data);
 
   ITEXT("bcmp")
 
@@ -311,9 +316,10 @@ bool Bcmp::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Bfldh::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto bitoff = Instruction::TranslateBitOff(addr, *(data + 1));
-  uint8_t data8 = *(data + 2);
-  uint8_t mask8 = *(data + 3);
+  const auto bitoff = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitFieldHigh::bitoff>(data));
+  uint8_t data8 = Formats::Get<Formats::BitFieldHigh::data8>(data);
+  uint8_t mask8 = Formats::Get<Formats::BitFieldHigh::mask8>(data);
 
   ITEXT("bfldh")
 
@@ -340,9 +346,10 @@ bool Bfldh::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Bfldl::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto bitoff = Instruction::TranslateBitOff(addr, *(data + 1));
-  uint8_t mask8 = *(data + 2);
-  uint8_t data8 = *(data + 3);
+  const auto bitoff = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitFieldLow::bitoff>(data));
+  uint8_t mask8 = Formats::Get<Formats::BitFieldLow::mask8>(data);
+  uint8_t data8 = Formats::Get<Formats::BitFieldLow::data8>(data);
 
   ITEXT("bfldl")
 
@@ -369,10 +376,12 @@ bool Bfldl::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Bmov::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  auto qaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  auto zaddr = Instruction::TranslateBitOff(addr, *(data + 2));
-  uint8_t qpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
-  uint8_t zpos = *(data + 3) & 0xFu;
+  auto qaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::qq>(data));
+  auto zaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::zz>(data));
+  uint8_t qpos = Formats::Get<Formats::BitBit::q>(data);
+  uint8_t zpos = Formats::Get<Formats::BitBit::z>(data);
 
   ITEXT("bmov")
 
@@ -406,10 +415,12 @@ bool Bmov::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Bmovn::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  auto qaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  auto zaddr = Instruction::TranslateBitOff(addr, *(data + 2));
-  uint8_t qpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
-  uint8_t zpos = *(data + 3) & 0xFu;
+  auto qaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::qq>(data));
+  auto zaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::zz>(data));
+  uint8_t qpos = Formats::Get<Formats::BitBit::q>(data);
+  uint8_t zpos = Formats::Get<Formats::BitBit::z>(data);
 
   ITEXT("bmovn")
 
@@ -443,10 +454,12 @@ bool Bmovn::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Bor::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  auto qaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  auto zaddr = Instruction::TranslateBitOff(addr, *(data + 2));
-  uint8_t qpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
-  uint8_t zpos = *(data + 3) & 0xFu;
+  auto qaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::qq>(data));
+  auto zaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::zz>(data));
+  uint8_t qpos = Formats::Get<Formats::BitBit::q>(data);
+  uint8_t zpos = Formats::Get<Formats::BitBit::z>(data);
 
   ITEXT("bor")
 
@@ -480,10 +493,12 @@ bool Bor::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Bxor::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  auto qaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  auto zaddr = Instruction::TranslateBitOff(addr, *(data + 2));
-  uint8_t qpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
-  uint8_t zpos = *(data + 3) & 0xFu;
+  auto qaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::qq>(data));
+  auto zaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitBit::zz>(data));
+  uint8_t qpos = Formats::Get<Formats::BitBit::q>(data);
+  uint8_t zpos = Formats::Get<Formats::BitBit::z>(data);
 
   ITEXT("bxor")
 
@@ -517,8 +532,9 @@ bool Bxor::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Bset::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  auto bitpos = Instruction::GetBitPosition(data, length);
-  auto bitaddr = Instruction::TranslateBitOff(addr, *(data + 1));
+  auto bitpos = Instruction::GetBitPosition(data);
+  auto bitaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitShort::bitoff>(data));
 
   ITEXT("bset")
 
@@ -542,8 +558,8 @@ bool Calla::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
   const char* const code =
-      Instruction::ConditionCodeToString(Calla::GetConditionCode(data, length));
-  auto target = Calla::GetTarget(data, addr, length);
+      Instruction::ConditionCodeToString(Calla::GetConditionCode(data));
+  auto target = Calla::GetTarget(data, addr);
 
   ITEXT("calla")
 
@@ -562,8 +578,8 @@ bool Calli::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
   const char* const code =
-      Instruction::ConditionCodeToString(GetConditionCode(data, length));
-  const auto rwn = Instruction::GetData4Low(data, length);
+      Instruction::ConditionCodeToString(GetConditionCode(data));
+  const auto rwn = Instruction::GetData4Low(data);
 
   ITEXT("calli")
 
@@ -582,7 +598,7 @@ bool Calli::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Callr::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto target = Callr::GetTarget(data, addr, length);
+  const auto target = Callr::GetTarget(data, addr);
 
   ITEXT("callr")
 
@@ -596,8 +612,8 @@ bool Callr::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Calls::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  uint8_t seg = Instruction::GetOpSeg(data, length);
-  uint16_t caddr = Instruction::GetOpCaddr(data, length);
+  uint8_t seg = Instruction::GetOpSeg(data);
+  uint16_t caddr = Instruction::GetOpCaddr(data);
 
   ITEXT("calls")
 
@@ -616,16 +632,16 @@ bool Cmp::Text(const uint8_t op, const uint8_t* data, const uint64_t addr,
   switch (op) {
     case Opcodes::CMP_RWN_RWM:
       len = 2;
-      return Instruction::TextOpRnRm(data, len, 2, result, "cmp");
+      return Instruction::TextOpRnRm(data, 2, result, "cmp");
     case Opcodes::CMP_RWN_RWI_DATA3:
       len = 2;
-      return Instruction::TextOpRnRwiData3(data, len, 2, result, "cmp");
+      return Instruction::TextOpRnRwiData3(data, 2, result, "cmp");
     case Opcodes::CMP_REG_DATA16:
       len = 4;
-      return Instruction::TextOpRegData(addr, data, len, 2, result, "cmp");
+      return Instruction::TextOpRegData(addr, data, 2, result, "cmp");
     case Opcodes::CMP_REG_MEM:
       len = 4;
-      return Instruction::TextOpRegMem(addr, data, len, 2, result, "cmp");
+      return Instruction::TextOpRegMem(addr, data, 2, result, "cmp");
     default:
       BN::LogError("0x%lx: Cmp::%s received invalid opcode 0x%x", addr,
                    __func__, op);
@@ -638,16 +654,16 @@ bool Cmpb::Text(const uint8_t op, const uint8_t* data, const uint64_t addr,
   switch (op) {
     case Opcodes::CMPB_RBN_RBM:
       len = 2;
-      return Instruction::TextOpRnRm(data, len, 1, result, "cmpb");
+      return Instruction::TextOpRnRm(data, 1, result, "cmpb");
     case Opcodes::CMPB_RBN_RWI_DATA3:
       len = 2;
-      return Instruction::TextOpRnRwiData3(data, len, 1, result, "cmpb");
+      return Instruction::TextOpRnRwiData3(data, 1, result, "cmpb");
     case Opcodes::CMPB_REG_DATA8:
       len = 4;
-      return Instruction::TextOpRegData(addr, data, len, 1, result, "cmpb");
+      return Instruction::TextOpRegData(addr, data, 1, result, "cmpb");
     case Opcodes::CMPB_REG_MEM:
       len = 4;
-      return Instruction::TextOpRegMem(addr, data, len, 1, result, "cmpb");
+      return Instruction::TextOpRegMem(addr, data, 1, result, "cmpb");
     default:
       BN::LogError("0x%lx: Cmpb::%s received invalid opcode 0x%x", addr,
                    __func__, op);
@@ -658,8 +674,8 @@ bool Cmpb::Text(const uint8_t op, const uint8_t* data, const uint64_t addr,
 bool Cmpd1::TextxA0(const uint8_t* data, const uint64_t addr, size_t& len,
                     std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto data4 = Instruction::GetData4High(data, 2);
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto data4 = Instruction::GetData4High(data);
+  const auto rwn = Instruction::GetData4Low(data);
 
   ITEXT("cmpd1")
 
@@ -677,9 +693,8 @@ bool Cmpd1::TextxA0(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Cmpd1::TextxA2(const uint8_t* data, const uint64_t addr, size_t& len,
                     std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
+  const auto rwn = Instruction::GetData4Low(data);
 
   ITEXT("cmpd1")
 
@@ -697,8 +712,8 @@ bool Cmpd1::TextxA2(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Cmpd1::TextxA6(const uint8_t* data, const uint64_t addr, size_t& len,
                     std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto data16 = Instruction::GetData16(data, 4);
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto data16 = Instruction::GetData16(data);
+  const auto rwn = Instruction::GetData4Low(data);
 
   ITEXT("cmpd1")
 
@@ -716,8 +731,8 @@ bool Cmpd1::TextxA6(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Cmpd2::TextxB0(const uint8_t* data, const uint64_t addr, size_t& len,
                     std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto data4 = Instruction::GetData4High(data, 2);
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto data4 = Instruction::GetData4High(data);
+  const auto rwn = Instruction::GetData4Low(data);
 
   ITEXT("cmpd2")
 
@@ -735,9 +750,8 @@ bool Cmpd2::TextxB0(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Cmpd2::TextxB2(const uint8_t* data, const uint64_t addr, size_t& len,
                     std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
+  const auto rwn = Instruction::GetData4Low(data);
 
   ITEXT("cmpd2")
 
@@ -755,8 +769,8 @@ bool Cmpd2::TextxB2(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Cmpd2::TextxB6(const uint8_t* data, const uint64_t addr, size_t& len,
                     std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto data16 = Instruction::GetData16(data, 4);
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto data16 = Instruction::GetData16(data);
+  const auto rwn = Instruction::GetData4Low(data);
 
   ITEXT("cmpd2")
 
@@ -774,8 +788,8 @@ bool Cmpd2::TextxB6(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Cmpi1::Textx80(const uint8_t* data, const uint64_t addr, size_t& len,
                     std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto data4 = Instruction::GetData4High(data, 2);
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto data4 = Instruction::GetData4High(data);
+  const auto rwn = Instruction::GetData4Low(data);
 
   ITEXT("cmpi1")
 
@@ -793,9 +807,8 @@ bool Cmpi1::Textx80(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Cmpi1::Textx82(const uint8_t* data, const uint64_t addr, size_t& len,
                     std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
+  const auto rwn = Instruction::GetData4Low(data);
 
   ITEXT("cmpi1")
 
@@ -813,8 +826,8 @@ bool Cmpi1::Textx82(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Cmpi1::Textx86(const uint8_t* data, const uint64_t addr, size_t& len,
                     std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto data16 = Instruction::GetData16(data, 4);
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto data16 = Instruction::GetData16(data);
+  const auto rwn = Instruction::GetData4Low(data);
 
   ITEXT("cmpi1")
 
@@ -832,8 +845,8 @@ bool Cmpi1::Textx86(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Cmpi2::Textx90(const uint8_t* data, const uint64_t addr, size_t& len,
                     std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto data4 = Instruction::GetData4High(data, 2);
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto data4 = Instruction::GetData4High(data);
+  const auto rwn = Instruction::GetData4Low(data);
 
   ITEXT("cmpi2")
 
@@ -851,9 +864,8 @@ bool Cmpi2::Textx90(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Cmpi2::Textx92(const uint8_t* data, const uint64_t addr, size_t& len,
                     std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
+  const auto rwn = Instruction::GetData4Low(data);
 
   ITEXT("cmpi2")
 
@@ -871,8 +883,8 @@ bool Cmpi2::Textx92(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Cmpi2::Textx96(const uint8_t* data, const uint64_t addr, size_t& len,
                     std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto data16 = Instruction::GetData16(data, 4);
-  const auto rwn = Instruction::GetData4Low(data, 2);
+  const auto data16 = Instruction::GetData16(data);
+  const auto rwn = Instruction::GetData4Low(data);
 
   ITEXT("cmpi2")
 
@@ -890,7 +902,7 @@ bool Cmpi2::Textx96(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Cpl::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, length);
+  const auto rwn = Instruction::GetData4High(data);
 
   ITEXT("cpl")
 
@@ -904,7 +916,7 @@ bool Cpl::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Cplb::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rbn = Instruction::GetData4High(data, length) + 16;
+  const auto rbn = Instruction::GetData4High(data) + 16;
 
   ITEXT("cplb")
 
@@ -925,7 +937,7 @@ bool Diswdt::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Div::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, length);
+  const auto rwn = Instruction::GetData4High(data);
 
   ITEXT("div")
 
@@ -939,7 +951,7 @@ bool Div::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Divl::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, length);
+  const auto rwn = Instruction::GetData4High(data);
 
   ITEXT("divl")
 
@@ -953,7 +965,7 @@ bool Divl::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Divlu::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, length);
+  const auto rwn = Instruction::GetData4High(data);
 
   ITEXT("divlu")
 
@@ -967,7 +979,7 @@ bool Divlu::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Divu::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, length);
+  const auto rwn = Instruction::GetData4High(data);
 
   ITEXT("divu")
 
@@ -988,9 +1000,8 @@ bool Einit::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool ExtrAtomic::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                       std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto instr = *(const uint16_t*)data;
-  uint8_t scode = (instr & (0b11u << 14u)) >> 14u;
-  uint8_t count = ((instr & (0b11u << 12u)) >> 12u) + 1u;
+  uint8_t scode = Formats::Get<Formats::Ext::subop>(data);
+  uint8_t count = Formats::Get<Formats::Ext::irang2>(data) + 1u;
 
   if (scode == 0b10) {
     ITEXT("extr")
@@ -1012,10 +1023,9 @@ bool ExtrAtomic::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Extprs::TextxD7(const uint8_t* data, const uint64_t addr, size_t& len,
                      std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const uint16_t instr = *(const uint16_t*)data;
-  const char* const mnemonic = Extprs::GetInstruction(data, addr, 4);
-  uint16_t pag_seg = Instruction::GetData16(data, 4);
-  uint8_t count = ((instr & (0b11u << 12u)) >> 12u) + 1;
+  const char* const mnemonic = Extprs::GetInstruction(data, addr);
+  uint16_t pag_seg = Instruction::GetData16(data);
+  uint8_t count = Formats::Get<Formats::Ext::irang2>(data) + 1;
 
   ITEXT(mnemonic)
 
@@ -1033,10 +1043,9 @@ bool Extprs::TextxD7(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Extprs::TextxDC(const uint8_t* data, const uint64_t addr, size_t& len,
                      std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const uint16_t instr = *(const uint16_t*)data;
-  const char* const mnemonic = Extprs::GetInstruction(data, addr, 4);
-  const auto rwm = Instruction::GetData4Low(data, 2);
-  uint8_t count = ((instr & (0b11u << 12u)) >> 12u) + 1;
+  const char* const mnemonic = Extprs::GetInstruction(data, addr);
+  const auto rwm = Instruction::GetData4Low(data);
+  uint8_t count = Formats::Get<Formats::Ext::irang2>(data) + 1;
 
   ITEXT(mnemonic)
 
@@ -1061,9 +1070,10 @@ bool Idle::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Jb::Text(const uint8_t* data, const uint64_t addr, size_t& len,
               std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto target = Jb::GetTarget(data, addr, length);
-  const auto bitaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  const auto bitpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
+  const auto target = Jb::GetTarget(data, addr);
+  const auto bitaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitRel::bitoff>(data));
+  const auto bitpos = Formats::Get<Formats::BitRel::bitpos>(data);
 
   ITEXT("jb")
 
@@ -1090,9 +1100,10 @@ bool Jb::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Jbc::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto target = Jbc::GetTarget(data, addr, length);
-  const auto bitaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  const auto bitpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
+  const auto target = Jbc::GetTarget(data, addr);
+  const auto bitaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitRel::bitoff>(data));
+  const auto bitpos = Formats::Get<Formats::BitRel::bitpos>(data);
 
   ITEXT("jbc")
 
@@ -1120,8 +1131,8 @@ bool Jmpa::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
   const char* const code =
-      Instruction::ConditionCodeToString(Jmpa::GetConditionCode(data, length));
-  auto target = Jmpa::GetTarget(data, addr, length);
+      Instruction::ConditionCodeToString(Jmpa::GetConditionCode(data));
+  auto target = Jmpa::GetTarget(data, addr);
 
   ITEXT("jmpa")
 
@@ -1140,8 +1151,8 @@ bool Jmpi::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
   const char* const code = Instruction::ConditionCodeToString(
-      Instruction::GetData4High(data, length));
-  const auto rwn = Instruction::GetData4Low(data, length);
+      Instruction::GetData4High(data));
+  const auto rwn = Instruction::GetData4Low(data);
 
   ITEXT("jmpi")
 
@@ -1160,8 +1171,8 @@ bool Jmpr::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
   const char* const code =
-      Instruction::ConditionCodeToString(Jmpr::GetConditionCode(data, length));
-  const auto target = Jmpr::GetTarget(data, addr, length);
+      Instruction::ConditionCodeToString(Jmpr::GetConditionCode(data));
+  const auto target = Jmpr::GetTarget(data, addr);
 
   ITEXT("jmpr")
 
@@ -1178,8 +1189,8 @@ bool Jmpr::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Jmps::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  uint8_t seg = Instruction::GetOpSeg(data, length);
-  uint16_t caddr = Instruction::GetOpCaddr(data, length);
+  uint8_t seg = Instruction::GetOpSeg(data);
+  uint16_t caddr = Instruction::GetOpCaddr(data);
 
   ITEXT("jmps")
 
@@ -1196,9 +1207,10 @@ bool Jmps::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Jnb::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto target = Jnb::GetTarget(data, addr, length);
-  const auto bitaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  const auto bitpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
+  const auto target = Jnb::GetTarget(data, addr);
+  const auto bitaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitRel::bitoff>(data));
+  const auto bitpos = Formats::Get<Formats::BitRel::bitpos>(data);
 
   ITEXT("jnb")
 
@@ -1225,9 +1237,10 @@ bool Jnb::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Jnbs::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto target = Jnbs::GetTarget(data, addr, length);
-  const auto bitaddr = Instruction::TranslateBitOff(addr, *(data + 1));
-  const auto bitpos = (*(data + 3) & (0xFu << 4u)) >> 4u;
+  const auto target = Jnbs::GetTarget(data, addr);
+  const auto bitaddr = Instruction::TranslateBitOff(
+      addr, Formats::Get<Formats::BitRel::bitoff>(data));
+  const auto bitpos = Formats::Get<Formats::BitRel::bitpos>(data);
 
   ITEXT("jnbs")
 
@@ -1254,9 +1267,8 @@ bool Jnbs::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Mov::Textx84(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4Low(data, 2);
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
 
   result.emplace_back(InstructionToken, "mov");
   result.emplace_back(TextToken, " [");
@@ -1275,8 +1287,8 @@ bool Mov::Textx84(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Mov::Textx88(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   result.emplace_back(InstructionToken, "mov");
   result.emplace_back(TextToken, " [-");
@@ -1296,9 +1308,8 @@ bool Mov::Textx88(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Mov::Textx94(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4Low(data, 2);
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
 
   ITEXT("mov")
 
@@ -1317,8 +1328,8 @@ bool Mov::Textx94(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Mov::Textx98(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   ITEXT("mov")
 
@@ -1337,8 +1348,8 @@ bool Mov::Textx98(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Mov::TextxA8(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   ITEXT("mov")
 
@@ -1356,8 +1367,8 @@ bool Mov::TextxA8(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Mov::TextxB8(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   result.emplace_back(InstructionToken, "mov");
   result.emplace_back(TextToken, " [");
@@ -1376,9 +1387,9 @@ bool Mov::TextxB8(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Mov::TextxC4(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
-  const auto data16 = Instruction::GetData16(data, 4);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
+  const auto data16 = Instruction::GetData16(data);
 
   result.emplace_back(InstructionToken, "mov");
   result.emplace_back(TextToken, " [");
@@ -1400,8 +1411,8 @@ bool Mov::TextxC4(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Mov::TextxC8(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   result.emplace_back(InstructionToken, "mov");
   result.emplace_back(TextToken, " [");
@@ -1421,9 +1432,9 @@ bool Mov::TextxC8(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Mov::TextxD4(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
-  const auto data16 = Instruction::GetData16(data, 4);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
+  const auto data16 = Instruction::GetData16(data);
 
   ITEXT("mov")
 
@@ -1448,8 +1459,8 @@ bool Mov::TextxD4(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Mov::TextxD8(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   result.emplace_back(InstructionToken, "mov");
   result.emplace_back(TextToken, " [");
@@ -1469,8 +1480,8 @@ bool Mov::TextxD8(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Mov::TextxE0(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4Low(data, 2);
-  uint16_t data4 = Instruction::GetData4High(data, 2);
+  const auto rwn = Instruction::GetData4Low(data);
+  uint16_t data4 = Instruction::GetData4High(data);
 
   ITEXT("mov")
 
@@ -1489,8 +1500,8 @@ bool Mov::TextxE6(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
   const auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, 4));
-  const auto data16 = Instruction::GetData16(data, 4);
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
+  const auto data16 = Instruction::GetData16(data);
 
   ITEXT("mov")
 
@@ -1513,8 +1524,8 @@ bool Mov::TextxE6(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Mov::TextxE8(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   result.emplace_back(InstructionToken, "mov");
   result.emplace_back(TextToken, " [");
@@ -1534,8 +1545,8 @@ bool Mov::TextxE8(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Mov::TextxF0(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   ITEXT("mov")
 
@@ -1553,9 +1564,8 @@ bool Mov::TextxF2(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
   const auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, 4));
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
 
   ITEXT("mov")
 
@@ -1579,10 +1589,9 @@ bool Mov::TextxF2(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Mov::TextxF6(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
   const auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, 4));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
 
   ITEXT("mov")
 
@@ -1603,8 +1612,8 @@ bool Mov::TextxF6(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Movb::Textx89(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rbn = Instruction::GetData4High(data, 2) + 16;
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rbn = Instruction::GetData4High(data) + 16;
+  const auto rwm = Instruction::GetData4Low(data);
 
   result.emplace_back(InstructionToken, "mov");
   result.emplace_back(TextToken, " [-");
@@ -1624,8 +1633,8 @@ bool Movb::Textx89(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Movb::Textx99(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rbn = Instruction::GetData4High(data, 2) + 16;
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rbn = Instruction::GetData4High(data) + 16;
+  const auto rwm = Instruction::GetData4Low(data);
 
   ITEXT("movb")
 
@@ -1644,9 +1653,8 @@ bool Movb::Textx99(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Movb::TextxA4(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4Low(data, 2);
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
 
   result.emplace_back(InstructionToken, "movb");
   result.emplace_back(TextToken, " [");
@@ -1665,9 +1673,8 @@ bool Movb::TextxA4(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Movb::TextxB4(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4Low(data, 2);
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
 
   ITEXT("movb")
 
@@ -1686,8 +1693,8 @@ bool Movb::TextxB4(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Movb::TextxA9(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rbn = Instruction::GetData4High(data, 2) + 16;
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rbn = Instruction::GetData4High(data) + 16;
+  const auto rwm = Instruction::GetData4Low(data);
 
   ITEXT("movb")
 
@@ -1705,8 +1712,8 @@ bool Movb::TextxA9(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Movb::TextxB9(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rbn = Instruction::GetData4High(data, 2) + 16;
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rbn = Instruction::GetData4High(data) + 16;
+  const auto rwm = Instruction::GetData4Low(data);
 
   result.emplace_back(InstructionToken, "movb");
   result.emplace_back(TextToken, " [");
@@ -1725,8 +1732,8 @@ bool Movb::TextxB9(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Movb::TextxC9(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   result.emplace_back(InstructionToken, "movb");
   result.emplace_back(TextToken, " [");
@@ -1746,8 +1753,8 @@ bool Movb::TextxC9(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Movb::TextxD9(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   result.emplace_back(InstructionToken, "movb");
   result.emplace_back(TextToken, " [");
@@ -1767,9 +1774,9 @@ bool Movb::TextxD9(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Movb::TextxE4(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rbn = Instruction::GetData4High(data, 2) + 16;
-  const auto rwm = Instruction::GetData4Low(data, 2);
-  const auto data16 = Instruction::GetData16(data, 4);
+  const auto rbn = Instruction::GetData4High(data) + 16;
+  const auto rwm = Instruction::GetData4Low(data);
+  const auto data16 = Instruction::GetData16(data);
 
   result.emplace_back(InstructionToken, "movb");
   result.emplace_back(TextToken, " [");
@@ -1791,8 +1798,8 @@ bool Movb::TextxE4(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Movb::TextxE9(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, 2);
-  const auto rwm = Instruction::GetData4Low(data, 2);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   result.emplace_back(InstructionToken, "movb");
   result.emplace_back(TextToken, " [");
@@ -1812,8 +1819,8 @@ bool Movb::TextxE9(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Movb::TextxE1(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rbn = Instruction::GetData4Low(data, 2) + 16;
-  const auto data4 = Instruction::GetData4High(data, 2);
+  const auto rbn = Instruction::GetData4Low(data) + 16;
+  const auto data4 = Instruction::GetData4High(data);
 
   ITEXT("movb")
 
@@ -1832,8 +1839,8 @@ bool Movb::TextxE7(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
   auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, 4));
-  uint16_t data8 = Instruction::GetData8Low(data, 4);
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
+  uint16_t data8 = Instruction::GetData8Low(data);
 
   ITEXT("movb")
 
@@ -1857,8 +1864,8 @@ bool Movb::TextxE7(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Movb::TextxF1(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rbn = Instruction::GetData4High(data, 2) + 16;
-  const auto rbm = Instruction::GetData4Low(data, 2) + 16;
+  const auto rbn = Instruction::GetData4High(data) + 16;
+  const auto rbm = Instruction::GetData4Low(data) + 16;
 
   ITEXT("movb")
 
@@ -1876,9 +1883,8 @@ bool Movb::TextxF3(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
   auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, 4));
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
 
   ITEXT("movb")
 
@@ -1902,9 +1908,9 @@ bool Movb::TextxF3(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Movb::TextxF4(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rbn = Instruction::GetData4High(data, 2) + 16;
-  const auto rwm = Instruction::GetData4Low(data, 2);
-  const auto data16 = Instruction::GetData16(data, 4);
+  const auto rbn = Instruction::GetData4High(data) + 16;
+  const auto rwm = Instruction::GetData4Low(data);
+  const auto data16 = Instruction::GetData16(data);
 
   ITEXT("movb")
 
@@ -1929,10 +1935,9 @@ bool Movb::TextxF4(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Movb::TextxF7(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
   auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, 4));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
 
   ITEXT("movb")
 
@@ -1954,8 +1959,8 @@ bool Movb::TextxF7(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Movbs::TextxD0(const uint8_t* data, const uint64_t addr, size_t& len,
                     std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4Low(data, 2);
-  const auto rbm = Instruction::GetData4High(data, 2) + 16;
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto rbm = Instruction::GetData4High(data) + 16;
 
   ITEXT("movbs")
 
@@ -1974,9 +1979,8 @@ bool Movbs::TextxD2(const uint8_t* data, const uint64_t addr, size_t& len,
                     std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
   const auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, 4));
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
 
   ITEXT("movbs")
 
@@ -1999,10 +2003,9 @@ bool Movbs::TextxD2(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Movbs::TextxD5(const uint8_t* data, const uint64_t addr, size_t& len,
                     std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
   auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, 4));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
 
   ITEXT("movbs")
 
@@ -2024,8 +2027,8 @@ bool Movbs::TextxD5(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Movbz::TextxC0(const uint8_t* data, const uint64_t addr, size_t& len,
                     std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4Low(data, 2);
-  const auto rbm = Instruction::GetData4High(data, 2) + 16;
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto rbm = Instruction::GetData4High(data) + 16;
 
   ITEXT("movbz")
 
@@ -2044,9 +2047,8 @@ bool Movbz::TextxC2(const uint8_t* data, const uint64_t addr, size_t& len,
                     std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
   const auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, 4));
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
 
   ITEXT("movbz")
 
@@ -2069,10 +2071,9 @@ bool Movbz::TextxC2(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Movbz::TextxC5(const uint8_t* data, const uint64_t addr, size_t& len,
                     std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
   auto reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, 4));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
 
   ITEXT("movbz")
 
@@ -2094,8 +2095,8 @@ bool Movbz::TextxC5(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Mul::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, length);
-  const auto rwm = Instruction::GetData4Low(data, length);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   ITEXT("mul")
 
@@ -2113,8 +2114,8 @@ bool Mul::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Mulu::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, length);
-  const auto rwm = Instruction::GetData4Low(data, length);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   ITEXT("mulu")
 
@@ -2132,7 +2133,7 @@ bool Mulu::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Neg::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, length);
+  const auto rwn = Instruction::GetData4High(data);
 
   ITEXT("neg")
 
@@ -2146,7 +2147,7 @@ bool Neg::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Negb::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rbn = Instruction::GetData4High(data, length) + 16;
+  const auto rbn = Instruction::GetData4High(data) + 16;
 
   ITEXT("negb")
 
@@ -2169,19 +2170,19 @@ bool Or::Text(const uint8_t op, const uint8_t* data, const uint64_t addr,
   switch (op) {
     case Opcodes::OR_RWN_RWM:
       len = 2;
-      return Instruction::TextOpRnRm(data, len, 2, result, "or");
+      return Instruction::TextOpRnRm(data, 2, result, "or");
     case Opcodes::OR_RWN_RWI_DATA3:
       len = 2;
-      return Instruction::TextOpRnRwiData3(data, len, 2, result, "or");
+      return Instruction::TextOpRnRwiData3(data, 2, result, "or");
     case Opcodes::OR_REG_DATA16:
       len = 4;
-      return Instruction::TextOpRegData(addr, data, len, 2, result, "or");
+      return Instruction::TextOpRegData(addr, data, 2, result, "or");
     case Opcodes::OR_REG_MEM:
       len = 4;
-      return Instruction::TextOpRegMem(addr, data, len, 2, result, "or");
+      return Instruction::TextOpRegMem(addr, data, 2, result, "or");
     case Opcodes::OR_MEM_REG:
       len = 4;
-      return Instruction::TextOpMemReg(addr, data, len, 2, result, "or");
+      return Instruction::TextOpMemReg(addr, data, 2, result, "or");
     default:
       BN::LogError("0x%lx: Or::%s received invalid opcode 0x%x", addr, __func__,
                    op);
@@ -2194,19 +2195,19 @@ bool Orb::Text(const uint8_t op, const uint8_t* data, const uint64_t addr,
   switch (op) {
     case Opcodes::ORB_RBN_RBM:
       len = 2;
-      return Instruction::TextOpRnRm(data, len, 1, result, "orb");
+      return Instruction::TextOpRnRm(data, 1, result, "orb");
     case Opcodes::ORB_RBN_RWI_DATA3:
       len = 2;
-      return Instruction::TextOpRnRwiData3(data, len, 1, result, "orb");
+      return Instruction::TextOpRnRwiData3(data, 1, result, "orb");
     case Opcodes::ORB_REG_DATA8:
       len = 4;
-      return Instruction::TextOpRegData(addr, data, len, 1, result, "orb");
+      return Instruction::TextOpRegData(addr, data, 1, result, "orb");
     case Opcodes::ORB_REG_MEM:
       len = 4;
-      return Instruction::TextOpRegMem(addr, data, len, 1, result, "orb");
+      return Instruction::TextOpRegMem(addr, data, 1, result, "orb");
     case Opcodes::ORB_MEM_REG:
       len = 4;
-      return Instruction::TextOpMemReg(addr, data, len, 1, result, "orb");
+      return Instruction::TextOpMemReg(addr, data, 1, result, "orb");
     default:
       BN::LogError("0x%lx: Orb::%s received invalid opcode 0x%x", addr,
                    __func__, op);
@@ -2214,11 +2215,36 @@ bool Orb::Text(const uint8_t op, const uint8_t* data, const uint64_t addr,
   }
 }
 
+bool Pcall::Text(const uint8_t* data, const uint64_t addr, size_t& len,
+                 std::vector<BN::InstructionTextToken>& result) {
+  char buf[32];
+  const auto reg = Instruction::TranslateReg(
+      addr, Formats::Get<Formats::RegCaddr::reg>(data));
+  const auto target = GetTarget(data, addr);
+
+  ITEXT("pcall")
+
+  if (reg <= 0xF) {
+    std::snprintf(buf, sizeof(buf), "%s", Instruction::RegToStr(reg));
+    result.emplace_back(RegisterToken, buf, reg);
+  } else {
+    std::snprintf(buf, sizeof(buf), "0x%x", reg);
+    result.emplace_back(PossibleAddressToken, buf, reg);
+  }
+  result.emplace_back(OperandSeparatorToken, ", ");
+
+  std::snprintf(buf, sizeof(buf), "0x%x", target);
+  result.emplace_back(PossibleAddressToken, buf, target);
+
+  len = length;
+  return true;
+}
+
 bool Pop::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
   const auto reg = Instruction::TranslateReg(
-      addr, Instruction::GetRegShortAddr(data, length));
+      addr, Instruction::GetRegShortAddr(data));
 
   ITEXT("pop")
 
@@ -2237,8 +2263,8 @@ bool Pop::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Prior::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                  std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, length);
-  const auto rwm = Instruction::GetData4Low(data, length);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   ITEXT("prior")
 
@@ -2257,7 +2283,7 @@ bool Push::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
   const auto reg = Instruction::TranslateReg(
-      addr, Instruction::GetRegShortAddr(data, length));
+      addr, Instruction::GetRegShortAddr(data));
 
   ITEXT("push")
 
@@ -2296,7 +2322,20 @@ bool Reti::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 
 bool Retp::Text(const uint8_t* data, const uint64_t addr, size_t& len,
                 std::vector<BN::InstructionTextToken>& result) {
-  result.emplace_back(InstructionToken, "retp");
+  char buf[32];
+  const auto reg = Instruction::TranslateReg(
+      addr, Instruction::GetRegShortAddr(data));
+
+  ITEXT("retp")
+
+  if (reg <= 0xF) {
+    std::snprintf(buf, sizeof(buf), "%s", Instruction::RegToStr(reg));
+    result.emplace_back(RegisterToken, buf, reg);
+  } else {
+    std::snprintf(buf, sizeof(buf), "0x%x", reg);
+    result.emplace_back(PossibleAddressToken, buf, reg);
+  }
+
   len = length;
   return true;
 }
@@ -2311,8 +2350,8 @@ bool Rets::Text(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Rol::Textx0C(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, length);
-  const auto rwm = Instruction::GetData4Low(data, length);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   ITEXT("rol")
 
@@ -2330,8 +2369,8 @@ bool Rol::Textx0C(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Rol::Textx1C(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4Low(data, length);
-  const auto data4 = Instruction::GetData4High(data, length);
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto data4 = Instruction::GetData4High(data);
 
   ITEXT("rol")
 
@@ -2349,8 +2388,8 @@ bool Rol::Textx1C(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Ror::Textx2C(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, length);
-  const auto rwm = Instruction::GetData4Low(data, length);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   ITEXT("ror")
 
@@ -2368,8 +2407,8 @@ bool Ror::Textx2C(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Ror::Textx3C(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4Low(data, length);
-  const auto data4 = Instruction::GetData4High(data, length);
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto data4 = Instruction::GetData4High(data);
 
   ITEXT("ror")
 
@@ -2388,8 +2427,8 @@ bool Scxt::TextxC6(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
   const auto reg = Instruction::TranslateReg(
-      addr, Instruction::GetRegShortAddr(data, length));
-  const auto data16 = Instruction::GetData16(data, length);
+      addr, Instruction::GetRegShortAddr(data));
+  const auto data16 = Instruction::GetData16(data);
 
   ITEXT("scxt")
 
@@ -2413,9 +2452,8 @@ bool Scxt::TextxD6(const uint8_t* data, const uint64_t addr, size_t& len,
                    std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
   const auto reg = Instruction::TranslateReg(
-      addr, Instruction::GetRegShortAddr(data, length));
-  const auto mem =
-      Instruction::TranslateMem(Instruction::GetMem(addr, data, length));
+      addr, Instruction::GetRegShortAddr(data));
+  const auto mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
 
   ITEXT("scxt")
 
@@ -2438,8 +2476,8 @@ bool Scxt::TextxD6(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Shl::Textx4C(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, length);
-  const auto rwm = Instruction::GetData4Low(data, length);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   ITEXT("shl")
 
@@ -2457,8 +2495,8 @@ bool Shl::Textx4C(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Shl::Textx5C(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4Low(data, length);
-  const auto data4 = Instruction::GetData4High(data, length);
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto data4 = Instruction::GetData4High(data);
 
   ITEXT("shl")
 
@@ -2476,8 +2514,8 @@ bool Shl::Textx5C(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Shr::Textx6C(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4High(data, length);
-  const auto rwm = Instruction::GetData4Low(data, length);
+  const auto rwn = Instruction::GetData4High(data);
+  const auto rwm = Instruction::GetData4Low(data);
 
   ITEXT("shr")
 
@@ -2495,8 +2533,8 @@ bool Shr::Textx6C(const uint8_t* data, const uint64_t addr, size_t& len,
 bool Shr::Textx7C(const uint8_t* data, const uint64_t addr, size_t& len,
                   std::vector<BN::InstructionTextToken>& result) {
   char buf[32];
-  const auto rwn = Instruction::GetData4Low(data, length);
-  const auto data4 = Instruction::GetData4High(data, length);
+  const auto rwn = Instruction::GetData4Low(data);
+  const auto data4 = Instruction::GetData4High(data);
 
   ITEXT("shr")
 
@@ -2530,19 +2568,19 @@ bool Sub::Text(const uint8_t op, const uint8_t* data, const uint64_t addr,
   switch (op) {
     case Opcodes::SUB_RWN_RWM:
       len = 2;
-      return Instruction::TextOpRnRm(data, len, 2, result, "sub");
+      return Instruction::TextOpRnRm(data, 2, result, "sub");
     case Opcodes::SUB_RWN_RWI_DATA3:
       len = 2;
-      return Instruction::TextOpRnRwiData3(data, len, 2, result, "sub");
+      return Instruction::TextOpRnRwiData3(data, 2, result, "sub");
     case Opcodes::SUB_REG_DATA16:
       len = 4;
-      return Instruction::TextOpRegData(addr, data, len, 2, result, "sub");
+      return Instruction::TextOpRegData(addr, data, 2, result, "sub");
     case Opcodes::SUB_REG_MEM:
       len = 4;
-      return Instruction::TextOpRegMem(addr, data, len, 2, result, "sub");
+      return Instruction::TextOpRegMem(addr, data, 2, result, "sub");
     case Opcodes::SUB_MEM_REG:
       len = 4;
-      return Instruction::TextOpMemReg(addr, data, len, 2, result, "sub");
+      return Instruction::TextOpMemReg(addr, data, 2, result, "sub");
     default:
       BN::LogError("0x%lx: Sub::%s received invalid opcode 0x%x", addr,
                    __func__, op);
@@ -2555,19 +2593,19 @@ bool Subb::Text(const uint8_t op, const uint8_t* data, const uint64_t addr,
   switch (op) {
     case Opcodes::SUBB_RBN_RBM:
       len = 2;
-      return Instruction::TextOpRnRm(data, len, 1, result, "subb");
+      return Instruction::TextOpRnRm(data, 1, result, "subb");
     case Opcodes::SUBB_RBN_RWI_DATA3:
       len = 2;
-      return Instruction::TextOpRnRwiData3(data, len, 1, result, "subb");
+      return Instruction::TextOpRnRwiData3(data, 1, result, "subb");
     case Opcodes::SUBB_REG_DATA8:
       len = 4;
-      return Instruction::TextOpRegData(addr, data, len, 1, result, "subb");
+      return Instruction::TextOpRegData(addr, data, 1, result, "subb");
     case Opcodes::SUBB_REG_MEM:
       len = 4;
-      return Instruction::TextOpRegMem(addr, data, len, 1, result, "subb");
+      return Instruction::TextOpRegMem(addr, data, 1, result, "subb");
     case Opcodes::SUBB_MEM_REG:
       len = 4;
-      return Instruction::TextOpMemReg(addr, data, len, 1, result, "subb");
+      return Instruction::TextOpMemReg(addr, data, 1, result, "subb");
     default:
       BN::LogError("0x%lx: Subb::%s received invalid opcode 0x%x", addr,
                    __func__, op);
@@ -2581,19 +2619,19 @@ bool Subc::Text(const uint8_t op, const uint8_t* data, const uint64_t addr,
   switch (op) {
     case Opcodes::SUBC_RWN_RWM:
       len = 2;
-      return Instruction::TextOpRnRm(data, len, 2, result, "subc");
+      return Instruction::TextOpRnRm(data, 2, result, "subc");
     case Opcodes::SUBC_RWN_RWI_DATA3:
       len = 2;
-      return Instruction::TextOpRnRwiData3(data, len, 2, result, "subc");
+      return Instruction::TextOpRnRwiData3(data, 2, result, "subc");
     case Opcodes::SUBC_REG_DATA16:
       len = 4;
-      return Instruction::TextOpRegData(addr, data, len, 2, result, "subc");
+      return Instruction::TextOpRegData(addr, data, 2, result, "subc");
     case Opcodes::SUBC_REG_MEM:
       len = 4;
-      return Instruction::TextOpRegMem(addr, data, len, 2, result, "subc");
+      return Instruction::TextOpRegMem(addr, data, 2, result, "subc");
     case Opcodes::SUBC_MEM_REG:
       len = 4;
-      return Instruction::TextOpMemReg(addr, data, len, 2, result, "subc");
+      return Instruction::TextOpMemReg(addr, data, 2, result, "subc");
     default:
       BN::LogError("0x%lx: Subc::%s received invalid opcode 0x%x", addr,
                    __func__, op);
@@ -2606,19 +2644,19 @@ bool Subcb::Text(const uint8_t op, const uint8_t* data, const uint64_t addr,
   switch (op) {
     case Opcodes::SUBCB_RBN_RBM:
       len = 2;
-      return Instruction::TextOpRnRm(data, len, 1, result, "subcb");
+      return Instruction::TextOpRnRm(data, 1, result, "subcb");
     case Opcodes::SUBCB_RBN_RWI_DATA3:
       len = 2;
-      return Instruction::TextOpRnRwiData3(data, len, 1, result, "subcb");
+      return Instruction::TextOpRnRwiData3(data, 1, result, "subcb");
     case Opcodes::SUBCB_REG_DATA8:
       len = 4;
-      return Instruction::TextOpRegData(addr, data, len, 1, result, "subcb");
+      return Instruction::TextOpRegData(addr, data, 1, result, "subcb");
     case Opcodes::SUBCB_REG_MEM:
       len = 4;
-      return Instruction::TextOpRegMem(addr, data, len, 1, result, "subcb");
+      return Instruction::TextOpRegMem(addr, data, 1, result, "subcb");
     case Opcodes::SUBCB_MEM_REG:
       len = 4;
-      return Instruction::TextOpMemReg(addr, data, len, 1, result, "subcb");
+      return Instruction::TextOpMemReg(addr, data, 1, result, "subcb");
     default:
       BN::LogError("0x%lx: Subcb::%s received invalid opcode 0x%x", addr,
                    __func__, op);
@@ -2646,19 +2684,19 @@ bool Xor::Text(const uint8_t op, const uint8_t* data, const uint64_t addr,
   switch (op) {
     case Opcodes::XOR_RWN_RWM:
       len = 2;
-      return Instruction::TextOpRnRm(data, len, 2, result, "xor");
+      return Instruction::TextOpRnRm(data, 2, result, "xor");
     case Opcodes::XOR_RWN_RWI_DATA3:
       len = 2;
-      return Instruction::TextOpRnRwiData3(data, len, 2, result, "xor");
+      return Instruction::TextOpRnRwiData3(data, 2, result, "xor");
     case Opcodes::XOR_REG_DATA16:
       len = 4;
-      return Instruction::TextOpRegData(addr, data, len, 2, result, "xor");
+      return Instruction::TextOpRegData(addr, data, 2, result, "xor");
     case Opcodes::XOR_REG_MEM:
       len = 4;
-      return Instruction::TextOpRegMem(addr, data, len, 2, result, "xor");
+      return Instruction::TextOpRegMem(addr, data, 2, result, "xor");
     case Opcodes::XOR_MEM_REG:
       len = 4;
-      return Instruction::TextOpMemReg(addr, data, len, 2, result, "xor");
+      return Instruction::TextOpMemReg(addr, data, 2, result, "xor");
     default:
       BN::LogError("0x%lx: Xor::%s received invalid opcode 0x%x", addr,
                    __func__, op);
@@ -2671,19 +2709,19 @@ bool Xorb::Text(const uint8_t op, const uint8_t* data, const uint64_t addr,
   switch (op) {
     case Opcodes::XORB_RBN_RBM:
       len = 2;
-      return Instruction::TextOpRnRm(data, len, 1, result, "xorb");
+      return Instruction::TextOpRnRm(data, 1, result, "xorb");
     case Opcodes::XORB_RBN_RWI_DATA3:
       len = 2;
-      return Instruction::TextOpRnRwiData3(data, len, 1, result, "xorb");
+      return Instruction::TextOpRnRwiData3(data, 1, result, "xorb");
     case Opcodes::XORB_REG_DATA8:
       len = 4;
-      return Instruction::TextOpRegData(addr, data, len, 1, result, "xorb");
+      return Instruction::TextOpRegData(addr, data, 1, result, "xorb");
     case Opcodes::XORB_REG_MEM:
       len = 4;
-      return Instruction::TextOpRegMem(addr, data, len, 1, result, "xorb");
+      return Instruction::TextOpRegMem(addr, data, 1, result, "xorb");
     case Opcodes::XORB_MEM_REG:
       len = 4;
-      return Instruction::TextOpMemReg(addr, data, len, 1, result, "xorb");
+      return Instruction::TextOpMemReg(addr, data, 1, result, "xorb");
     default:
       BN::LogError("0x%lx: Xorb::%s received invalid opcode 0x%x", addr,
                    __func__, op);
@@ -7,15 +7,19 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <filesystem>
+#include <memory>
 #include <mutex>
 #include <string>
-#include <unordered_map>
+#include <system_error>
 #include <vector>
 
 #include "conditions.h"
 #include "instructions.h"
+#include "opcodes.h"
 #include "registers.h"
 #include "sfr.h"
+#include "state.h"
 
 namespace BN = BinaryNinja;
 
@@ -25,14 +29,27 @@ namespace BN = BinaryNinja;
 
 namespace C166 {
 
-// Maintain a "global" (map/hashtable) of {address: state} pairings.
+// Maintain "global" tables of {address: state} pairings.
 // State will be an object that can be extended to include any relevant
 // per-instruction (at a given address)
 //     data that can have an effect on the instruction operation (lifting) or
 //     disassembly (text).
-std::unordered_map<uint64_t, InstructionState> StateMap;
+//
+// StateMap holds what the user applied (EXT ranges, DPPs) and is the only tier
+// that gets serialized. SharedStateMap is a sidecar file mapped read-only
+// (e.g. a configuration for a firmware family) that StateMap entries override.
+// DerivedStateMap holds the EXT sequences the lifter propagates from EXTx
+// instructions. An entry is only written when the EXTx itself is lifted, and
+// the core does not necessarily lift it again before the instructions it
+// covers, so the table is unbounded: an evicted entry would silently lose
+// the EXT state.
+StateTable StateMap;
+StateFile SharedStateMap;
+std::string SharedStateMapFile;  // Path SharedStateMap is mapped from
+StateTable DerivedStateMap;
 std::mutex StateMapMutex;
-uint32_t default_dpp[4] = {0x0000, 0x0000, 0x0000, 0x0000};  // Reset Value(s)
+uint32_t default_dpp[4] = {0x0000, 0x0001, 0x0002, 0x0003};  // Reset Value(s)
+bool default_dpp_known = false;  // Set once defaults have been configured
 
 // Default Constructor
 InstructionState::InstructionState() {
@@ -46,12 +63,71 @@ InstructionState::InstructionState() {
   dpp[3] = default_dpp[3];
 }
 
+// Effective state at addr: the user tier (or the shared one where the user set
+// nothing) overlaid with any EXT sequence the lifter derived there. Caller must
+// hold StateMapMutex.
+static bool FindState(const uint64_t addr, InstructionState& state) {
+  bool found =
+      StateMap.Find(addr, state) || SharedStateMap.Find(addr, state);
+
+  InstructionState derived;
+  if (DerivedStateMap.Find(addr, derived)) {
+    state.ext_state |= derived.ext_state;
+    if (derived.ext_state & ExtPage) state.pag10 = derived.pag10;
+    if (derived.ext_state & ExtSegment) state.seg8 = derived.seg8;
+    state.num_insns = derived.num_insns;
+    found = true;
+  }
+
+  return found;
+}
+
+// Applies range to every instruction address in [start, end] of the user
+// tier. DPP ranges skip addresses inside an EXT sequence unless keep_ext is
+// false, in which case they replace it. Caller must hold StateMapMutex.
+static void ApplyRange(const StateRange& range, const uint8_t num_insns,
+                       const bool keep_ext = true) {
+  for (auto addr = range.start; addr <= range.end; addr += 2) {
+    InstructionState state;
+    const bool found = StateMap.Find(addr, state);
+
+    switch (range.kind) {
+      case StateRange::Dpp:
+        // Only set DPP if we are not in an EXT sequence
+        if (keep_ext && found && state.ext_state != ExtNoneCustomDpps &&
+            state.ext_state != ExtNone)
+          continue;
+
+        state.ext_state = ExtNoneCustomDpps;
+        for (int i = 0; i < 4; i++) state.dpp[i] = range.value[i];
+        break;
+      case StateRange::Extp:
+        state.ext_state |= ExtPage;
+        state.pag10 = range.value[0];
+        state.num_insns = num_insns;
+        break;
+      case StateRange::Exts:
+        state.ext_state |= ExtSegment;
+        state.seg8 = range.value[0];
+        state.num_insns = num_insns;
+        break;
+      case StateRange::Extr:
+        state.ext_state |= ExtRegister;
+        state.num_insns = num_insns;
+        break;
+    }
+
+    StateMap.Set(addr, state);
+  }
+}
+
 void Instruction::SetDefaultDpps(uint16_t dpp0, uint16_t dpp1, uint16_t dpp2,
                                  uint16_t dpp3) {
   default_dpp[0] = dpp0;
   default_dpp[1] = dpp1;
   default_dpp[2] = dpp2;
   default_dpp[3] = dpp3;
+  default_dpp_known = true;
 }
 
 // Assumes DPP usage implies no EXT sequence active.
@@ -60,53 +136,24 @@ void Instruction::SetDpps(uint64_t addr, uint16_t dpp0, uint16_t dpp1,
   // BN::LogInfo("util.cpp: SetDpps: addr=0x%lx", addr);
   std::lock_guard<std::mutex> guard(StateMapMutex);
 
-  auto it = StateMap.find(addr);
-  if (it != StateMap.end()) {
-    StateMap[addr].ext_state = ExtNoneCustomDpps;
-    StateMap[addr].dpp[0] = dpp0;
-    StateMap[addr].dpp[1] = dpp1;
-    StateMap[addr].dpp[2] = dpp2;
-    StateMap[addr].dpp[3] = dpp3;
-  } else {
-    // Insert new element
-    InstructionState new_insn_state;
-    new_insn_state.ext_state = ExtNoneCustomDpps;
-    new_insn_state.dpp[0] = dpp0;
-    new_insn_state.dpp[1] = dpp1;
-    new_insn_state.dpp[2] = dpp2;
-    new_insn_state.dpp[3] = dpp3;
-    StateMap[addr] = new_insn_state;
-  }
+  InstructionState state;
+  StateMap.Find(addr, state);
+  state.ext_state = ExtNoneCustomDpps;
+  state.dpp[0] = dpp0;
+  state.dpp[1] = dpp1;
+  state.dpp[2] = dpp2;
+  state.dpp[3] = dpp3;
+  StateMap.Set(addr, state);
 }
 
-// Sets DPP values in a range if no EXT sequence detected.
+// Sets DPP values in a range. With keep_ext, addresses inside an EXT sequence
+// are left untouched; otherwise they are overwritten like SetDpps does.
 void Instruction::SetDppsRange(uint64_t start, uint64_t end, uint16_t dpp0,
-                               uint16_t dpp1, uint16_t dpp2, uint16_t dpp3) {
-  // BN::LogInfo("util.cpp: SetDpps: addr=0x%lx", addr);
+                               uint16_t dpp1, uint16_t dpp2, uint16_t dpp3,
+                               bool keep_ext) {
   std::lock_guard<std::mutex> guard(StateMapMutex);
-
-  for (auto addr = start; addr <= end; addr += 2) {
-    auto it = StateMap.find(addr);
-    // Only set DPP if we are not in an EXT sequence
-    if (it != StateMap.end() &&
-        (StateMap[addr].ext_state == ExtNoneCustomDpps ||
-         StateMap[addr].ext_state == ExtNone)) {
-      StateMap[addr].ext_state = ExtNoneCustomDpps;
-      StateMap[addr].dpp[0] = dpp0;
-      StateMap[addr].dpp[1] = dpp1;
-      StateMap[addr].dpp[2] = dpp2;
-      StateMap[addr].dpp[3] = dpp3;
-    } else {
-      // Insert new element
-      InstructionState new_insn_state;
-      new_insn_state.ext_state = ExtNoneCustomDpps;
-      new_insn_state.dpp[0] = dpp0;
-      new_insn_state.dpp[1] = dpp1;
-      new_insn_state.dpp[2] = dpp2;
-      new_insn_state.dpp[3] = dpp3;
-      StateMap[addr] = new_insn_state;
-    }
-  }
+  ApplyRange({StateRange::Dpp, start, end, {dpp0, dpp1, dpp2, dpp3}}, 0,
+             keep_ext);
 }
 
 void Instruction::SetExtpPag10(uint64_t addr, uint16_t pag10,
@@ -115,139 +162,150 @@ void Instruction::SetExtpPag10(uint64_t addr, uint16_t pag10,
   // pag10);
   std::lock_guard<std::mutex> guard(StateMapMutex);
 
-  auto it = StateMap.find(addr);
-  if (it != StateMap.end()) {
-    StateMap[addr].ext_state |= ExtPage;
-    StateMap[addr].pag10 = pag10;
-    StateMap[addr].num_insns = num_insns;
-  } else {
-    // Insert new element
-    InstructionState new_insn_state;
-    new_insn_state.ext_state = ExtPage;
-    new_insn_state.pag10 = pag10;
-    new_insn_state.num_insns = num_insns;
-    StateMap[addr] = new_insn_state;
-  }
+  InstructionState state;
+  DerivedStateMap.Find(addr, state);
+  state.ext_state |= ExtPage;
+  state.pag10 = pag10;
+  state.num_insns = num_insns;
+  DerivedStateMap.Set(addr, state);
 }
 
 void Instruction::SetExtsSeg8(uint64_t addr, uint16_t seg8, uint8_t num_insns) {
   // BN::LogInfo("util.cpp: SetExtsSeg8: addr=0x%lx, seg8=0x%hx", addr, seg8);
   std::lock_guard<std::mutex> guard(StateMapMutex);
 
-  auto it = StateMap.find(addr);
-  if (it != StateMap.end()) {
-    StateMap[addr].ext_state |= ExtSegment;
-    StateMap[addr].seg8 = seg8;
-    StateMap[addr].num_insns = num_insns;
-  } else {
-    // Insert new element
-    InstructionState new_insn_state;
-    new_insn_state.ext_state = ExtSegment;
-    new_insn_state.seg8 = seg8;
-    new_insn_state.num_insns = num_insns;
-    StateMap[addr] = new_insn_state;
-  }
+  InstructionState state;
+  DerivedStateMap.Find(addr, state);
+  state.ext_state |= ExtSegment;
+  state.seg8 = seg8;
+  state.num_insns = num_insns;
+  DerivedStateMap.Set(addr, state);
 }
 
 void Instruction::SetExtr(uint64_t addr, uint8_t num_insns) {
   // BN::LogInfo("util.cpp: SetExtr: addr=0x%lx", addr);
   std::lock_guard<std::mutex> guard(StateMapMutex);
 
-  if (const auto it = StateMap.find(addr); it != StateMap.end()) {
-    StateMap[addr].ext_state |= ExtRegister;
-    StateMap[addr].num_insns = num_insns;
-  } else {
-    // Insert new element
-    InstructionState new_insn_state;
-    new_insn_state.ext_state = ExtRegister;
-    new_insn_state.num_insns = num_insns;
+  InstructionState state;
+  DerivedStateMap.Find(addr, state);
+  state.ext_state |= ExtRegister;
+  state.num_insns = num_insns;
+  DerivedStateMap.Set(addr, state);
+}
 
-    StateMap[addr] = new_insn_state;
-  }
+// Range variants of the EXT setters, taking the lock once for the whole range
+// (inclusive of end) instead of once per address.
+void Instruction::SetExtpPag10Range(uint64_t start, uint64_t end,
+                                    uint16_t pag10, uint8_t num_insns) {
+  std::lock_guard<std::mutex> guard(StateMapMutex);
+  ApplyRange({StateRange::Extp, start, end, {pag10}}, num_insns);
+}
+
+void Instruction::SetExtsSeg8Range(uint64_t start, uint64_t end, uint16_t seg8,
+                                   uint8_t num_insns) {
+  std::lock_guard<std::mutex> guard(StateMapMutex);
+  ApplyRange({StateRange::Exts, start, end, {seg8}}, num_insns);
+}
+
+void Instruction::SetExtrRange(uint64_t start, uint64_t end,
+                               uint8_t num_insns) {
+  std::lock_guard<std::mutex> guard(StateMapMutex);
+  ApplyRange({StateRange::Extr, start, end, {}}, num_insns);
+}
+
+// Applies a batch of ranges (e.g. from StateImport) under a single lock, in
+// order. Overlaps are resolved as by ApplyRange, not by order alone: a later
+// DPP range replaces earlier DPPs but skips addresses an EXT range covers, and
+// EXT ranges add to the state (replacing only the page or segment of the same
+// kind) rather than clearing it.
+void Instruction::ApplyStateRanges(const std::vector<StateRange>& ranges) {
+  std::lock_guard<std::mutex> guard(StateMapMutex);
+
+  for (const auto& range : ranges) ApplyRange(range, 0);
 }
 
 bool Instruction::ShouldUseExtr(const uint64_t addr) {
   std::lock_guard<std::mutex> guard(StateMapMutex);
-  bool use_extr = false;
 
   // If there's an entry containing extra state information for this address,
   // use it.
-  auto it = StateMap.find(addr);
-  if (it != StateMap.end()) {
-    if (StateMap[addr].ext_state & ExtRegister) {
-      use_extr = true;
-    }
-  }
-
-  return use_extr;
+  InstructionState state;
+  return FindState(addr, state) && (state.ext_state & ExtRegister);
 }
 
 bool Instruction::ShouldUseExts(const uint64_t addr, uint32_t* seg8) {
   std::lock_guard<std::mutex> guard(StateMapMutex);
-  bool use_exts = false;
 
   // If there's an entry containing extra state information for this address,
   // use it.
-  if (const auto it = StateMap.find(addr); it != StateMap.end()) {
-    if (StateMap[addr].ext_state & ExtSegment) {
-      use_exts = true;
-      *seg8 = StateMap[addr].seg8;
-    }
+  InstructionState state;
+  if (FindState(addr, state) && (state.ext_state & ExtSegment)) {
+    *seg8 = state.seg8;
+    return true;
   }
 
-  return use_exts;
+  return false;
 }
 
 bool Instruction::ShouldUseExtp(const uint64_t addr, uint32_t* pag10) {
   std::lock_guard<std::mutex> guard(StateMapMutex);
-  bool use_extp = false;
 
   // If there's an entry containing extra state information for this address,
   // use it.
-  if (const auto it = StateMap.find(addr); it != StateMap.end()) {
-    if (StateMap[addr].ext_state & ExtPage) {
-      use_extp = true;
-      *pag10 = StateMap[addr].pag10;
-    }
+  InstructionState state;
+  if (FindState(addr, state) && (state.ext_state & ExtPage)) {
+    *pag10 = state.pag10;
+    return true;
   }
 
-  return use_extp;
+  return false;
 }
 
 bool Instruction::ShouldUseCustomDpps(const uint64_t addr, uint32_t* dpps) {
   std::lock_guard<std::mutex> guard(StateMapMutex);
-  bool use_custom_dpps = false;
 
   // If there's an entry containing extra state information for this address,
   // use it.
-  if (const auto it = StateMap.find(addr); it != StateMap.end()) {
-    if (StateMap[addr].ext_state & ExtNoneCustomDpps) {
-      use_custom_dpps = true;
-      dpps[0] = StateMap[addr].dpp[0];
-      dpps[1] = StateMap[addr].dpp[1];
-      dpps[2] = StateMap[addr].dpp[2];
-      dpps[3] = StateMap[addr].dpp[3];
-    }
+  InstructionState state;
+  if (FindState(addr, state) && (state.ext_state & ExtNoneCustomDpps)) {
+    dpps[0] = state.dpp[0];
+    dpps[1] = state.dpp[1];
+    dpps[2] = state.dpp[2];
+    dpps[3] = state.dpp[3];
+    return true;
   }
 
-  return use_custom_dpps;
+  return false;
+}
+
+// DPPs in effect at addr when outside an EXT sequence: a custom assignment
+// (applied or inferred) takes precedence over the configured defaults.
+bool Instruction::GetEffectiveDpps(const uint64_t addr, uint32_t* dpps) {
+  if (ShouldUseCustomDpps(addr, dpps)) return true;
+  if (!default_dpp_known) return false;
+
+  dpps[0] = default_dpp[0];
+  dpps[1] = default_dpp[1];
+  dpps[2] = default_dpp[2];
+  dpps[3] = default_dpp[3];
+  return true;
 }
 
 InstructionState Instruction::GetInstructionState(const uint64_t addr) {
   std::lock_guard<std::mutex> guard(StateMapMutex);
 
-  if (StateMap.find(addr) == StateMap.end()) {
-    InstructionState empty = {};
-    return empty;
-  } else {
-    return StateMap[addr];
-  }
+  InstructionState state;
+  FindState(addr, state);
+  return state;
 }
 
+// Only the user tier is serialized. The form keeps the original
+// {uint64_t addr, InstructionState} records so existing "c166_state" metadata
+// remains loadable; derived entries in older blobs are loaded as user state.
 size_t Instruction::SerializeStateMap(uint8_t* buf, size_t size) {
   std::lock_guard<std::mutex> guard(StateMapMutex);
 
-  uint64_t elem_count = StateMap.size();
+  uint64_t elem_count = StateMap.Size();
   uint64_t elem_size = (sizeof(uint64_t) + sizeof(InstructionState));
 
   if (size < elem_count * elem_size) {
@@ -255,12 +313,12 @@ size_t Instruction::SerializeStateMap(uint8_t* buf, size_t size) {
   }
 
   uint8_t* head = buf;
-  for (auto elem : StateMap) {
-    std::memcpy(head, &elem.first, sizeof(elem.first));
-    head += sizeof(elem.first);
-    std::memcpy(head, &elem.second, sizeof(elem.second));
-    head += sizeof(elem.second);
-  }
+  StateMap.ForEach([&head](uint64_t addr, const InstructionState& state) {
+    std::memcpy(head, &addr, sizeof(addr));
+    head += sizeof(addr);
+    std::memcpy(head, &state, sizeof(state));
+    head += sizeof(state);
+  });
 
   return head - buf;
 }
@@ -272,7 +330,8 @@ bool Instruction::DeserializeStateMap(const uint8_t* buf, size_t size) {
     return false;
   }
 
-  StateMap.clear();
+  StateMap.Clear();
+  DerivedStateMap.Clear();
 
   for (const uint8_t* head = buf; head < buf + size;
        head += sizeof(uint64_t) + sizeof(InstructionState)) {
@@ -282,14 +341,87 @@ bool Instruction::DeserializeStateMap(const uint8_t* buf, size_t size) {
     InstructionState state;
     memcpy(&state, head + sizeof(addr), sizeof(state));
 
-    StateMap[addr] = state;
+    StateMap.Set(addr, state);
   }
 
   return true;
 }
 
+// Writes the shared and user tiers as a sidecar file that can be mapped by
+// loadStateMapFromFile, e.g. to reuse a configuration across a firmware family.
+void Instruction::writeStateMapToFile(std::string filename) {
+  std::lock_guard<std::mutex> guard(StateMapMutex);
+
+  auto merged = std::make_unique<StateTable>();
+  const auto copy = [&merged](uint64_t addr, const InstructionState& state) {
+    merged->Set(addr, state);
+  };
+  SharedStateMap.ForEach(copy);
+  StateMap.ForEach(copy);
+
+  // Write next to the target and rename it into place, so that a failed write
+  // leaves both the target and the current mapping intact
+  const std::string temp = filename + ".tmp";
+  std::error_code error;
+  if (!StateFile::Write(temp, *merged)) {
+    BN::LogError("%s: Unable to write %s", __func__, temp.c_str());
+    std::filesystem::remove(temp, error);
+    return;
+  }
+
+  // The target may be the file currently mapped. POSIX renames over it and
+  // keeps the old mapping valid; Win32 refuses while it is mapped, so retry
+  // with the mapping released.
+  std::filesystem::rename(temp, filename, error);
+  if (error && SharedStateMap.IsOpen()) {
+    SharedStateMap.Close();
+    std::filesystem::rename(temp, filename, error);
+  }
+
+  if (error) {
+    BN::LogError("%s: Unable to replace %s: %s", __func__, filename.c_str(),
+                 error.message().c_str());
+    std::filesystem::remove(temp, error);
+    if (!SharedStateMap.IsOpen() && !SharedStateMapFile.empty() &&
+        !SharedStateMap.Open(SharedStateMapFile)) {
+      BN::LogError("%s: Unable to map %s", __func__,
+                   SharedStateMapFile.c_str());
+      SharedStateMapFile.clear();
+    }
+    return;
+  }
+
+  // Map the result, which holds the same state as the previous mapping plus
+  // the user tier
+  if (SharedStateMap.Open(filename)) {
+    SharedStateMapFile = filename;
+  } else {
+    BN::LogError("%s: Unable to map %s", __func__, filename.c_str());
+    SharedStateMapFile.clear();
+  }
+}
+
+// Maps a sidecar file as the shared tier in place of any previous one. The
+// file is searched directly, so loading does no per-entry work.
+void Instruction::loadStateMapFromFile(std::string filename) {
+  std::lock_guard<std::mutex> guard(StateMapMutex);
+
+  if (!SharedStateMap.Open(filename)) {
+    BN::LogError("%s: %s is not a valid C166 state file", __func__,
+                 filename.c_str());
+    SharedStateMapFile.clear();
+    return;
+  }
+  SharedStateMapFile = filename;
+
+  BN::LogInfo("Mapped %zu instruction state(s) from %s", SharedStateMap.Size(),
+              filename.c_str());
+}
+
 size_t Instruction::SizeOfStateMap() {
-  uint64_t elem_count = StateMap.size();
+  std::lock_guard<std::mutex> guard(StateMapMutex);
+
+  uint64_t elem_count = StateMap.Size();
   uint64_t elem_size = (sizeof(uint64_t) + sizeof(InstructionState));
   return elem_count * elem_size;
 }
@@ -348,35 +480,58 @@ BN::ExprId Instruction::GetIndAddrExpr_Extp_Rw_data16(
  * Indirect Addressing (DPP) Expressions
  */
 
+// Physical address of a 16-bit data address under DPP translation. When the
+// DPPs in effect at `addr` are known the lookup is folded into constants;
+// otherwise the page is selected from the DPP register file.
+static BN::ExprId GetDppAddrExpr(BN::LowLevelILFunction& il,
+                                 const uint64_t addr, const BN::ExprId Ind) {
+  uint32_t dpp[4];
+  BN::ExprId Table;
+  if (Instruction::GetEffectiveDpps(addr, dpp)) {
+    // DPPn = DPP0 + n (including the 0/1/2/3 reset layout): a linear mapping
+    if (dpp[1] == dpp[0] + 1 && dpp[2] == dpp[0] + 2 &&
+        dpp[3] == dpp[0] + 3) {
+      if (dpp[0] == 0) return il.ZeroExtend(3, Ind);
+      return il.Add(3, il.ConstPointer(3, dpp[0] << 14),
+                    il.ZeroExtend(3, Ind));
+    }
+
+    // All four DPPs select the same page
+    if (dpp[1] == dpp[0] && dpp[2] == dpp[0] && dpp[3] == dpp[0])
+      return il.Or(3, il.ConstPointer(3, dpp[0] << 14),
+                   il.And(2, Ind, il.Const(2, 0x3FFF)));
+
+    // Otherwise index a constant copy of the DPP register file
+    uint64_t packed = 0;
+    for (int i = 3; i >= 0; i--) packed = (packed << 16) | (dpp[i] & 0x3FF);
+    Table = il.Const(8, packed);
+  } else {
+    Table = il.Register(8, Registers::DPP);
+  }
+
+  // DPPn occupies bits [16n, 16n + 16) of the table
+  const BN::ExprId Shift =
+      il.ShiftLeft(1, il.LogicalShiftRight(2, Ind, il.Const(2, 14)),
+                   il.Const(1, 4));
+  const BN::ExprId Page =
+      il.And(2, il.LowPart(2, il.LogicalShiftRight(8, Table, Shift)),
+             il.Const(2, 0x3FF));
+  return il.Or(3, il.ShiftLeft(3, Page, il.Const(2, 14)),
+               il.And(2, Ind, il.Const(2, 0x3FFF)));
+}
+
 // [Rw]
 BN::ExprId Instruction::GetIndAddrExpr_Rw(BN::LowLevelILFunction& il,
-                                          uint32_t Rw) {
-  const BN::ExprId Ind = il.Register(2, Rw);
-  const BN::ExprId DppIndex = il.LogicalShiftRight(
-      2, il.And(2, il.Const(2, 0xC000), Ind), il.Const(2, 14));
-  const BN::ExprId DppAddr = il.Add(3, il.ConstPointer(2, Sfr::DPP0),
-                                    il.ShiftLeft(2, DppIndex, il.Const(2, 1)));
-  const BN::ExprId IndAddrUpper =
-      il.ShiftLeft(3, il.Load(2, DppAddr), il.Const(2, 14));
-  const BN::ExprId IndAddrLower = il.And(2, Ind, il.Const(2, 0x3FFF));
-  const BN::ExprId IndAddr = il.Or(3, IndAddrUpper, IndAddrLower);
-  return IndAddr;
+                                          const uint64_t addr, uint32_t Rw) {
+  return GetDppAddrExpr(il, addr, il.Register(2, Rw));
 }
 
+// [Rw + #data16]
 BN::ExprId Instruction::GetIndAddrExpr_Rw_data16(BN::LowLevelILFunction& il,
+                                                 const uint64_t addr,
                                                  uint32_t Rw, uint16_t data16) {
-  const BN::ExprId Ind =
-      il.And(2, il.Add(2, il.Const(2, data16), il.Register(2, Rw)),
-             il.Const(2, 0xFFFF));
-  const BN::ExprId DppIndex = il.LogicalShiftRight(
-      2, il.And(2, il.Const(2, 0xC000), Ind), il.Const(2, 14));
-  const BN::ExprId DppAddr = il.Add(3, il.ConstPointer(2, 0xFE00),
-                                    il.ShiftLeft(2, DppIndex, il.Const(2, 1)));
-  const BN::ExprId IndAddrUpper =
-      il.ShiftLeft(3, il.Load(2, DppAddr), il.Const(2, 14));
-  const BN::ExprId IndAddrLower = il.And(2, Ind, il.Const(2, 0x3FFF));
-  const BN::ExprId IndAddr = il.Or(3, IndAddrUpper, IndAddrLower);
-  return IndAddr;
+  return GetDppAddrExpr(
+      il, addr, il.Add(2, il.Register(2, Rw), il.Const(2, data16)));
 }
 
 const char* Instruction::ConditionCodeToString(const uint8_t code) {
@@ -419,8 +574,8 @@ const char* Instruction::ConditionCodeToString(const uint8_t code) {
   }
 }
 
-uint8_t Instruction::GetBitPosition(const uint8_t* data, size_t len) {
-  return (*data & (0xFu << 4u)) >> 4u;
+uint8_t Instruction::GetBitPosition(const uint8_t* data) {
+  return Formats::Get<Formats::BitShort::bitpos>(data);
 }
 
 uint32_t Instruction::GetBitoffRamAddress(const uint8_t value) {
@@ -432,49 +587,30 @@ uint32_t Instruction::GetBitoffSfrAddress(const uint8_t value, bool extr) {
   return base + 2 * (value & 0x7Fu);
 }
 
-uint16_t Instruction::GetData16(const uint8_t* data, const size_t len) {
-  const auto wdata = (const uint16_t*)data;
-  return *(wdata + 1);
+uint16_t Instruction::GetData16(const uint8_t* data) {
+  return Formats::Get<Formats::RegData::data16>(data);
 }
 
-uint8_t Instruction::GetData3(const uint8_t* data, const size_t len) {
-  return *(data + 1) & 0b111u;
+uint8_t Instruction::GetData3(const uint8_t* data) {
+  return Formats::Get<Formats::Rr::data3>(data);
 }
 
-uint8_t Instruction::GetData4High(const uint8_t* data, const size_t len) {
-  const auto wdata = (const uint16_t*)data;
-  switch (len) {
-    case 2:
-      return (*wdata & (0b1111u << ((4 * len) + 4))) >> ((4 * len) + 4);
-    case 4:
-      return (*(wdata + 1) & (0b1111u << ((4 * len) + 4))) >> ((4 * len) + 4);
-    default:
-      BN::LogError("GetData4High -- Invalid len parameter: %zu", len);
-      return 0;
-  }
+// The nibble operands (n/m, #data4) always live in the second byte, whatever
+// the instruction length.
+uint8_t Instruction::GetData4High(const uint8_t* data) {
+  return Formats::Get<Formats::Rr::n>(data);
 }
 
-uint8_t Instruction::GetData4Low(const uint8_t* data, const size_t len) {
-  const auto wdata = (const uint16_t*)data;
-  switch (len) {
-    case 2:
-      return (*wdata & (0b1111u << (4 * len))) >> (4 * len);
-    case 4:
-      return (*(wdata + 1) & (0b1111u << (4 * len))) >> (4 * len);
-    default:
-      BN::LogError("GetData4Low -- Invalid len parameter: %zu", len);
-      return 0;
-  }
+uint8_t Instruction::GetData4Low(const uint8_t* data) {
+  return Formats::Get<Formats::Rr::m>(data);
 }
 
-uint8_t Instruction::GetData8High(const uint8_t* data, const size_t len) {
-  const auto wdata = (const uint16_t*)data;
-  return (*(wdata + 1) & (0xFFu << 8u)) >> 8u;
+uint8_t Instruction::GetData8High(const uint8_t* data) {
+  return Formats::Get<Formats::RegData::data8_high>(data);
 }
 
-uint8_t Instruction::GetData8Low(const uint8_t* data, const size_t len) {
-  const auto wdata = (const uint16_t*)data;
-  return *(wdata + 1) & 0xFFu;
+uint8_t Instruction::GetData8Low(const uint8_t* data) {
+  return Formats::Get<Formats::RegData::data8>(data);
 }
 
 BNLowLevelILFlagCondition Instruction::GetFlagCondition(const uint8_t code) {
@@ -507,7 +643,7 @@ BNLowLevelILFlagCondition Instruction::GetFlagCondition(const uint8_t code) {
       return LLFC_SGE;
     case Conditions::CC_SGT:
       return LLFC_SGT;
-    case Conditions::CC_NET:  // TODO: Special flag? Not end of table?!?
+    case Conditions::CC_NET:  // Semantic flag group only, see GetCondition
     case Conditions::CC_UC:
     default:
       BN::LogDebug("Invalid flag condition code");
@@ -515,31 +651,36 @@ BNLowLevelILFlagCondition Instruction::GetFlagCondition(const uint8_t code) {
   }
 }
 
-uint8_t Instruction::GetIndirectIndex(const uint8_t* data, size_t len) {
-  return *(data + 1) & 0b11u;
+// Conditions are lifted as semantic flag groups so the core can evaluate them
+// according to the semantic class of the instruction that wrote the flags
+BN::ExprId Instruction::GetCondition(BN::LowLevelILFunction& il,
+                                     const uint8_t code) {
+  return il.FlagGroup(code);
+}
+
+uint8_t Instruction::GetIndirectIndex(const uint8_t* data) {
+  return Formats::Get<Formats::Rr::rwi>(data);
 }
 
-uint32_t Instruction::GetMem(const uint64_t addr, const uint8_t* data,
-                             const size_t len) {
+uint32_t Instruction::GetMem(const uint64_t addr, const uint8_t* data) {
   std::lock_guard<std::mutex> guard(StateMapMutex);
 
-  const auto wdata = (const uint16_t*)data;
-  uint32_t mem = (*(wdata + 1) & (0xFFFFu));
+  uint32_t mem = Formats::Get<Formats::RegMem::mem>(data);
   uint32_t dpp_index = (mem & 0xC000) >> 14;
   uint32_t offset;
 
   // If there's an entry containing extra state information for this address,
   // use it.
-  auto it = StateMap.find(addr);
-  if (it != StateMap.end()) {
-    if (StateMap[addr].ext_state & ExtPage) {  // EXTP Overrides DPP
+  InstructionState state;
+  if (FindState(addr, state)) {
+    if (state.ext_state & ExtPage) {  // EXTP Overrides DPP
       offset = mem & 0x3FFF;
-      return (StateMap[addr].pag10 << 14) | offset;
-    } else if (StateMap[addr].ext_state & ExtSegment) {  // EXTS Overrides DPP
-      return (StateMap[addr].seg8 << 16) | mem;
-    } else if (StateMap[addr].ext_state & ExtNoneCustomDpps) {  // Use DPP
+      return (state.pag10 << 14) | offset;
+    } else if (state.ext_state & ExtSegment) {  // EXTS Overrides DPP
+      return (state.seg8 << 16) | mem;
+    } else if (state.ext_state & ExtNoneCustomDpps) {  // Use DPP
       offset = mem & 0x3FFF;
-      return (StateMap[addr].dpp[dpp_index] << 14) | offset;
+      return (state.dpp[dpp_index] << 14) | offset;
     }
   }
 
@@ -547,14 +688,12 @@ uint32_t Instruction::GetMem(const uint64_t addr, const uint8_t* data,
   return (default_dpp[dpp_index] << 14) | offset;
 }
 
-uint16_t Instruction::GetOpCaddr(const uint8_t* data, const size_t len) {
-  const auto wdata = (const uint16_t*)data;
-  return *(wdata + 1);
+uint16_t Instruction::GetOpCaddr(const uint8_t* data) {
+  return Formats::Get<Formats::CondCaddr::caddr>(data);
 }
 
-uint8_t Instruction::GetOpSeg(const uint8_t* data, const size_t len) {
-  const auto wdata = (const uint16_t*)data;
-  return (*wdata & (0xFFu << 8u)) >> 8u;
+uint8_t Instruction::GetOpSeg(const uint8_t* data) {
+  return Formats::Get<Formats::SegCaddr::seg>(data);
 }
 
 uint32_t Instruction::GetRegSfrAddress(const uint8_t value, bool extr) {
@@ -562,8 +701,8 @@ uint32_t Instruction::GetRegSfrAddress(const uint8_t value, bool extr) {
   return base + 2 * value;
 }
 
-uint8_t Instruction::GetRegShortAddr(const uint8_t* data, const size_t len) {
-  return *(data + 1);
+uint8_t Instruction::GetRegShortAddr(const uint8_t* data) {
+  return Formats::Get<Formats::RegMem::reg>(data);
 }
 
 bool Instruction::JumpDirect(BN::Architecture* arch, BN::LowLevelILFunction& il,
@@ -588,14 +727,14 @@ bool Instruction::JumpIndirect(BN::Architecture* arch,
 }
 
 bool Instruction::LiftOpMemReg(
-    const uint64_t addr, const uint8_t* data, size_t len, size_t width,
-    uint32_t flags, bool store, BN::LowLevelILFunction& il,
+    const uint64_t addr, const uint8_t* data, size_t width, uint32_t flags,
+    bool store, BN::LowLevelILFunction& il,
     const std::function<
         BN::ExprId(size_t size, BN::ExprId a, BN::ExprId b, uint32_t flags,
                    const BN::ILSourceLocation& loc)>& operation) {
-  uint32_t mem = Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+  uint32_t mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
   uint32_t reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, 4));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
 
   BN::ExprId op2;
   if (reg <= 0xF) {
@@ -606,33 +745,33 @@ bool Instruction::LiftOpMemReg(
   }
 
   if (store)
-    il.AddInstruction(
-        il.Store(width, il.ConstPointer(3, mem),
-                 operation(width, il.Load(width, il.ConstPointer(3, mem)), op2,
-                           flags, BN::ILSourceLocation())));
+    il.AddInstruction(Instruction::StoreDirect(
+        il, width, mem,
+        operation(width, Instruction::LoadDirect(il, width, mem), op2, flags,
+                  BN::ILSourceLocation())));
   else
-    operation(width, il.Load(width, il.ConstPointer(3, mem)), op2, flags,
+    operation(width, Instruction::LoadDirect(il, width, mem), op2, flags,
               BN::ILSourceLocation());
 
   return true;
 }
 
 bool Instruction::LiftOpRegData(
-    const uint64_t addr, const uint8_t* data, size_t len, size_t width,
-    uint32_t flags, bool store, BN::LowLevelILFunction& il,
+    const uint64_t addr, const uint8_t* data, size_t width, uint32_t flags,
+    bool store, BN::LowLevelILFunction& il,
     const std::function<
         BN::ExprId(size_t size, BN::ExprId a, BN::ExprId b, uint32_t flags,
                    const BN::ILSourceLocation& loc)>& operation) {
   uint32_t reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, len));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
 
   unsigned int ndata;
   switch (width) {
     case 1:
-      ndata = Instruction::GetData8Low(data, len);  // TODO: Verify
+      ndata = Instruction::GetData8Low(data);  // TODO: Verify
       break;
     case 2:
-      ndata = Instruction::GetData16(data, len);
+      ndata = Instruction::GetData16(data);
       break;
     default:
       BN::LogError("Instruction::%s received invalid width: %zu", __func__,
@@ -653,13 +792,13 @@ bool Instruction::LiftOpRegData(
                                   BN::ILSourceLocation()));
   } else {
     if (store)
-      il.AddInstruction(il.Store(
-          width, il.ConstPointer(3, reg),
-          operation(width, il.Load(width, il.ConstPointer(3, reg)),
+      il.AddInstruction(Instruction::StoreDirect(
+          il, width, reg,
+          operation(width, Instruction::LoadDirect(il, width, reg),
                     il.Const(width, ndata), flags, BN::ILSourceLocation())));
     else
       il.AddInstruction(
-          operation(width, il.Load(width, il.ConstPointer(3, reg)),
+          operation(width, Instruction::LoadDirect(il, width, reg),
                     il.Const(width, ndata), flags, BN::ILSourceLocation()));
   }
 
@@ -667,14 +806,14 @@ bool Instruction::LiftOpRegData(
 }
 
 bool Instruction::LiftOpRegMem(
-    const uint64_t addr, const uint8_t* data, size_t len, size_t width,
-    uint32_t flags, bool store, BN::LowLevelILFunction& il,
+    const uint64_t addr, const uint8_t* data, size_t width, uint32_t flags,
+    bool store, BN::LowLevelILFunction& il,
     const std::function<
         BN::ExprId(size_t size, BN::ExprId a, BN::ExprId b, uint32_t flags,
                    const BN::ILSourceLocation& loc)>& operation) {
   uint32_t reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, 4));
-  uint32_t mem = Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
+  uint32_t mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
 
   if (reg <= 0xF) {
     if (width == 1) reg += 16;
@@ -682,23 +821,23 @@ bool Instruction::LiftOpRegMem(
       il.AddInstruction(
           il.SetRegister(width, reg,
                          operation(width, il.Register(width, reg),
-                                   il.Load(width, il.ConstPointer(3, mem)),
+                                   Instruction::LoadDirect(il, width, mem),
                                    flags, BN::ILSourceLocation())));
     else
       il.AddInstruction(operation(width, il.Register(width, reg),
-                                  il.Load(width, il.ConstPointer(3, mem)),
+                                  Instruction::LoadDirect(il, width, mem),
                                   flags, BN::ILSourceLocation()));
   } else {
     if (store)
-      il.AddInstruction(
-          il.Store(width, il.ConstPointer(3, reg),
-                   operation(width, il.Load(width, il.ConstPointer(3, reg)),
-                             il.Load(width, il.ConstPointer(3, mem)), flags,
-                             BN::ILSourceLocation())));
+      il.AddInstruction(Instruction::StoreDirect(
+          il, width, reg,
+          operation(width, Instruction::LoadDirect(il, width, reg),
+                    Instruction::LoadDirect(il, width, mem), flags,
+                    BN::ILSourceLocation())));
     else
       il.AddInstruction(operation(width,
-                                  il.Load(width, il.ConstPointer(3, reg)),
-                                  il.Load(width, il.ConstPointer(3, mem)),
+                                  Instruction::LoadDirect(il, width, reg),
+                                  Instruction::LoadDirect(il, width, mem),
                                   flags, BN::ILSourceLocation()));
   }
 
@@ -706,13 +845,13 @@ bool Instruction::LiftOpRegMem(
 }
 
 bool Instruction::LiftOpRnRm(
-    const uint8_t* data, const size_t len, const size_t width,
-    const uint32_t flags, bool store, BN::LowLevelILFunction& il,
+    const uint8_t* data, const size_t width, const uint32_t flags, bool store,
+    BN::LowLevelILFunction& il,
     const std::function<
         BN::ExprId(size_t size, BN::ExprId a, BN::ExprId b, uint32_t flags,
                    const BN::ILSourceLocation& loc)>& operation) {
-  uint32_t rn = Instruction::GetData4High(data, 2);
-  uint32_t rm = Instruction::GetData4Low(data, 2);
+  uint32_t rn = Instruction::GetData4High(data);
+  uint32_t rm = Instruction::GetData4Low(data);
 
   if (width == 1) {
     rn += 16;
@@ -733,16 +872,15 @@ bool Instruction::LiftOpRnRm(
 }
 
 bool Instruction::LiftOpRnRwiData3(
-    const uint64_t addr, const uint8_t* data, const size_t len,
-    const size_t width, const uint32_t flags, bool store,
-    BN::LowLevelILFunction& il,
+    const uint64_t addr, const uint8_t* data, const size_t width,
+    const uint32_t flags, bool store, BN::LowLevelILFunction& il,
     const std::function<
         BN::ExprId(size_t size, BN::ExprId a, BN::ExprId b, uint32_t flags,
                    const BN::ILSourceLocation& loc)>& operation) {
-  uint32_t rn = Instruction::GetData4High(data, 2);
-  uint8_t scode = ((*(data + 1) & 0xCu) >> 2u);
-  uint32_t rwi = Instruction::GetIndirectIndex(data, 2);
-  uint8_t data3 = Instruction::GetData3(data, 2);
+  uint32_t rn = Instruction::GetData4High(data);
+  uint8_t scode = Formats::Get<Formats::Rr::mode>(data);
+  uint32_t rwi = Instruction::GetIndirectIndex(data);
+  uint8_t data3 = Instruction::GetData3(data);
 
   if (width == 1) rn += 16;
 
@@ -750,7 +888,7 @@ bool Instruction::LiftOpRnRwiData3(
   switch (scode) {
     case 0b11:  // Rw_n, [Rw_i+]
       post = il.SetRegister(2, rwi,
-                            il.Add(2, il.Register(2, rwi), il.Const(2, 2)));
+                            il.Add(2, il.Register(2, rwi), il.Const(2, width)));
     case 0b10:  // Rw_n, [Rw_i]
     {
       BN::ExprId SrcIndAddr;
@@ -760,7 +898,7 @@ bool Instruction::LiftOpRnRwiData3(
       } else if (Instruction::ShouldUseExtp(addr, &pag10)) {
         SrcIndAddr = Instruction::GetIndAddrExpr_Extp_Rw(il, pag10, rwi);
       } else {
-        SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, rwi);
+        SrcIndAddr = Instruction::GetIndAddrExpr_Rw(il, addr, rwi);
       }
       src = il.Load(width, SrcIndAddr);
     } break;
@@ -793,13 +931,13 @@ int8_t Instruction::SignExtend(uint8_t data) {
 }
 
 bool Instruction::TextOpMemReg(const uint64_t addr, const uint8_t* data,
-                               size_t len, size_t width,
+                               size_t width,
                                std::vector<BN::InstructionTextToken>& result,
                                const std::string& instr) {
   char buf[32];
-  uint32_t mem = Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+  uint32_t mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
   uint32_t reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, 4));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
 
   ITEXT(instr)
 
@@ -821,20 +959,20 @@ bool Instruction::TextOpMemReg(const uint64_t addr, const uint8_t* data,
 }
 
 bool Instruction::TextOpRegData(const uint64_t addr, const uint8_t* data,
-                                size_t len, size_t width,
+                                size_t width,
                                 std::vector<BN::InstructionTextToken>& result,
                                 const std::string& instr) {
   char buf[32];
   uint32_t reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, 4));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
 
   unsigned int ndata;
   switch (width) {
     case 1:
-      ndata = Instruction::GetData8Low(data, len);  // TODO: Verify
+      ndata = Instruction::GetData8Low(data);  // TODO: Verify
       break;
     case 2:
-      ndata = Instruction::GetData16(data, len);
+      ndata = Instruction::GetData16(data);
       break;
     default:
       BN::LogError("Instruction::%s received invalid width: %zu", __func__,
@@ -861,13 +999,13 @@ bool Instruction::TextOpRegData(const uint64_t addr, const uint8_t* data,
 }
 
 bool Instruction::TextOpRegMem(const uint64_t addr, const uint8_t* data,
-                               size_t len, size_t width,
+                               size_t width,
                                std::vector<BN::InstructionTextToken>& result,
                                const std::string& instr) {
   char buf[32];
   uint32_t reg =
-      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data, 4));
-  uint32_t mem = Instruction::TranslateMem(Instruction::GetMem(addr, data, 4));
+      Instruction::TranslateReg(addr, Instruction::GetRegShortAddr(data));
+  uint32_t mem = Instruction::TranslateMem(Instruction::GetMem(addr, data));
 
   ITEXT(instr)
 
@@ -887,13 +1025,12 @@ bool Instruction::TextOpRegMem(const uint64_t addr, const uint8_t* data,
   return true;
 }
 
-bool Instruction::TextOpRnRm(const uint8_t* data, const size_t len,
-                             const size_t width,
+bool Instruction::TextOpRnRm(const uint8_t* data, const size_t width,
                              std::vector<BN::InstructionTextToken>& result,
                              const std::string& instr) {
   char buf[32];
-  uint32_t rn = Instruction::GetData4High(data, 2);
-  uint32_t rm = Instruction::GetData4Low(data, 2);
+  uint32_t rn = Instruction::GetData4High(data);
+  uint32_t rm = Instruction::GetData4Low(data);
 
   if (width == 1) {
     rn += 16;
@@ -912,13 +1049,13 @@ bool Instruction::TextOpRnRm(const uint8_t* data, const size_t len,
 }
 
 bool Instruction::TextOpRnRwiData3(
-    const uint8_t* data, size_t len, size_t width,
+    const uint8_t* data, size_t width,
     std::vector<BN::InstructionTextToken>& result, const std::string& instr) {
   char buf[32];
-  uint32_t rn = Instruction::GetData4High(data, 2);
-  uint8_t scode = ((*(data + 1) & 0xCu) >> 2u);
-  uint32_t rwi = Instruction::GetIndirectIndex(data, 2);
-  uint8_t data3 = Instruction::GetData3(data, 2);
+  uint32_t rn = Instruction::GetData4High(data);
+  uint8_t scode = Formats::Get<Formats::Rr::mode>(data);
+  uint32_t rwi = Instruction::GetIndirectIndex(data);
+  uint8_t data3 = Instruction::GetData3(data);
 
   ITEXT(instr)
 
@@ -964,6 +1101,42 @@ uint32_t Instruction::TranslateBitOff(const uint64_t addr,
   }
 }
 
+// Word containing a bit operand: a GPR, a system register that is modeled as
+// an architectural register (so per-bit updates stay visible to dataflow), or
+// a word in the bit-addressable RAM/SFR area.
+BN::ExprId Instruction::GetBitWord(BN::LowLevelILFunction& il,
+                                   const uint32_t bitaddr) {
+  if (bitaddr <= 0xF) return il.Register(2, bitaddr);
+  return LoadDirect(il, 2, bitaddr);
+}
+
+BN::ExprId Instruction::SetBitWord(BN::LowLevelILFunction& il,
+                                   const uint32_t bitaddr,
+                                   const BN::ExprId value,
+                                   const uint32_t flags) {
+  if (bitaddr <= 0xF) return il.SetRegister(2, bitaddr, value, flags);
+  return StoreDirect(il, 2, bitaddr, value, flags);
+}
+
+// Value (0/1) of a single bit operand
+BN::ExprId Instruction::GetBit(BN::LowLevelILFunction& il,
+                               const uint32_t bitaddr, const uint8_t bitpos) {
+  return il.And(2,
+                il.LogicalShiftRight(2, GetBitWord(il, bitaddr),
+                                     il.Const(1, bitpos)),
+                il.Const(2, 1));
+}
+
+// Condition that is true when a single bit operand is set (or clear)
+BN::ExprId Instruction::TestBit(BN::LowLevelILFunction& il,
+                                const uint32_t bitaddr, const uint8_t bitpos,
+                                const bool set) {
+  const BN::ExprId bit =
+      il.And(2, GetBitWord(il, bitaddr), il.Const(2, 0b1u << bitpos));
+  if (set) return il.CompareNotEqual(2, bit, il.Const(2, 0));
+  return il.CompareEqual(2, bit, il.Const(2, 0));
+}
+
 uint32_t Instruction::TranslateMem(const uint32_t mem) { return mem; }
 
 uint32_t Instruction::TranslateReg(const uint64_t addr, const uint32_t reg) {
@@ -1051,6 +1224,24 @@ const char* Instruction::RegToStr(const uint32_t rid) {
       return "psw";
     case Registers::CP:
       return "cp";
+    case Registers::MD:
+      return "md";
+    case Registers::MDH:
+      return "mdh";
+    case Registers::MDL:
+      return "mdl";
+    case Registers::DPP:
+      return "dpp";
+    case Registers::DPP0:
+      return "dpp0";
+    case Registers::DPP1:
+      return "dpp1";
+    case Registers::DPP2:
+      return "dpp2";
+    case Registers::DPP3:
+      return "dpp3";
+    case Registers::SP:
+      return "sp";
     default:
       return nullptr;
   }
@@ -1074,45 +1265,118 @@ BN::ExprId Instruction::ElideReg(BN::LowLevelILFunction& il, const uint32_t reg,
   if (uint16_t constant = 0; GetConstantRegister(reg, constant)) {
     return il.Const(width, constant);
   } else {
-    return il.Load(width, il.ConstPointer(3, reg));
+    return LoadDirect(il, width, reg);
+  }
+}
+
+// SFRs that are modeled as architectural registers rather than memory
+bool Instruction::GetSfrRegister(const uint32_t addr, uint32_t& reg) {
+  switch (addr) {
+    case Sfr::DPP0:
+      reg = Registers::DPP0;
+      return true;
+    case Sfr::DPP1:
+      reg = Registers::DPP1;
+      return true;
+    case Sfr::DPP2:
+      reg = Registers::DPP2;
+      return true;
+    case Sfr::DPP3:
+      reg = Registers::DPP3;
+      return true;
+    case Sfr::CSP:
+      reg = Registers::CSP;
+      return true;
+    case Sfr::CP:
+      reg = Registers::CP;
+      return true;
+    case Sfr::SP:
+      reg = Registers::SP;
+      return true;
+    case Sfr::PSW:
+      reg = Registers::PSW;
+      return true;
+    case Sfr::MDH:
+      reg = Registers::MDH;
+      return true;
+    case Sfr::MDL:
+      reg = Registers::MDL;
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Word/byte access to a direct (already translated) address, routed to the
+// backing register when the address is a register-modeled SFR. A byte access
+// reads or merges the low (even address) or high (odd address) half.
+BN::ExprId Instruction::LoadDirect(BN::LowLevelILFunction& il,
+                                   const size_t width, const uint32_t addr) {
+  if (uint32_t reg = 0; width == 2 && GetSfrRegister(addr, reg))
+    return il.Register(2, reg);
+  if (uint32_t reg = 0; width == 1 && GetSfrRegister(addr & ~1u, reg)) {
+    if (addr & 1u)
+      return il.LowPart(
+          1, il.LogicalShiftRight(2, il.Register(2, reg), il.Const(1, 8)));
+    return il.LowPart(1, il.Register(2, reg));
   }
+  return il.Load(width, il.ConstPointer(3, addr));
+}
+
+BN::ExprId Instruction::StoreDirect(BN::LowLevelILFunction& il,
+                                    const size_t width, const uint32_t addr,
+                                    const BN::ExprId value,
+                                    const uint32_t flags) {
+  if (uint32_t reg = 0; width == 2 && GetSfrRegister(addr, reg))
+    return il.SetRegister(2, reg, value, flags);
+  if (uint32_t reg = 0; width == 1 && GetSfrRegister(addr & ~1u, reg)) {
+    // Flags are those of the byte, so it goes through a temp first
+    BN::ExprId byte = value;
+    if (flags != Flags::WRITE_NONE) {
+      il.AddInstruction(il.SetRegister(1, LLIL_TEMP(0), value, flags));
+      byte = il.Register(1, LLIL_TEMP(0));
+    }
+
+    const uint32_t shift = (addr & 1u) * 8;
+    return il.SetRegister(
+        2, reg,
+        il.Or(2,
+              il.And(2, il.Register(2, reg), il.Const(2, 0xFF00u >> shift)),
+              il.ShiftLeft(2, il.ZeroExtend(2, byte), il.Const(1, shift))));
+  }
+  return il.Store(width, il.ConstPointer(3, addr), value, flags);
 }
 
-uint32_t Calla::GetConditionCode(const uint8_t* data, const size_t len) {
-  return (*(data + 1) & 0xF0u) >> 4u;
+uint32_t Calla::GetConditionCode(const uint8_t* data) {
+  return Formats::Get<Formats::CondCaddr::cc>(data);
 }
 
-uint32_t Calli::GetConditionCode(const uint8_t* data, const size_t len) {
-  return (*(data + 1) & 0xF0u) >> 4u;
+uint32_t Calli::GetConditionCode(const uint8_t* data) {
+  return Formats::Get<Formats::CondReg::cc>(data);
 }
 
-uint8_t Callr::GetRelativeOffset(const uint8_t* data, const size_t len) {
-  return *(data + 1) & 0xFFu;
+uint8_t Callr::GetRelativeOffset(const uint8_t* data) {
+  return Formats::Get<Formats::CondRel::rel>(data);
 }
 
-uint32_t Callr::GetTarget(const uint8_t* data, const uint64_t addr,
-                          const size_t len) {
-  return addr +
-         Instruction::SignExtend(Callr::GetRelativeOffset(data, len)) * 2 + 2;
+uint32_t Callr::GetTarget(const uint8_t* data, const uint64_t addr) {
+  return addr + Instruction::SignExtend(Callr::GetRelativeOffset(data)) * 2 +
+         length;
 }
 
-uint32_t Calla::GetTarget(const uint8_t* data, const uint64_t addr,
-                          const size_t len) {
-  const auto wdata = (const uint16_t*)data;
-  return (addr & (0xFFu << 16u)) + *(wdata + 1);
+uint32_t Calla::GetTarget(const uint8_t* data, const uint64_t addr) {
+  return (addr & (0xFFu << 16u)) +
+         Formats::Get<Formats::CondCaddr::caddr>(data);
 }
 
-uint32_t Calls::GetTarget(const uint8_t* data, const size_t len) {
-  const uint8_t seg = Instruction::GetOpSeg(data, len);
-  const uint16_t caddr = Instruction::GetOpCaddr(data, len);
+uint32_t Calls::GetTarget(const uint8_t* data) {
+  const uint8_t seg = Instruction::GetOpSeg(data);
+  const uint16_t caddr = Instruction::GetOpCaddr(data);
   return (static_cast<uint32_t>(seg) << 16u) | caddr;
 }
 
-const char* Extprs::GetInstruction(const uint8_t* data, uint64_t addr,
-                                   const size_t len) {
-  const uint16_t instr = *(const uint16_t*)data;
-  const auto scode = (instr & (0b11u << 14u)) >> 14u;
-  switch (scode) {
+const char* Extprs::GetInstruction(const uint8_t* data, uint64_t addr) {
+  switch (Formats::Get<Formats::Ext::subop>(data)) {
     case 0b00:
       return "exts";
     case 0b01:
@@ -1124,84 +1388,79 @@ const char* Extprs::GetInstruction(const uint8_t* data, uint64_t addr,
   }
 }
 
-uint8_t Jb::GetRelativeOffset(const uint8_t* data, const size_t len) {
-  const auto wdata = (const uint16_t*)data;
-  return *(wdata + 1) & 0xFFu;
+uint8_t Jb::GetRelativeOffset(const uint8_t* data) {
+  return Formats::Get<Formats::BitRel::rel>(data);
 }
 
-uint32_t Jb::GetTarget(const uint8_t* data, const uint64_t addr,
-                       const size_t len) {
-  return addr + Instruction::SignExtend(Jb::GetRelativeOffset(data, len)) * 2 +
+uint32_t Jb::GetTarget(const uint8_t* data, const uint64_t addr) {
+  return addr + Instruction::SignExtend(Jb::GetRelativeOffset(data)) * 2 +
          length;
 }
 
-uint8_t Jbc::GetRelativeOffset(const uint8_t* data, const size_t len) {
-  const auto wdata = (const uint16_t*)data;
-  return *(wdata + 1) & 0xFFu;
+uint8_t Jbc::GetRelativeOffset(const uint8_t* data) {
+  return Formats::Get<Formats::BitRel::rel>(data);
 }
 
-uint32_t Jbc::GetTarget(const uint8_t* data, const uint64_t addr,
-                        const size_t len) {
-  return addr + Instruction::SignExtend(Jbc::GetRelativeOffset(data, len)) * 2 +
+uint32_t Jbc::GetTarget(const uint8_t* data, const uint64_t addr) {
+  return addr + Instruction::SignExtend(Jbc::GetRelativeOffset(data)) * 2 +
          length;
 }
 
-uint32_t Jmpa::GetConditionCode(const uint8_t* data, const size_t len) {
-  return (*(data + 1) & 0xF0u) >> 4u;
+uint32_t Jmpa::GetConditionCode(const uint8_t* data) {
+  return Formats::Get<Formats::CondCaddr::cc>(data);
 }
 
-uint32_t Jmpa::GetTarget(const uint8_t* data, const uint64_t addr,
-                         const size_t len) {
-  const auto wdata = (const uint16_t*)data;
-  return (addr & (0xFFu << 16u)) + *(wdata + 1);
+uint32_t Jmpa::GetTarget(const uint8_t* data, const uint64_t addr) {
+  return (addr & (0xFFu << 16u)) +
+         Formats::Get<Formats::CondCaddr::caddr>(data);
 }
 
-uint32_t Jmpr::GetConditionCode(const uint8_t* data, const size_t len) {
-  return (*data & 0xF0u) >> 4u;
+uint32_t Jmpr::GetConditionCode(const uint8_t* data) {
+  return Formats::Get<Formats::CondRel::cc>(data);
 }
 
-uint8_t Jmpr::GetRelativeOffset(const uint8_t* data, const size_t len) {
-  return *(data + 1) & 0xFFu;
+uint8_t Jmpr::GetRelativeOffset(const uint8_t* data) {
+  return Formats::Get<Formats::CondRel::rel>(data);
 }
 
-uint32_t Jmpr::GetTarget(const uint8_t* data, const uint64_t addr,
-                         const size_t len) {
-  return addr +
-         Instruction::SignExtend(Jmpr::GetRelativeOffset(data, len)) * 2 + 2;
+uint32_t Jmpr::GetTarget(const uint8_t* data, const uint64_t addr) {
+  return addr + Instruction::SignExtend(Jmpr::GetRelativeOffset(data)) * 2 +
+         length;
 }
 
-uint32_t Jmps::GetTarget(const uint8_t* data, const size_t len) {
-  const uint8_t seg = Instruction::GetOpSeg(data, len);
-  const uint16_t caddr = Instruction::GetOpCaddr(data, len);
+uint32_t Jmps::GetTarget(const uint8_t* data) {
+  const uint8_t seg = Instruction::GetOpSeg(data);
+  const uint16_t caddr = Instruction::GetOpCaddr(data);
   return ((uint32_t)seg << 16u) | caddr;
 }
 
-uint8_t Jnb::GetRelativeOffset(const uint8_t* data, const size_t len) {
-  const auto wdata = (const uint16_t*)data;
-  return *(wdata + 1) & 0xFFu;
+uint8_t Jnb::GetRelativeOffset(const uint8_t* data) {
+  return Formats::Get<Formats::BitRel::rel>(data);
 }
 
-uint32_t Jnb::GetTarget(const uint8_t* data, const uint64_t addr,
-                        const size_t len) {
-  return addr + Instruction::SignExtend(Jnb::GetRelativeOffset(data, len)) * 2 +
+uint32_t Jnb::GetTarget(const uint8_t* data, const uint64_t addr) {
+  return addr + Instruction::SignExtend(Jnb::GetRelativeOffset(data)) * 2 +
          length;
 }
 
-uint8_t Jnbs::GetRelativeOffset(const uint8_t* data, const size_t len) {
-  const auto wdata = (const uint16_t*)data;
-  return *(wdata + 1) & 0xFFu;
+uint8_t Jnbs::GetRelativeOffset(const uint8_t* data) {
+  return Formats::Get<Formats::BitRel::rel>(data);
 }
 
-uint32_t Jnbs::GetTarget(const uint8_t* data, const uint64_t addr,
-                         const size_t len) {
-  return addr +
-         Instruction::SignExtend(Jnbs::GetRelativeOffset(data, len)) * 2 +
+uint32_t Jnbs::GetTarget(const uint8_t* data, const uint64_t addr) {
+  return addr + Instruction::SignExtend(Jnbs::GetRelativeOffset(data)) * 2 +
          length;
 }
 
-uint32_t Trap::GetTarget(const uint8_t* data, const uint64_t addr) {
+uint32_t Pcall::GetTarget(const uint8_t* data, const uint64_t addr) {
+  return (addr & (0xFFu << 16u)) + Formats::Get<Formats::RegCaddr::caddr>(data);
+}
+
+// The vector table is in segment 0 whichever segment the TRAP is in (CSP is
+// cleared on entry)
+uint32_t Trap::GetTarget(const uint8_t* data) {
   const uint8_t trap7 = Trap::GetTrap7(data);
-  return (addr & (0xFFu << 16u)) + (trap7 * 4);
+  return trap7 * 4;
 }
 
 uint8_t Trap::GetTrap7(const uint8_t* data) {
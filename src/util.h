@@ -10,30 +10,12 @@
 #include <string>
 #include <vector>
 
+#include "state.h"
+
 namespace BN = BinaryNinja;
 
 namespace C166 {
 
-enum ExtState {
-  ExtNone = 0x0,
-  ExtRegister = 0x1,
-  ExtSegment = 0x2,
-  ExtPage = 0x4,
-  ExtAtomic = 0x8,
-  ExtNoneCustomDpps = 0x10,
-};
-
-class InstructionState {
- public:
-  uint8_t ext_state;
-  uint8_t num_insns;
-  uint32_t pag10;
-  uint32_t seg8;
-  uint32_t dpp[4];
-
-  InstructionState();
-};
-
 class Instruction {
   static uint32_t GetBitoffRamAddress(uint8_t value);
   static uint32_t GetBitoffSfrAddress(uint8_t value, bool extr);
@@ -54,23 +36,33 @@ class Instruction {
                                                   uint32_t pag10, uint32_t Rw,
                                                   uint16_t data16);
   // Indirect Addressing Expressions (Using DPP by default)
-  static BN::ExprId GetIndAddrExpr_Rw(BN::LowLevelILFunction &il, uint32_t Rw);
+  static BN::ExprId GetIndAddrExpr_Rw(BN::LowLevelILFunction &il,
+                                      uint64_t addr, uint32_t Rw);
   static BN::ExprId GetIndAddrExpr_Rw_data16(BN::LowLevelILFunction &il,
-                                             uint32_t Rw, uint16_t data16);
+                                             uint64_t addr, uint32_t Rw,
+                                             uint16_t data16);
 
   static void SetDefaultDpps(uint16_t dpp0, uint16_t dpp1, uint16_t dpp2,
                              uint16_t dpp3);
   static void SetDpps(uint64_t addr, uint16_t dpp0, uint16_t dpp1,
                       uint16_t dpp2, uint16_t dpp3);
   static void SetDppsRange(uint64_t start, uint64_t end, uint16_t dpp0,
-                           uint16_t dpp1, uint16_t dpp2, uint16_t dpp3);
+                           uint16_t dpp1, uint16_t dpp2, uint16_t dpp3,
+                           bool keep_ext);
   static void SetExtpPag10(uint64_t addr, uint16_t pag10, uint8_t num_insns);
   static void SetExtsSeg8(uint64_t addr, uint16_t seg8, uint8_t num_insns);
   static void SetExtr(uint64_t addr, uint8_t num_insns);
+  static void SetExtpPag10Range(uint64_t start, uint64_t end, uint16_t pag10,
+                                uint8_t num_insns);
+  static void SetExtsSeg8Range(uint64_t start, uint64_t end, uint16_t seg8,
+                               uint8_t num_insns);
+  static void SetExtrRange(uint64_t start, uint64_t end, uint8_t num_insns);
+  static void ApplyStateRanges(const std::vector<StateRange> &ranges);
   static bool ShouldUseExtr(uint64_t addr);
   static bool ShouldUseExts(uint64_t addr, uint32_t *seg8);
   static bool ShouldUseExtp(uint64_t addr, uint32_t *pag10);
   static bool ShouldUseCustomDpps(uint64_t addr, uint32_t *dpps);
+  static bool GetEffectiveDpps(uint64_t addr, uint32_t *dpps);
   static void writeStateMapToFile(std::string filename);
   static void loadStateMapFromFile(std::string filename);
   static size_t SerializeStateMap(uint8_t *buf, size_t size);
@@ -80,78 +72,90 @@ class Instruction {
   static InstructionState GetInstructionState(uint64_t addr);
 
   static const char *ConditionCodeToString(uint8_t code);
-  static uint8_t GetBitPosition(const uint8_t *data, size_t len);
+  static uint8_t GetBitPosition(const uint8_t *data);
   static BNLowLevelILFlagCondition GetFlagCondition(uint8_t code);
-  static uint32_t GetMem(uint64_t addr, const uint8_t *data, size_t len);
-  static uint8_t GetOpSeg(const uint8_t *data, size_t len);
-  static uint8_t GetData3(const uint8_t *data, size_t len);
-  static uint8_t GetData4High(const uint8_t *data, size_t len);
-  static uint8_t GetData4Low(const uint8_t *data, size_t len);
-  static uint8_t GetData8High(const uint8_t *data, size_t len);
-  static uint8_t GetData8Low(const uint8_t *data, size_t len);
-  static uint16_t GetData16(const uint8_t *data, size_t len);
-  static uint8_t GetIndirectIndex(const uint8_t *data, size_t len);
-  static uint16_t GetOpCaddr(const uint8_t *data, size_t len);
-  static uint8_t GetRegShortAddr(const uint8_t *data, size_t len);
+  static BN::ExprId GetCondition(BN::LowLevelILFunction &il, uint8_t code);
+  static uint32_t GetMem(uint64_t addr, const uint8_t *data);
+  static uint8_t GetOpSeg(const uint8_t *data);
+  static uint8_t GetData3(const uint8_t *data);
+  static uint8_t GetData4High(const uint8_t *data);
+  static uint8_t GetData4Low(const uint8_t *data);
+  static uint8_t GetData8High(const uint8_t *data);
+  static uint8_t GetData8Low(const uint8_t *data);
+  static uint16_t GetData16(const uint8_t *data);
+  static uint8_t GetIndirectIndex(const uint8_t *data);
+  static uint16_t GetOpCaddr(const uint8_t *data);
+  static uint8_t GetRegShortAddr(const uint8_t *data);
   static bool JumpDirect(BN::Architecture *arch, BN::LowLevelILFunction &il,
                          uint32_t target);
   static bool JumpIndirect(BN::Architecture *arch, BN::LowLevelILFunction &il,
                            uint32_t rid, uint32_t addr);
   static bool LiftOpMemReg(
-      uint64_t addr, const uint8_t *data, size_t len, size_t width,
-      uint32_t flags, bool store, BN::LowLevelILFunction &il,
+      uint64_t addr, const uint8_t *data, size_t width, uint32_t flags,
+      bool store, BN::LowLevelILFunction &il,
       const std::function<
           BN::ExprId(size_t size, BN::ExprId a, BN::ExprId b, uint32_t flags,
                      const BN::ILSourceLocation &loc)> &operation);
   static bool LiftOpRegData(
-      uint64_t addr, const uint8_t *data, size_t len, size_t width,
-      uint32_t flags, bool store, BN::LowLevelILFunction &il,
+      uint64_t addr, const uint8_t *data, size_t width, uint32_t flags,
+      bool store, BN::LowLevelILFunction &il,
       const std::function<
           BN::ExprId(size_t size, BN::ExprId a, BN::ExprId b, uint32_t flags,
                      const BN::ILSourceLocation &loc)> &operation);
   static bool LiftOpRegMem(
-      uint64_t addr, const uint8_t *data, size_t len, size_t width,
-      uint32_t flags, bool store, BN::LowLevelILFunction &il,
+      uint64_t addr, const uint8_t *data, size_t width, uint32_t flags,
+      bool store, BN::LowLevelILFunction &il,
       const std::function<
           BN::ExprId(size_t size, BN::ExprId a, BN::ExprId b, uint32_t flags,
                      const BN::ILSourceLocation &loc)> &operation);
   static bool LiftOpRnRm(
-      const uint8_t *data, size_t len, size_t width, uint32_t flags, bool store,
+      const uint8_t *data, size_t width, uint32_t flags, bool store,
       BN::LowLevelILFunction &il,
       const std::function<
           BN::ExprId(size_t size, BN::ExprId a, BN::ExprId b, uint32_t flags,
                      const BN::ILSourceLocation &loc)> &operation);
   static bool LiftOpRnRwiData3(
-      uint64_t addr, const uint8_t *data, size_t len, size_t width,
-      uint32_t flags, bool store, BN::LowLevelILFunction &il,
+      uint64_t addr, const uint8_t *data, size_t width, uint32_t flags,
+      bool store, BN::LowLevelILFunction &il,
       const std::function<
           BN::ExprId(size_t size, BN::ExprId a, BN::ExprId b, uint32_t flags,
                      const BN::ILSourceLocation &loc)> &operation);
   static int8_t SignExtend(uint8_t data);
-  static bool TextOpMemReg(uint64_t addr, const uint8_t *data, size_t len,
-                           size_t width,
+  static bool TextOpMemReg(uint64_t addr, const uint8_t *data, size_t width,
                            std::vector<BN::InstructionTextToken> &result,
                            const std::string &instr);
-  static bool TextOpRegData(uint64_t addr, const uint8_t *data, size_t len,
+  static bool TextOpRegData(uint64_t addr, const uint8_t *data,
                             size_t width,
                             std::vector<BN::InstructionTextToken> &result,
                             const std::string &instr);
-  static bool TextOpRegMem(uint64_t addr, const uint8_t *data, size_t len,
-                           size_t width,
+  static bool TextOpRegMem(uint64_t addr, const uint8_t *data, size_t width,
                            std::vector<BN::InstructionTextToken> &result,
                            const std::string &instr);
-  static bool TextOpRnRm(const uint8_t *data, size_t len, size_t width,
+  static bool TextOpRnRm(const uint8_t *data, size_t width,
                          std::vector<BN::InstructionTextToken> &result,
                          const std::string &instr);
-  static bool TextOpRnRwiData3(const uint8_t *data, size_t len, size_t width,
+  static bool TextOpRnRwiData3(const uint8_t *data, size_t width,
                                std::vector<BN::InstructionTextToken> &result,
                                const std::string &instr);
   static uint32_t TranslateBitOff(uint64_t addr, uint32_t bitoff);
+  static BN::ExprId GetBitWord(BN::LowLevelILFunction &il, uint32_t bitaddr);
+  static BN::ExprId SetBitWord(BN::LowLevelILFunction &il, uint32_t bitaddr,
+                               BN::ExprId value, uint32_t flags = 0);
+  static BN::ExprId GetBit(BN::LowLevelILFunction &il, uint32_t bitaddr,
+                           uint8_t bitpos);
+  static BN::ExprId TestBit(BN::LowLevelILFunction &il, uint32_t bitaddr,
+                            uint8_t bitpos, bool set = true);
   static uint32_t TranslateMem(uint32_t mem);
   static uint32_t TranslateReg(uint64_t addr, uint32_t reg);
   static const char *RegToStr(uint32_t rid);
   static BN::ExprId ElideReg(BN::LowLevelILFunction &il, uint32_t reg,
                              int width);
+  static bool GetSfrRegister(uint32_t addr, uint32_t &reg);
+  static BN::ExprId LoadDirect(BN::LowLevelILFunction &il, size_t width,
+                               uint32_t addr);
+  static BN::ExprId StoreDirect(BN::LowLevelILFunction &il, size_t width,
+                                uint32_t addr, BN::ExprId value,
+                                uint32_t flags = 0);
 };
 }  // namespace C166
 
@@ -0,0 +1,27 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_VARIANTS_H_
+#define SRC_VARIANTS_H_
+
+#include <cstdint>
+
+#include "registers.h"
+
+namespace C166 {
+// Properties that differ between the registered architectures. Handlers that
+// depend on them are templated on the variant, so each architecture gets its
+// own lifter with the checks resolved at compile time.
+struct Variant {
+  uint32_t stack_pointer;  // User stack pointer of the Tasking ABI
+  bool link_register;      // Whether VIRTUAL_LR is reported as link register
+};
+}  // namespace C166
+
+namespace C166::Variants {
+inline constexpr Variant TC{Registers::R0, false};
+inline constexpr Variant TVX{Registers::R15, false};
+inline constexpr Variant V2{Registers::R0, true};
+}  // namespace C166::Variants
+
+#endif  // SRC_VARIANTS_H_
@@ -0,0 +1,1075 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+// Differential check of the lifter against the reference interpreter: random
+// straight-line sequences are run on the Emulator and, starting from the same
+// state, their LLIL is evaluated by a minimal interpreter below. GPRs, MDH/MDL,
+// data memory and the PSW flags must agree afterwards. Flag write types are
+// lowered by the architecture's C166::Flags::GetFlagWriteLowLevelIL, with a
+// stand-in for the core's defaults; flags neither of them models are unknown,
+// are not compared, and skip sequences that read them.
+//
+// Usage: c166_difftest [cases] [seed]
+
+#include <binaryninjaapi.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "emulator.h"
+#include "flags.h"
+#include "instructions.h"
+#include "registers.h"
+#include "sfr.h"
+#include "util.h"
+#include "variants.h"
+
+namespace BN = BinaryNinja;
+
+namespace {
+
+using C166::Emulator;
+using C166::Instruction;
+namespace Registers = C166::Registers;
+namespace Sfr = C166::Sfr;
+
+constexpr uint32_t code_base = 0x10000;
+// C166Architecture::GetMaxInstructionLength: the core never offers the lifter
+// more bytes than this
+constexpr size_t max_instruction_length = 8;
+
+// Data the generated sequences may touch: DPP pages 0-2 and the
+// bit-addressable RAM. Everything else (GPRs at CP, SFRs) is modeled by
+// registers on the IL side.
+constexpr uint32_t data_end = 0xC000;
+constexpr uint32_t bit_ram_start = 0xFD00;
+constexpr uint32_t bit_ram_end = 0xFE00;
+
+// N, C, V, Z and E: PSW bits 0-4, numbered as in flags.h
+constexpr uint32_t psw_flags = 5;
+
+// Thrown for IL outside what the evaluator models, or whose result the
+// hardware leaves undefined (division overflow, misaligned word access)
+struct Unsupported {};
+
+uint64_t Mask(const size_t size) {
+  return size >= 8 ? ~uint64_t{0} : (uint64_t{1} << (8 * size)) - 1;
+}
+
+int64_t Signed(const uint64_t value, const size_t size) {
+  const unsigned shift = 64 - 8 * size;
+  return static_cast<int64_t>(value << shift) >> shift;
+}
+
+bool IsDataAddress(const uint32_t addr) {
+  return addr < data_end || (addr >= bit_ram_start && addr < bit_ram_end);
+}
+
+// Where a register lives, as C166Architecture::GetRegisterInfo reports it
+struct RegisterSlot {
+  uint32_t full;
+  unsigned shift;
+  size_t size;
+};
+
+RegisterSlot GetSlot(const uint32_t reg) {
+  if (reg <= Registers::R15) return {reg, 0, 2};
+  if (reg >= Registers::RL0 && reg <= Registers::RH7)
+    return {(reg - Registers::RL0) / 2, 8 * ((reg - Registers::RL0) % 2), 1};
+  switch (reg) {
+    case Registers::MD:
+      return {Registers::MD, 0, 4};
+    case Registers::MDH:
+      return {Registers::MD, 16, 2};
+    case Registers::MDL:
+      return {Registers::MD, 0, 2};
+    case Registers::DPP:
+      return {Registers::DPP, 0, 8};
+    case Registers::DPP0:
+    case Registers::DPP1:
+    case Registers::DPP2:
+    case Registers::DPP3:
+      return {Registers::DPP, 16u * (reg - Registers::DPP0), 2};
+    default:
+      return {reg, 0, 8};
+  }
+}
+
+// Operands of each operation that are expressions rather than register,
+// flag or constant values
+bool IsExprOperand(const BNLowLevelILOperation operation, const int i) {
+  switch (operation) {
+    case LLIL_NOP:
+    case LLIL_POP:
+    case LLIL_REG:
+    case LLIL_REG_SPLIT:
+    case LLIL_CONST:
+    case LLIL_CONST_PTR:
+    case LLIL_FLAG:
+    case LLIL_FLAG_GROUP:
+    case LLIL_NORET:
+    case LLIL_GOTO:
+    case LLIL_INTRINSIC:
+    case LLIL_UNIMPL:
+      return false;
+    case LLIL_SET_REG:
+    case LLIL_SET_FLAG:
+      return i == 1;
+    case LLIL_SET_REG_SPLIT:
+      return i == 2;
+    case LLIL_LOAD:
+    case LLIL_PUSH:
+    case LLIL_NEG:
+    case LLIL_NOT:
+    case LLIL_SX:
+    case LLIL_ZX:
+    case LLIL_LOW_PART:
+    case LLIL_JUMP:
+    case LLIL_CALL:
+    case LLIL_CALL_STACK_ADJUST:
+    case LLIL_TAILCALL:
+    case LLIL_RET:
+    case LLIL_IF:
+    case LLIL_UNIMPL_MEM:
+      return i == 0;
+    case LLIL_ADC:
+    case LLIL_SBB:
+      return i <= 2;
+    default:
+      return i <= 1;
+  }
+}
+
+int OperandCount(const BNLowLevelILOperation operation) {
+  switch (operation) {
+    case LLIL_NOP:
+    case LLIL_POP:
+    case LLIL_NORET:
+    case LLIL_GOTO:
+    case LLIL_UNIMPL:
+      return 0;
+    case LLIL_SET_REG_SPLIT:
+    case LLIL_ADC:
+    case LLIL_SBB:
+      return 3;
+    case LLIL_SET_REG:
+    case LLIL_SET_FLAG:
+    case LLIL_STORE:
+    case LLIL_REG_SPLIT:
+    case LLIL_CALL_STACK_ADJUST:
+      return 2;
+    default:
+      return IsExprOperand(operation, 1) ? 2 : 1;
+  }
+}
+
+// Stand-in for the core's default lowering of the flag roles, which
+// C166::Flags::GetFlagWriteLowLevelIL falls back to. Only the roles and
+// operations whose lowering is standard are modeled; the flag is unknown
+// otherwise.
+bool GetDefaultFlag(const BNFlagRole role, const BNLowLevelILOperation op,
+                    const size_t size, const uint64_t *operands,
+                    const size_t operandCount, const uint64_t result,
+                    bool &value) {
+  const uint64_t mask = Mask(size);
+  const uint64_t sign = uint64_t{1} << (8 * size - 1);
+  const uint64_t a = operands[0] & mask;
+  const uint64_t b = (operandCount > 1) ? operands[1] & mask : 0;
+  const uint64_t c = (operandCount > 2) ? operands[2] & 1 : 0;
+
+  switch (role) {
+    case ZeroFlagRole:
+      value = (result & mask) == 0;
+      return true;
+    case NegativeSignFlagRole:
+      value = (result & sign) != 0;
+      return true;
+    case CarryFlagRole:
+      if (op == LLIL_ADD || op == LLIL_ADC) {
+        value = a + b + c > mask;
+        return true;
+      }
+      if (op == LLIL_SUB || op == LLIL_SBB) {
+        value = a < b + c;
+        return true;
+      }
+      return false;
+    case OverflowFlagRole:
+      if (op == LLIL_ADD || op == LLIL_ADC) {
+        value = (~(a ^ b) & (a ^ result) & sign) != 0;
+        return true;
+      }
+      if (op == LLIL_SUB || op == LLIL_SBB) {
+        value = ((a ^ b) & (a ^ result) & sign) != 0;
+        return true;
+      }
+      return false;
+    default:
+      return false;
+  }
+}
+
+class Evaluator {
+ public:
+  Evaluator(const std::vector<uint8_t> &image, const uint32_t stack_pointer)
+      : image(image), stack_pointer(stack_pointer) {}
+
+  uint64_t GetRegister(const uint32_t reg, const size_t size) const {
+    const RegisterSlot slot = GetSlot(reg);
+    const auto it = registers.find(slot.full);
+    const uint64_t full = (it == registers.end()) ? 0 : it->second;
+    return (full >> slot.shift) & Mask(size < slot.size ? size : slot.size);
+  }
+
+  void SetRegister(const uint32_t reg, const uint64_t value) {
+    const RegisterSlot slot = GetSlot(reg);
+    const uint64_t mask = Mask(slot.size) << slot.shift;
+    uint64_t &full = registers[slot.full];
+    full = (full & ~mask) | ((value << slot.shift) & mask);
+  }
+
+  // Returns false while the flag's value is unknown
+  bool GetFlag(const uint32_t flag, bool &value) const {
+    const auto it = flags.find(flag);
+    if (it == flags.end()) return false;
+    value = it->second;
+    return true;
+  }
+
+  void SetFlag(const uint32_t flag, const bool value) { flags[flag] = value; }
+
+  uint8_t ReadByte(const uint32_t addr) const {
+    const auto it = written.find(addr);
+    return (it == written.end()) ? image[addr] : it->second;
+  }
+
+  void Run(const BN::LowLevelILFunction &il) {
+    for (const BN::ExprId insn : il.instructions) Execute(il, insn);
+  }
+
+ private:
+  const std::vector<uint8_t> &image;
+  const uint32_t stack_pointer;
+  std::map<uint32_t, uint64_t> registers;
+  std::map<uint32_t, bool> flags;
+  std::unordered_map<uint32_t, uint8_t> written;
+
+  static void CheckAccess(const uint64_t addr, const size_t size) {
+    if ((size == 2 && (addr & 1)) || !IsDataAddress(addr) ||
+        !IsDataAddress(addr + size - 1))
+      throw Unsupported();
+  }
+
+  uint64_t Read(const uint64_t addr, const size_t size) const {
+    CheckAccess(addr, size);
+    uint64_t value = 0;
+    for (size_t i = 0; i < size; i++)
+      value |= uint64_t{ReadByte(addr + i)} << (8 * i);
+    return value;
+  }
+
+  void Write(const uint64_t addr, const size_t size, const uint64_t value) {
+    CheckAccess(addr, size);
+    for (size_t i = 0; i < size; i++) written[addr + i] = value >> (8 * i);
+  }
+
+  uint64_t PopValue(const size_t size) {
+    const uint64_t sp = GetRegister(stack_pointer, 2);
+    const uint64_t value = Read(sp, size);
+    SetRegister(stack_pointer, sp + size);
+    return value;
+  }
+
+  // Applies a flag write type the way the core would: the architecture's
+  // lowering where it has one, the default for the flag's role otherwise.
+  // The operands are passed as constants, as they are already evaluated.
+  void WriteFlags(const BNLowLevelILOperation op, const size_t size,
+                  const uint32_t wtype, const uint64_t *values,
+                  const size_t count, const uint64_t result) {
+    BNRegisterOrConstant operands[4];
+    for (size_t i = 0; i < count; i++) operands[i] = {true, 0, values[i]};
+
+    std::map<uint32_t, bool> written_flags;
+    std::vector<uint32_t> unknown;
+    for (const uint32_t flag : C166::Flags::GetFlagsWritten(wtype)) {
+      BN::LowLevelILFunction lowering;
+      BN::ExprId expr;
+      bool value;
+      if (C166::Flags::GetFlagWriteLowLevelIL(op, size, wtype, flag, operands,
+                                              count, lowering, expr))
+        written_flags[flag] = Eval(lowering, expr) != 0;
+      else if (GetDefaultFlag(C166::Flags::GetFlagRole(flag), op, size, values,
+                              count, result, value))
+        written_flags[flag] = value;
+      else
+        unknown.push_back(flag);
+    }
+
+    for (const auto &[flag, value] : written_flags) flags[flag] = value;
+    for (const uint32_t flag : unknown) flags.erase(flag);
+  }
+
+  uint64_t Eval(const BN::LowLevelILFunction &il, const BN::ExprId id) {
+    const BN::LowLevelILExpr &expr = il.exprs[id];
+    const BNLowLevelILOperation operation = expr.operation;
+    const uint64_t *op = expr.operands;
+    const size_t size = expr.size;
+    // Size 0 marks a boolean, e.g. the lowering of a flag
+    const uint64_t mask = size ? Mask(size) : ~uint64_t{0};
+    const unsigned bits = 8 * size;
+
+    // Operands are evaluated once, up front, as flag writes need their values
+    const int count = OperandCount(operation);
+    uint64_t values[4] = {};
+    for (int i = 0; i < count; i++)
+      values[i] = IsExprOperand(operation, i) ? Eval(il, op[i]) : op[i];
+    const auto operand = [&](const int i) { return values[i] & mask; };
+
+    uint64_t result;
+    switch (operation) {
+      case LLIL_CONST:
+      case LLIL_CONST_PTR:
+        result = op[0] & mask;
+        break;
+      case LLIL_REG:
+        result = GetRegister(op[0], size);
+        break;
+      case LLIL_REG_SPLIT:
+        result = GetRegister(op[0], size) << bits | GetRegister(op[1], size);
+        break;
+      case LLIL_FLAG: {
+        bool value;
+        if (!GetFlag(op[0], value)) throw Unsupported();
+        result = value;
+        break;
+      }
+      case LLIL_LOAD:
+        result = Read(values[0], size);
+        break;
+      case LLIL_POP:
+        result = PopValue(size);
+        break;
+      case LLIL_ADD:
+        result = (operand(0) + operand(1)) & mask;
+        break;
+      case LLIL_ADC:
+        result = (operand(0) + operand(1) + operand(2)) & mask;
+        break;
+      case LLIL_SUB:
+        result = (operand(0) - operand(1)) & mask;
+        break;
+      case LLIL_SBB:
+        result = (operand(0) - operand(1) - operand(2)) & mask;
+        break;
+      case LLIL_AND:
+        result = operand(0) & operand(1);
+        break;
+      case LLIL_OR:
+        result = operand(0) | operand(1);
+        break;
+      case LLIL_XOR:
+        result = operand(0) ^ operand(1);
+        break;
+      case LLIL_LSL:
+        result = values[1] >= bits ? 0 : (operand(0) << values[1]) & mask;
+        break;
+      case LLIL_LSR:
+        result = values[1] >= bits ? 0 : operand(0) >> values[1];
+        break;
+      case LLIL_ASR: {
+        const int64_t a = Signed(operand(0), size);
+        const uint64_t b = values[1];
+        result = static_cast<uint64_t>(a >> (b >= bits ? bits - 1 : b)) & mask;
+        break;
+      }
+      case LLIL_ROL:
+      case LLIL_ROR: {
+        const uint64_t a = operand(0);
+        unsigned b = values[1] % bits;
+        if (operation == LLIL_ROR) b = (bits - b) % bits;
+        result = b == 0 ? a : ((a << b) | (a >> (bits - b))) & mask;
+        break;
+      }
+      case LLIL_MUL:
+        result = (operand(0) * operand(1)) & mask;
+        break;
+      case LLIL_MULU_DP:
+        result = ((values[0] & Mask(size / 2)) * (values[1] & Mask(size / 2))) &
+                 mask;
+        break;
+      case LLIL_MULS_DP:
+        result = static_cast<uint64_t>(Signed(values[0], size / 2) *
+                                       Signed(values[1], size / 2)) &
+                 mask;
+        break;
+      case LLIL_DIVU:
+      case LLIL_MODU:
+      case LLIL_DIVU_DP:
+      case LLIL_MODU_DP: {
+        const bool wide =
+            operation == LLIL_DIVU_DP || operation == LLIL_MODU_DP;
+        const uint64_t a = values[0] & Mask(wide ? 2 * size : size);
+        const uint64_t b = operand(1);
+        if (b == 0 || a / b > mask) throw Unsupported();
+        const bool div = operation == LLIL_DIVU || operation == LLIL_DIVU_DP;
+        result = div ? a / b : a % b;
+        break;
+      }
+      case LLIL_DIVS:
+      case LLIL_MODS:
+      case LLIL_DIVS_DP:
+      case LLIL_MODS_DP: {
+        const bool wide =
+            operation == LLIL_DIVS_DP || operation == LLIL_MODS_DP;
+        const int64_t a = Signed(values[0], wide ? 2 * size : size);
+        const int64_t b = Signed(values[1], size);
+        if (b == 0 || Signed(a / b, size) != a / b) throw Unsupported();
+        const bool div = operation == LLIL_DIVS || operation == LLIL_DIVS_DP;
+        result = static_cast<uint64_t>(div ? a / b : a % b) & mask;
+        break;
+      }
+      case LLIL_NEG:
+        result = (0 - operand(0)) & mask;
+        break;
+      case LLIL_NOT:
+        result = ~operand(0) & mask;
+        break;
+      case LLIL_SX:
+        result =
+            static_cast<uint64_t>(Signed(values[0], il.exprs[op[0]].size)) &
+            mask;
+        break;
+      case LLIL_ZX:
+      case LLIL_LOW_PART:
+        result = operand(0);
+        break;
+      case LLIL_CMP_E:
+        result = operand(0) == operand(1);
+        break;
+      case LLIL_CMP_NE:
+        result = operand(0) != operand(1);
+        break;
+      case LLIL_CMP_UGT:
+        result = operand(0) > operand(1);
+        break;
+      default:
+        throw Unsupported();
+    }
+
+    if (expr.flags != 0)
+      WriteFlags(operation, size, expr.flags, values, count, result);
+    return result;
+  }
+
+  void Execute(const BN::LowLevelILFunction &il, const BN::ExprId insn) {
+    const BN::LowLevelILExpr &expr = il.exprs[insn];
+    const uint64_t *op = expr.operands;
+
+    switch (expr.operation) {
+      case LLIL_NOP:
+        break;
+      case LLIL_SET_FLAG:
+        SetFlag(op[0], Eval(il, op[1]) != 0);
+        break;
+      case LLIL_SET_REG: {
+        const uint64_t value = Eval(il, op[1]) & Mask(expr.size);
+        if (expr.flags != 0)
+          WriteFlags(LLIL_SET_REG, expr.size, expr.flags, &value, 1, value);
+        SetRegister(op[0], value);
+        break;
+      }
+      case LLIL_SET_REG_SPLIT: {
+        const uint64_t value = Eval(il, op[2]);
+        SetRegister(op[1], value & Mask(expr.size));
+        SetRegister(op[0], (value >> (8 * expr.size)) & Mask(expr.size));
+        break;
+      }
+      case LLIL_STORE: {
+        const uint64_t addr = Eval(il, op[0]);
+        const uint64_t value = Eval(il, op[1]) & Mask(expr.size);
+        if (expr.flags != 0)
+          WriteFlags(LLIL_STORE, expr.size, expr.flags, &value, 1, value);
+        Write(addr, expr.size, value);
+        break;
+      }
+      case LLIL_PUSH: {
+        const uint64_t value = Eval(il, op[0]) & Mask(expr.size);
+        if (expr.flags != 0)
+          WriteFlags(LLIL_PUSH, expr.size, expr.flags, &value, 1, value);
+        const uint64_t sp = (GetRegister(stack_pointer, 2) - expr.size) & 0xFFFF;
+        Write(sp, expr.size, value);
+        SetRegister(stack_pointer, sp);
+        break;
+      }
+      case LLIL_JUMP:
+      case LLIL_CALL:
+      case LLIL_CALL_STACK_ADJUST:
+      case LLIL_TAILCALL:
+      case LLIL_RET:
+      case LLIL_NORET:
+      case LLIL_IF:
+      case LLIL_GOTO:
+      case LLIL_INTRINSIC:
+      case LLIL_UNIMPL:
+      case LLIL_UNIMPL_MEM:
+        throw Unsupported();
+      default:
+        // An expression lifted only for its flags, e.g. CMP
+        Eval(il, insn);
+        break;
+    }
+  }
+};
+
+// Operand layout of a generated instruction
+enum Kind {
+  Rr,         // op, random register/immediate byte
+  Rn,         // op, nn (DIVx: the register is encoded twice)
+  RegData16,  // op, reg, #data16
+  RegData8,   // op, reg, #data8, 00
+  RegMem,     // op, reg, mem (either direction)
+  RefMem,     // op, 0n, mem
+  RwData16,   // op, nm, #data16 offset
+  Bitoff,     // op, bitoff
+  Bfld,       // op, bitoff, mask/data, data/mask
+  BitBit,     // op, QQ, ZZ, qz
+  GprMem,     // op, Fn, mem (CMPIx/CMPDx)
+  GprData16   // op, Fn, #data16 (CMPIx/CMPDx)
+};
+
+struct Form {
+  uint8_t op;
+  Kind kind;
+  bool byte;  // reg operands select byte GPRs
+};
+
+std::vector<Form> GetForms() {
+  std::vector<Form> forms;
+
+  // ADD/ADDC/SUB/SUBC/CMP/XOR/AND/OR and their byte forms
+  for (uint8_t hi = 0x00; hi <= 0x70; hi += 0x10) {
+    for (const uint8_t byte : {0, 1}) {
+      forms.push_back({static_cast<uint8_t>(hi | 0x0 | byte), Rr, bool(byte)});
+      forms.push_back({static_cast<uint8_t>(hi | 0x8 | byte), Rr, bool(byte)});
+      forms.push_back(
+          {static_cast<uint8_t>(hi | 0x2 | byte), RegMem, bool(byte)});
+      if (hi != 0x40)
+        forms.push_back(
+            {static_cast<uint8_t>(hi | 0x4 | byte), RegMem, bool(byte)});
+      forms.push_back({static_cast<uint8_t>(hi | 0x6 | byte),
+                       byte ? RegData8 : RegData16, bool(byte)});
+    }
+  }
+
+  // Shifts and rotates
+  for (const uint8_t op : {0x0C, 0x1C, 0x2C, 0x3C, 0x4C, 0x5C, 0x6C, 0x7C,
+                           0xAC, 0xBC})
+    forms.push_back({op, Rr, false});
+
+  // MUL/MULU, DIV/DIVU/DIVL/DIVLU, CPL/CPLB, NEG/NEGB
+  forms.push_back({0x0B, Rr, false});
+  forms.push_back({0x1B, Rr, false});
+  for (const uint8_t op : {0x4B, 0x5B, 0x6B, 0x7B, 0x91, 0xB1, 0x81, 0xA1})
+    forms.push_back({op, Rn, false});
+
+  // MOV/MOVB
+  for (const uint8_t op : {0xF0, 0xE0, 0xA8, 0x98, 0xB8, 0x88, 0xC8, 0xD8,
+                           0xE8, 0xF1, 0xE1, 0xA9, 0x99, 0xB9, 0x89, 0xC9,
+                           0xD9, 0xE9, 0xC0, 0xD0})
+    forms.push_back({op, Rr, false});
+  forms.push_back({0xE6, RegData16, false});
+  forms.push_back({0xE7, RegData8, true});
+  for (const uint8_t op : {0xD4, 0xC4, 0xF4, 0xE4})
+    forms.push_back({op, RwData16, false});
+  for (const uint8_t op : {0x84, 0x94, 0xA4, 0xB4})
+    forms.push_back({op, RefMem, false});
+  forms.push_back({0xF2, RegMem, false});
+  forms.push_back({0xF6, RegMem, false});
+  forms.push_back({0xF3, RegMem, true});
+  forms.push_back({0xF7, RegMem, true});
+  forms.push_back({0xC2, RegMem, false});  // MOVBZ reg, mem
+  forms.push_back({0xD2, RegMem, false});  // MOVBS reg, mem
+  forms.push_back({0xC5, RegMem, true});   // MOVBZ mem, reg
+  forms.push_back({0xD5, RegMem, true});   // MOVBS mem, reg
+
+  // BCLR/BSET, BFLDL/BFLDH, bit-bit operations
+  for (unsigned pos = 0; pos < 16; pos++) {
+    forms.push_back({static_cast<uint8_t>(pos << 4 | 0xE), Bitoff, false});
+    forms.push_back({static_cast<uint8_t>(pos << 4 | 0xF), Bitoff, false});
+  }
+  forms.push_back({0x0A, Bfld, false});
+  forms.push_back({0x1A, Bfld, false});
+  for (const uint8_t op : {0x2A, 0x3A, 0x4A, 0x5A, 0x6A, 0x7A})
+    forms.push_back({op, BitBit, false});
+
+  // CMPI1/CMPI2/CMPD1/CMPD2
+  for (const uint8_t hi : {0x80, 0x90, 0xA0, 0xB0}) {
+    forms.push_back({hi, Rr, false});
+    forms.push_back({static_cast<uint8_t>(hi | 0x2), GprMem, false});
+    forms.push_back({static_cast<uint8_t>(hi | 0x6), GprData16, false});
+  }
+
+  return forms;
+}
+
+class Generator {
+ public:
+  explicit Generator(const uint32_t seed) : rng(seed) {}
+
+  unsigned Below(const unsigned n) { return rng() % n; }
+
+  // Operand values with the arithmetic edge cases over-represented
+  uint16_t Value() {
+    static constexpr uint16_t edges[] = {0x0000, 0x0001, 0x007F, 0x0080,
+                                         0x00FF, 0x7FFF, 0x8000, 0xFFFF};
+    if (Below(4) == 0) return edges[Below(sizeof(edges) / sizeof(edges[0]))];
+    return rng();
+  }
+
+  // An even data address (DPP pages 0-2 translate to themselves)
+  uint16_t Pointer() {
+    if (Below(8) == 0) return bit_ram_start + 2 * Below(0x80);
+    return 2 * Below(data_end / 2);
+  }
+
+  uint8_t Reg(const bool byte) {
+    if (Below(8) == 0) return Below(2) ? 0x06 : 0x07;  // MDH, MDL
+    return 0xF0 | Below(16);
+  }
+
+  // A data address, or one of the MDH/MDL bytes through DPP3
+  uint16_t Mem(const bool byte) {
+    if (Below(16) == 0) return Sfr::MDH + (byte ? Below(4) : 2 * Below(2));
+    return Pointer();
+  }
+
+  uint8_t BitoffByte() {
+    return Below(2) ? Below(0x80) : 0xF0 | Below(16);
+  }
+
+  void Emit(const Form &form, std::vector<uint8_t> &code) {
+    const auto word = [&code](const uint16_t value) {
+      code.push_back(value & 0xFF);
+      code.push_back(value >> 8);
+    };
+
+    code.push_back(form.op);
+    switch (form.kind) {
+      case Rr:
+        code.push_back(rng());
+        break;
+      case Rn: {
+        const uint8_t n = Below(16);
+        code.push_back(n << 4 | n);
+        break;
+      }
+      case RegData16:
+        code.push_back(Reg(form.byte));
+        word(Value());
+        break;
+      case RegData8:
+        code.push_back(Reg(true));
+        code.push_back(Value());
+        code.push_back(0);
+        break;
+      case RegMem:
+        code.push_back(Reg(form.byte));
+        word(Mem(form.byte));
+        break;
+      case RefMem:
+        code.push_back(Below(16));
+        word(Pointer());
+        break;
+      case RwData16:
+        code.push_back(rng());
+        word(2 * Below(0x80));
+        break;
+      case Bitoff:
+        code.push_back(BitoffByte());
+        break;
+      case Bfld:
+        code.push_back(BitoffByte());
+        code.push_back(rng());
+        code.push_back(rng());
+        break;
+      case BitBit:
+        code.push_back(BitoffByte());
+        code.push_back(BitoffByte());
+        code.push_back(rng());
+        break;
+      case GprMem:
+        code.push_back(0xF0 | Below(16));
+        word(Mem(false));
+        break;
+      case GprData16:
+        code.push_back(0xF0 | Below(16));
+        word(Value());
+        break;
+    }
+  }
+
+  // ADD/SUB followed by ADDC/SUBC on the next register pair, the long
+  // arithmetic idiom the lifter fuses. Pairs may start on an odd register,
+  // and the source pair often overlaps the destination pair.
+  void EmitLongArith(std::vector<uint8_t> &code) {
+    const uint8_t op = Below(2) ? 0x00 : 0x20;
+    const uint8_t rn = Below(15);
+    switch (Below(3)) {
+      case 0: {  // Rwn, Rwm
+        uint8_t rm = Below(15);
+        if (Below(2)) rm = std::clamp(rn + int(Below(3)) - 1, 0, 14);
+        code.insert(code.end(), {op, uint8_t(rn << 4 | rm),
+                                 uint8_t(op + 0x10),
+                                 uint8_t((rn + 1) << 4 | (rm + 1))});
+        break;
+      }
+      case 1:  // Rwn, #data3
+        code.insert(code.end(), {uint8_t(op | 0x8),
+                                 uint8_t(rn << 4 | Below(8)),
+                                 uint8_t((op + 0x10) | 0x8),
+                                 uint8_t((rn + 1) << 4 | Below(8))});
+        break;
+      default:  // reg, #data16
+        for (const uint8_t step : {0, 1}) {
+          const uint16_t value = Value();
+          code.insert(code.end(), {uint8_t((op + 0x10 * step) | 0x6),
+                                   uint8_t(0xF0 | (rn + step)),
+                                   uint8_t(value & 0xFF),
+                                   uint8_t(value >> 8)});
+        }
+        break;
+    }
+  }
+
+  std::mt19937 rng;
+};
+
+template <C166::Variant V>
+bool Lift(const uint8_t *data, const uint64_t addr, size_t &len,
+          BN::LowLevelILFunction &il) {
+  using namespace C166;  // NOLINT
+  const uint8_t op = data[0];
+
+  if ((op & 0xF) == 0xE) return Bclr::Lift(data, addr, len, il);
+  if ((op & 0xF) == 0xF) return Bset::Lift(data, addr, len, il);
+
+  if (op <= 0x79 && (op & 0xF) <= 0x9 && (op & 0xF) != 0x0A) {
+    const bool byte = op & 1;
+    switch (op >> 4) {
+      case 0x0:
+        return byte ? Addb::Lift(op, data, addr, len, il)
+                    : Add::Lift(op, data, addr, len, il);
+      case 0x1:
+        return byte ? Addcb::Lift(op, data, addr, len, il)
+                    : Addc::Lift(op, data, addr, len, il);
+      case 0x2:
+        return byte ? Subb::Lift(op, data, addr, len, il)
+                    : Sub::Lift(op, data, addr, len, il);
+      case 0x3:
+        return byte ? Subcb::Lift(op, data, addr, len, il)
+                    : Subc::Lift(op, data, addr, len, il);
+      case 0x4:
+        return byte ? Cmpb::Lift(op, data, addr, len, il)
+                    : Cmp::Lift(op, data, addr, len, il);
+      case 0x5:
+        return byte ? Xorb::Lift(op, data, addr, len, il)
+                    : Xor::Lift(op, data, addr, len, il);
+      case 0x6:
+        return byte ? Andb::Lift(op, data, addr, len, il)
+                    : And::Lift(op, data, addr, len, il);
+      default:
+        return byte ? Orb::Lift(op, data, addr, len, il)
+                    : Or::Lift(op, data, addr, len, il);
+    }
+  }
+
+  switch (op) {
+    case 0x0C: return Rol::Liftx0C(data, addr, len, il);
+    case 0x1C: return Rol::Liftx1C(data, addr, len, il);
+    case 0x2C: return Ror::Liftx2C(data, addr, len, il);
+    case 0x3C: return Ror::Liftx3C(data, addr, len, il);
+    case 0x4C: return Shl::Liftx4C(data, addr, len, il);
+    case 0x5C: return Shl::Liftx5C(data, addr, len, il);
+    case 0x6C: return Shr::Liftx6C(data, addr, len, il);
+    case 0x7C: return Shr::Liftx7C(data, addr, len, il);
+    case 0xAC: return Ashr::LiftxAC(data, addr, len, il);
+    case 0xBC: return Ashr::LiftxBC(data, addr, len, il);
+    case 0x0B: return Mul::Lift(data, addr, len, il);
+    case 0x1B: return Mulu::Lift(data, addr, len, il);
+    case 0x4B: return Div::Lift(data, addr, len, il);
+    case 0x5B: return Divu::Lift(data, addr, len, il);
+    case 0x6B: return Divl::Lift(data, addr, len, il);
+    case 0x7B: return Divlu::Lift(data, addr, len, il);
+    case 0x91: return Cpl::Lift(data, addr, len, il);
+    case 0xB1: return Cplb::Lift(data, addr, len, il);
+    case 0x81: return Neg::Lift(data, addr, len, il);
+    case 0xA1: return Negb::Lift(data, addr, len, il);
+    case 0xF0: return Mov::LiftxF0(data, addr, len, il);
+    case 0xE0: return Mov::LiftxE0(data, addr, len, il);
+    case 0xA8: return Mov::LiftxA8(data, addr, len, il);
+    case 0x98: return Mov::Liftx98<V>(data, addr, len, il);
+    case 0xB8: return Mov::LiftxB8(data, addr, len, il);
+    case 0x88: return Mov::Liftx88<V>(data, addr, len, il);
+    case 0xC8: return Mov::LiftxC8(data, addr, len, il);
+    case 0xD8: return Mov::LiftxD8(data, addr, len, il);
+    case 0xE8: return Mov::LiftxE8(data, addr, len, il);
+    case 0xE6: return Mov::LiftxE6(data, addr, len, il);
+    case 0xD4: return Mov::LiftxD4(data, addr, len, il);
+    case 0xC4: return Mov::LiftxC4(data, addr, len, il);
+    case 0x84: return Mov::Liftx84(data, addr, len, il);
+    case 0x94: return Mov::Liftx94(data, addr, len, il);
+    case 0xF2: return Mov::LiftxF2(data, addr, len, il);
+    case 0xF6: return Mov::LiftxF6(data, addr, len, il);
+    case 0xF1: return Movb::LiftxF1(data, addr, len, il);
+    case 0xE1: return Movb::LiftxE1(data, addr, len, il);
+    case 0xA9: return Movb::LiftxA9(data, addr, len, il);
+    case 0x99: return Movb::Liftx99<V>(data, addr, len, il);
+    case 0xB9: return Movb::LiftxB9(data, addr, len, il);
+    case 0x89: return Movb::Liftx89<V>(data, addr, len, il);
+    case 0xC9: return Movb::LiftxC9(data, addr, len, il);
+    case 0xD9: return Movb::LiftxD9(data, addr, len, il);
+    case 0xE9: return Movb::LiftxE9(data, addr, len, il);
+    case 0xE7: return Movb::LiftxE7(data, addr, len, il);
+    case 0xF4: return Movb::LiftxF4(data, addr, len, il);
+    case 0xE4: return Movb::LiftxE4(data, addr, len, il);
+    case 0xA4: return Movb::LiftxA4(data, addr, len, il);
+    case 0xB4: return Movb::LiftxB4(data, addr, len, il);
+    case 0xF3: return Movb::LiftxF3(data, addr, len, il);
+    case 0xF7: return Movb::LiftxF7(data, addr, len, il);
+    case 0xC0: return Movbz::LiftxC0(data, addr, len, il);
+    case 0xC2: return Movbz::LiftxC2(data, addr, len, il);
+    case 0xC5: return Movbz::LiftxC5(data, addr, len, il);
+    case 0xD0: return Movbs::LiftxD0(data, addr, len, il);
+    case 0xD2: return Movbs::LiftxD2(data, addr, len, il);
+    case 0xD5: return Movbs::LiftxD5(data, addr, len, il);
+    case 0x0A: return Bfldl::Lift(data, addr, len, il);
+    case 0x1A: return Bfldh::Lift(data, addr, len, il);
+    case 0x2A: return Bcmp::Lift(data, addr, len, il);
+    case 0x3A: return Bmovn::Lift(data, addr, len, il);
+    case 0x4A: return Bmov::Lift(data, addr, len, il);
+    case 0x5A: return Bor::Lift(data, addr, len, il);
+    case 0x6A: return Band::Lift(data, addr, len, il);
+    case 0x7A: return Bxor::Lift(data, addr, len, il);
+    case 0x80: return Cmpi1::Liftx80(data, addr, len, il);
+    case 0x82: return Cmpi1::Liftx82(data, addr, len, il);
+    case 0x86: return Cmpi1::Liftx86(data, addr, len, il);
+    case 0x90: return Cmpi2::Liftx90(data, addr, len, il);
+    case 0x92: return Cmpi2::Liftx92(data, addr, len, il);
+    case 0x96: return Cmpi2::Liftx96(data, addr, len, il);
+    case 0xA0: return Cmpd1::LiftxA0(data, addr, len, il);
+    case 0xA2: return Cmpd1::LiftxA2(data, addr, len, il);
+    case 0xA6: return Cmpd1::LiftxA6(data, addr, len, il);
+    case 0xB0: return Cmpd2::LiftxB0(data, addr, len, il);
+    case 0xB2: return Cmpd2::LiftxB2(data, addr, len, il);
+    case 0xB6: return Cmpd2::LiftxB6(data, addr, len, il);
+    default: return false;
+  }
+}
+
+struct Totals {
+  size_t checked = 0;
+  size_t skipped = 0;
+  size_t failed = 0;
+};
+
+// Operation names, in BNLowLevelILOperation order
+const char *const operation_names[] = {
+    "nop",     "set_reg",  "set_reg_split", "set_flag",  "load",
+    "store",   "push",     "pop",           "reg",       "reg_split",
+    "const",   "const_ptr", "flag",         "add",       "adc",
+    "sub",     "sbb",      "and",           "or",        "xor",
+    "lsl",     "lsr",      "asr",           "rol",       "ror",
+    "mul",     "mulu_dp",  "muls_dp",       "divu",      "divu_dp",
+    "divs",    "divs_dp",  "modu",          "modu_dp",   "mods",
+    "mods_dp", "neg",      "not",           "sx",        "zx",
+    "low_part", "jump",    "call",          "call_stack_adjust",
+    "tailcall", "ret",     "noret",         "if",        "goto",
+    "flag_group", "cmp_e", "cmp_ne",        "cmp_ugt",   "intrinsic",
+    "unimpl",  "unimpl_mem"};
+
+void DumpExpr(const BN::LowLevelILFunction &il, const BN::ExprId id) {
+  const BN::LowLevelILExpr &expr = il.exprs[id];
+  std::fprintf(stderr, "%s.%zu(", operation_names[expr.operation], expr.size);
+  for (int i = 0; i < OperandCount(expr.operation); i++) {
+    if (i > 0) std::fprintf(stderr, ", ");
+    if (IsExprOperand(expr.operation, i))
+      DumpExpr(il, expr.operands[i]);
+    else
+      std::fprintf(stderr, "0x%llx",
+                   static_cast<unsigned long long>(  // NOLINT
+                       expr.operands[i]));
+  }
+  std::fprintf(stderr, ")");
+}
+
+void Dump(const BN::LowLevelILFunction &il) {
+  for (const BN::ExprId insn : il.instructions) {
+    std::fprintf(stderr, "    ");
+    DumpExpr(il, insn);
+    std::fprintf(stderr, "\n");
+  }
+}
+
+void Report(const char *variant, const std::vector<uint8_t> &code,
+            const char *what, const uint32_t where, const uint64_t expected,
+            const uint64_t actual) {
+  std::fprintf(stderr, "%s:", variant);
+  for (const uint8_t byte : code) std::fprintf(stderr, " %02x", byte);
+  std::fprintf(stderr, ": %s 0x%x: emulator 0x%llx, IL 0x%llx\n", what, where,
+               static_cast<unsigned long long>(expected),  // NOLINT
+               static_cast<unsigned long long>(actual));   // NOLINT
+}
+
+template <C166::Variant V>
+void Check(const char *variant, const size_t cases, const uint32_t seed,
+           Totals &totals) {
+  static const std::vector<Form> forms = GetForms();
+  Generator gen(seed);
+  Emulator emu;
+
+  // Segment 0 after reset: the SFR reset values plus zeroed GPRs
+  const std::vector<uint8_t> reset(emu.GetMemory().begin(),
+                                   emu.GetMemory().begin() + 0x10000);
+  std::vector<uint8_t> image;
+
+  for (size_t n = 0; n < cases; n++) {
+    image = reset;
+    for (uint32_t addr = 0; addr < data_end; addr++) image[addr] = gen.rng();
+    for (uint32_t addr = bit_ram_start; addr < bit_ram_end; addr++)
+      image[addr] = gen.rng();
+    const auto set = [&image](const uint32_t addr, const uint16_t value) {
+      image[addr] = value & 0xFF;
+      image[addr + 1] = value >> 8;
+    };
+    const uint32_t cp = image[Sfr::CP] | image[Sfr::CP + 1] << 8;
+    for (uint8_t rw = 0; rw < 16; rw++)
+      set(cp + 2 * rw, gen.Below(2) ? gen.Pointer() : gen.Value());
+    set(Sfr::MDH, gen.Value());
+    set(Sfr::MDL, gen.Value());
+    set(Sfr::PSW, (image[Sfr::PSW] & ~0x1Fu) | gen.Below(0x20));
+
+    std::vector<uint8_t> code;
+    const unsigned count = 1 + gen.Below(4);
+    for (unsigned i = 0; i < count; i++) {
+      if (gen.Below(6) == 0)
+        gen.EmitLongArith(code);
+      else
+        gen.Emit(forms[gen.Below(forms.size())], code);
+    }
+
+    // Reference run
+    emu.Load(0, image.data(), image.size());
+    emu.Load(code_base, code.data(), code.size());
+    emu.SetPc(code_base);
+    Emulator::Status status;
+    emu.Run(code_base, code_base + code.size(), 2 * code.size(), status);
+    if (status != Emulator::StatusOk || emu.GetPc() != code_base + code.size()) {
+      Report(variant, code, "emulator stopped at", emu.GetPc(), status, 0);
+      totals.failed++;
+      continue;
+    }
+
+    // Lift the same bytes, offering at most max_instruction_length at a time
+    std::vector<uint8_t> padded = code;
+    padded.resize(code.size() + max_instruction_length);
+    BN::LowLevelILFunction il;
+    bool lifted = true;
+    for (size_t offset = 0; offset < code.size() && lifted;) {
+      size_t len = code.size() - offset;
+      if (len > max_instruction_length) len = max_instruction_length;
+      lifted = Lift<V>(padded.data() + offset, code_base + offset, len, il) &&
+               len > 0;
+      offset += len;
+    }
+    if (!lifted) {
+      Report(variant, code, "lifter failed", 0, 0, 0);
+      totals.failed++;
+      continue;
+    }
+
+    Evaluator eval(image, V.stack_pointer);
+    for (uint8_t rw = 0; rw < 16; rw++)
+      eval.SetRegister(rw, image[cp + 2 * rw] | image[cp + 2 * rw + 1] << 8);
+    for (const auto &[reg, sfr] :
+         {std::pair{Registers::MDH, Sfr::MDH}, {Registers::MDL, Sfr::MDL},
+          {Registers::DPP0, Sfr::DPP0}, {Registers::DPP1, Sfr::DPP1},
+          {Registers::DPP2, Sfr::DPP2}, {Registers::DPP3, Sfr::DPP3},
+          {Registers::CP, Sfr::CP}, {Registers::SP, Sfr::SP}})
+      eval.SetRegister(reg, image[sfr] | image[sfr + 1] << 8);
+    for (uint32_t flag = 0; flag < psw_flags; flag++)
+      eval.SetFlag(flag, (image[Sfr::PSW] >> flag) & 1);
+
+    try {
+      eval.Run(il);
+    } catch (const Unsupported &) {
+      totals.skipped++;
+      continue;
+    }
+
+    bool match = true;
+    for (uint8_t rw = 0; rw < 16; rw++) {
+      if (emu.GetRegister(rw) != eval.GetRegister(rw, 2)) {
+        Report(variant, code, "r", rw, emu.GetRegister(rw),
+               eval.GetRegister(rw, 2));
+        match = false;
+      }
+    }
+    for (const auto &[reg, sfr] :
+         {std::pair{Registers::MDH, Sfr::MDH}, {Registers::MDL, Sfr::MDL}}) {
+      if (emu.GetSfr(sfr) != eval.GetRegister(reg, 2)) {
+        Report(variant, code, "sfr", sfr, emu.GetSfr(sfr),
+               eval.GetRegister(reg, 2));
+        match = false;
+      }
+    }
+    const uint16_t psw = emu.GetSfr(Sfr::PSW);
+    for (uint32_t flag = 0; flag < psw_flags; flag++) {
+      bool value;
+      if (eval.GetFlag(flag, value) && value != ((psw >> flag) & 1)) {
+        Report(variant, code, "flag", flag, (psw >> flag) & 1, value);
+        match = false;
+      }
+    }
+    for (uint32_t addr = 0; addr < bit_ram_end && match; addr++) {
+      if (!IsDataAddress(addr)) continue;
+      if (emu.ReadByte(addr) != eval.ReadByte(addr)) {
+        Report(variant, code, "byte", addr, emu.ReadByte(addr),
+               eval.ReadByte(addr));
+        match = false;
+      }
+    }
+
+    if (match) {
+      totals.checked++;
+    } else {
+      Dump(il);
+      totals.failed++;
+    }
+  }
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t cases = (argc > 1) ? std::strtoul(argv[1], nullptr, 0) : 20000;
+  const uint32_t seed = (argc > 2) ? std::strtoul(argv[2], nullptr, 0) : 1;
+
+  // The emulator starts from the reset DPP layout; let the lifter know
+  Instruction::SetDefaultDpps(0, 1, 2, 3);
+
+  Totals totals;
+  Check<C166::Variants::TC>("c166tc", cases, seed, totals);
+  Check<C166::Variants::TVX>("c166tvx", cases, seed + 1, totals);
+
+  std::printf("%zu checked, %zu skipped, %zu failed\n", totals.checked,
+              totals.skipped, totals.failed);
+
+  // Most sequences must actually be compared for a pass to mean anything
+  if (totals.failed > 0 || totals.checked < totals.skipped) return 1;
+  return 0;
+}
@@ -0,0 +1,1085 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "emulator.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "conditions.h"
+#include "flags.h"
+#include "opcodes.h"
+#include "sfr.h"
+
+namespace C166 {
+
+// Instruction length is a function of the opcode byte alone
+static size_t Length(const uint8_t op) {
+  const uint8_t lo = op & 0xF;
+  const uint8_t hi = op >> 4;
+
+  // ALU reg, mem / mem, reg / reg, #data
+  if (hi <= 0x7 && lo >= 0x2 && lo <= 0x7) return 4;
+  // BFLDx, bit-bit operations, JB family, CALLA/CALLS/JMPA/JMPS
+  if (lo == 0xA) return 4;
+
+  switch (op) {
+    case Opcodes::CMPI1_RWN_MEM:
+    case Opcodes::CMPI1_RWN_DATA16:
+    case Opcodes::CMPI2_RWN_MEM:
+    case Opcodes::CMPI2_RWN_DATA16:
+    case Opcodes::CMPD1_RWN_MEM:
+    case Opcodes::CMPD1_RWN_DATA16:
+    case Opcodes::CMPD2_RWN_MEM:
+    case Opcodes::CMPD2_RWN_DATA16:
+    case Opcodes::MOV_REF_RWN_MEM:
+    case Opcodes::MOV_MEM_REF_RWN:
+    case Opcodes::MOVB_REF_RWN_MEM:
+    case Opcodes::MOVB_MEM_REF_RWN:
+    case Opcodes::MOV_REF_RWM_DATA16_RWN:
+    case Opcodes::MOV_RWN_REF_RWM_DATA16:
+    case Opcodes::MOVB_REF_RWM_DATA16_RBN:
+    case Opcodes::MOVB_RBN_REF_RWM_DATA16:
+    case Opcodes::MOVBZ_REG_MEM:
+    case Opcodes::MOVBZ_MEM_REG:
+    case Opcodes::MOVBS_REG_MEM:
+    case Opcodes::MOVBS_MEM_REG:
+    case Opcodes::SCXT_REG_DATA16:
+    case Opcodes::SCXT_REG_MEM:
+    case Opcodes::MOV_REG_DATA16:
+    case Opcodes::MOVB_REG_DATA8:
+    case Opcodes::MOV_REG_MEM:
+    case Opcodes::MOVB_REG_MEM:
+    case Opcodes::MOV_MEM_REG:
+    case Opcodes::MOVB_MEM_REG:
+    case Opcodes::PCALL:
+    case Opcodes::EXTPRS_PAG_SEG_COUNT:
+    case Opcodes::IDLE:
+    case Opcodes::PWRDN:
+    case Opcodes::SRST:
+    case Opcodes::DISWDT:
+    case Opcodes::SRVWDT:
+    case Opcodes::EINIT:
+      return 4;
+    default:
+      return 2;
+  }
+}
+
+Emulator::Emulator() : memory(memory_size) { Reset(); }
+
+// Clears memory and applies the SFR reset values
+void Emulator::Reset() {
+  std::memset(memory.data(), 0, memory.size());
+  segmented = true;
+  ip = 0;
+  ext_mode = ExtNone;
+  ext_value = 0;
+  ext_reg = false;
+  ext_count = 0;
+
+  SetSfr(Sfr::DPP0, 0);
+  SetSfr(Sfr::DPP1, 1);
+  SetSfr(Sfr::DPP2, 2);
+  SetSfr(Sfr::DPP3, 3);
+  SetSfr(Sfr::CP, 0xFC00);
+  SetSfr(Sfr::SP, 0xFC00);
+}
+
+void Emulator::Load(const uint32_t addr, const uint8_t *data,
+                    const size_t len) {
+  if (addr >= memory_size) return;
+  const size_t count = (len < memory_size - addr) ? len : memory_size - addr;
+  std::memcpy(memory.data() + addr, data, count);
+}
+
+uint8_t Emulator::ReadByte(const uint32_t addr) const {
+  return memory[addr & (memory_size - 1)];
+}
+
+uint16_t Emulator::ReadWord(const uint32_t addr) const {
+  const uint32_t even = addr & ~1u;
+  return ReadByte(even) | (ReadByte(even + 1) << 8u);
+}
+
+void Emulator::WriteByte(const uint32_t addr, const uint8_t value) {
+  memory[addr & (memory_size - 1)] = value;
+}
+
+void Emulator::WriteWord(const uint32_t addr, const uint16_t value) {
+  const uint32_t even = addr & ~1u;
+  WriteByte(even, value & 0xFF);
+  WriteByte(even + 1, value >> 8u);
+}
+
+uint16_t Emulator::GetSfr(const uint16_t sfr) const { return ReadWord(sfr); }
+
+void Emulator::SetSfr(const uint16_t sfr, const uint16_t value) {
+  WriteWord(sfr, value);
+}
+
+uint32_t Emulator::GprAddr(const uint8_t rw) const {
+  return GetSfr(Sfr::CP) + 2 * (rw & 0xF);
+}
+
+// RL0, RH0, RL1, ... map onto consecutive bytes of the register bank
+uint32_t Emulator::GprByteAddr(const uint8_t rb) const {
+  return GetSfr(Sfr::CP) + (rb & 0xF);
+}
+
+uint16_t Emulator::GetRegister(const uint8_t rw) const {
+  return ReadWord(GprAddr(rw));
+}
+
+void Emulator::SetRegister(const uint8_t rw, const uint16_t value) {
+  WriteWord(GprAddr(rw), value);
+}
+
+uint8_t Emulator::GetByteRegister(const uint8_t rb) const {
+  return ReadByte(GprByteAddr(rb));
+}
+
+void Emulator::SetByteRegister(const uint8_t rb, const uint8_t value) {
+  WriteByte(GprByteAddr(rb), value);
+}
+
+uint32_t Emulator::GetPc() const {
+  return (GetSfr(Sfr::CSP) & 0xFFu) << 16u | ip;
+}
+
+void Emulator::SetPc(const uint32_t pc) {
+  SetSfr(Sfr::CSP, (pc >> 16u) & 0xFF);
+  ip = pc & 0xFFFF;
+}
+
+uint32_t Emulator::TranslateData(const uint16_t addr) const {
+  if (ext_count > 0 && ext_mode == ExtPage)
+    return (ext_value << 14u) | (addr & 0x3FFF);
+  if (ext_count > 0 && ext_mode == ExtSegment)
+    return (ext_value << 16u) | addr;
+
+  const uint16_t dpp = GetSfr(Sfr::DPP0 + 2 * (addr >> 14u)) & 0x3FF;
+  return (dpp << 14u) | (addr & 0x3FFF);
+}
+
+// Short (8-bit) register addresses; EXTR moves the SFR window to the ESFRs
+uint32_t Emulator::RegAddr(const uint8_t reg) const {
+  if (reg >= 0xF0) return GprAddr(reg & 0xF);
+  return (ext_reg ? 0xF000 : 0xFE00) + 2 * reg;
+}
+
+uint32_t Emulator::RegByteAddr(const uint8_t reg) const {
+  if (reg >= 0xF0) return GprByteAddr(reg & 0xF);
+  return RegAddr(reg);
+}
+
+uint32_t Emulator::BitoffAddr(const uint8_t bitoff) const {
+  if (bitoff <= 0x7F) return 0xFD00 + 2 * bitoff;
+  if (bitoff <= 0xEF) return (ext_reg ? 0xF100 : 0xFF00) + 2 * (bitoff & 0x7F);
+  return GprAddr(bitoff & 0xF);
+}
+
+uint16_t Emulator::ReadData(const uint16_t addr, const bool byte) const {
+  const uint32_t phys = TranslateData(addr);
+  return byte ? ReadByte(phys) : ReadWord(phys);
+}
+
+void Emulator::WriteData(const uint16_t addr, const uint16_t value,
+                         const bool byte) {
+  const uint32_t phys = TranslateData(addr);
+  // CSP is read-only to data operations
+  if ((phys & ~1u) == Sfr::CSP) return;
+  if (byte)
+    WriteByte(phys, value & 0xFF);
+  else
+    WriteWord(phys, value);
+}
+
+bool Emulator::GetFlag(const uint8_t flag) const {
+  return (GetSfr(Sfr::PSW) >> flag) & 1u;
+}
+
+void Emulator::SetFlag(const uint8_t flag, const bool set) {
+  const uint16_t psw = GetSfr(Sfr::PSW);
+  SetSfr(Sfr::PSW, set ? (psw | (1u << flag)) : (psw & ~(1u << flag)));
+}
+
+void Emulator::SetResultFlags(const uint32_t result, const bool byte) {
+  const uint32_t mask = byte ? 0xFF : 0xFFFF;
+  const uint32_t sign = byte ? 0x80 : 0x8000;
+  SetFlag(Flags::FLAG_ZERO, (result & mask) == 0);
+  SetFlag(Flags::FLAG_NEGATIVE, (result & sign) != 0);
+}
+
+bool Emulator::TestCondition(const uint8_t cc) const {
+  const bool n = GetFlag(Flags::FLAG_NEGATIVE);
+  const bool c = GetFlag(Flags::FLAG_CARRY);
+  const bool v = GetFlag(Flags::FLAG_OVERFLOW);
+  const bool z = GetFlag(Flags::FLAG_ZERO);
+  const bool e = GetFlag(Flags::FLAG_E);
+
+  switch (cc) {
+    case Conditions::CC_UC:
+      return true;
+    case Conditions::CC_NET:
+      return !z && !e;
+    case Conditions::CC_Z:
+      return z;
+    case Conditions::CC_NZ:
+      return !z;
+    case Conditions::CC_V:
+      return v;
+    case Conditions::CC_NV:
+      return !v;
+    case Conditions::CC_N:
+      return n;
+    case Conditions::CC_NN:
+      return !n;
+    case Conditions::CC_ULT:
+      return c;
+    case Conditions::CC_UGE:
+      return !c;
+    case Conditions::CC_SGT:
+      return !(z || (n != v));
+    case Conditions::CC_SLE:
+      return z || (n != v);
+    case Conditions::CC_SLT:
+      return n != v;
+    case Conditions::CC_SGE:
+      return n == v;
+    case Conditions::CC_UGT:
+      return !(z || c);
+    case Conditions::CC_ULE:
+    default:
+      return z || c;
+  }
+}
+
+// The system stack always lives in segment 0 and bypasses the DPPs
+void Emulator::Push(const uint16_t value) {
+  const uint16_t sp = GetSfr(Sfr::SP) - 2;
+  SetSfr(Sfr::SP, sp);
+  WriteWord(sp, value);
+}
+
+uint16_t Emulator::Pop() {
+  const uint16_t sp = GetSfr(Sfr::SP);
+  SetSfr(Sfr::SP, sp + 2);
+  return ReadWord(sp);
+}
+
+// op is the high nibble of the ALU opcode: ADD, ADDC, SUB, SUBC, CMP, XOR,
+// AND, OR
+uint16_t Emulator::Alu(const uint8_t op, const uint16_t a, const uint16_t b,
+                       const bool byte) {
+  const uint32_t mask = byte ? 0xFF : 0xFFFF;
+  const uint32_t sign = byte ? 0x80 : 0x8000;
+  const uint32_t carry = (op == 0x1 || op == 0x3) && GetFlag(Flags::FLAG_CARRY);
+  const bool zero = GetFlag(Flags::FLAG_ZERO);
+  uint32_t r;
+
+  switch (op) {
+    case 0x0:
+    case 0x1:
+      r = (uint32_t)a + b + carry;
+      SetFlag(Flags::FLAG_CARRY, r > mask);
+      SetFlag(Flags::FLAG_OVERFLOW, (~(a ^ b) & (a ^ r) & sign) != 0);
+      break;
+    case 0x2:
+    case 0x3:
+    case 0x4:
+      r = (uint32_t)a - b - carry;
+      SetFlag(Flags::FLAG_CARRY, (uint32_t)a < (uint32_t)b + carry);
+      SetFlag(Flags::FLAG_OVERFLOW, ((a ^ b) & (a ^ r) & sign) != 0);
+      break;
+    default:
+      r = (op == 0x5) ? (a ^ b) : (op == 0x6) ? (a & b) : (a | b);
+      SetFlag(Flags::FLAG_CARRY, false);
+      SetFlag(Flags::FLAG_OVERFLOW, false);
+      break;
+  }
+
+  r &= mask;
+  SetFlag(Flags::FLAG_E, b == sign);
+  SetResultFlags(r, byte);
+  // ADDC/SUBC only keep Z set if the previous result was also zero
+  if (op == 0x1 || op == 0x3)
+    SetFlag(Flags::FLAG_ZERO, r == 0 && zero);
+  return r;
+}
+
+Emulator::Status Emulator::StepAlu(const uint8_t *data) {
+  const uint8_t op = data[0] >> 4u;
+  const bool byte = data[0] & 1u;
+
+  switch (data[0] & 0xE) {
+    case 0x0: {  // Rn, Rm
+      const auto n = Formats::Get<Formats::Rr::n>(data);
+      const auto m = Formats::Get<Formats::Rr::m>(data);
+      if (byte) {
+        const auto r = Alu(op, GetByteRegister(n), GetByteRegister(m), true);
+        if (op != 0x4) SetByteRegister(n, r);
+      } else {
+        const auto r = Alu(op, GetRegister(n), GetRegister(m), false);
+        if (op != 0x4) SetRegister(n, r);
+      }
+      break;
+    }
+    case 0x2:    // reg, mem
+    case 0x6: {  // reg, #data
+      const auto reg = Formats::Get<Formats::RegMem::reg>(data);
+      const uint32_t dst = byte ? RegByteAddr(reg) : RegAddr(reg);
+      const uint16_t a = byte ? ReadByte(dst) : ReadWord(dst);
+      uint16_t b;
+      if ((data[0] & 0xE) == 0x2)
+        b = ReadData(Formats::Get<Formats::RegMem::mem>(data), byte);
+      else if (byte)
+        b = Formats::Get<Formats::RegData::data8>(data);
+      else
+        b = Formats::Get<Formats::RegData::data16>(data);
+
+      const auto r = Alu(op, a, b, byte);
+      if (op == 0x4) break;
+      if (byte)
+        WriteByte(dst, r);
+      else
+        WriteWord(dst, r);
+      break;
+    }
+    case 0x4: {  // mem, reg
+      if (op == 0x4) return StatusInvalid;
+      const auto reg = Formats::Get<Formats::RegMem::reg>(data);
+      const auto mem = Formats::Get<Formats::RegMem::mem>(data);
+      const uint16_t b = byte ? ReadByte(RegByteAddr(reg))
+                              : ReadWord(RegAddr(reg));
+      WriteData(mem, Alu(op, ReadData(mem, byte), b, byte), byte);
+      break;
+    }
+    case 0x8: {  // Rn, [Rwi] / [Rwi+] / #data3
+      const auto n = Formats::Get<Formats::Rr::n>(data);
+      const auto scode = (data[1] & 0xC) >> 2u;
+      const uint16_t a = byte ? GetByteRegister(n) : GetRegister(n);
+      uint16_t b;
+      if (scode & 0b10) {
+        b = ReadData(GetRegister(Formats::Get<Formats::Rr::rwi>(data)), byte);
+      } else {
+        b = Formats::Get<Formats::Rr::data3>(data);
+      }
+
+      // [Rwi+] increments after the result is written, so it wins when Rwi
+      // is also the destination
+      const auto r = Alu(op, a, b, byte);
+      if (op != 0x4) {
+        if (byte)
+          SetByteRegister(n, r);
+        else
+          SetRegister(n, r);
+      }
+      if (scode == 0b11) {
+        const auto rwi = Formats::Get<Formats::Rr::rwi>(data);
+        SetRegister(rwi, GetRegister(rwi) + (byte ? 1 : 2));
+      }
+      break;
+    }
+    default:
+      return StatusInvalid;
+  }
+
+  return StatusOk;
+}
+
+Emulator::Status Emulator::StepMov(const uint8_t *data) {
+  const auto n = Formats::Get<Formats::Rr::n>(data);
+  const auto m = Formats::Get<Formats::Rr::m>(data);
+  const auto reg = Formats::Get<Formats::RegMem::reg>(data);
+  const auto mem = Formats::Get<Formats::RegMem::mem>(data);
+  const auto data16 = Formats::Get<Formats::RegData::data16>(data);
+  bool byte = data[0] & 1u;
+  bool extend = false;
+  uint16_t value;
+
+  // Odd opcodes are byte moves, except for the MOVBZ/MOVBS mem, reg forms; a
+  // few MOVB encodings are even
+  switch (data[0]) {
+    case Opcodes::MOVBZ_RWN_RBM:
+    case Opcodes::MOVBZ_REG_MEM:
+    case Opcodes::MOVBZ_MEM_REG:
+    case Opcodes::MOVBS_RWN_RBM:
+    case Opcodes::MOVBS_REG_MEM:
+    case Opcodes::MOVBS_MEM_REG:
+      extend = true;
+      byte = false;
+      break;
+    case Opcodes::MOVB_RBN_REF_RWM_DATA16:
+    case Opcodes::MOVB_REF_RWM_DATA16_RBN:
+    case Opcodes::MOVB_REF_RWN_MEM:
+    case Opcodes::MOVB_MEM_REF_RWN:
+      byte = true;
+      break;
+    default:
+      break;
+  }
+
+  switch (data[0]) {
+    case Opcodes::MOV_RWN_RWM:
+      value = GetRegister(m);
+      SetRegister(n, value);
+      break;
+    case Opcodes::MOVB_RBN_RBM:
+      value = GetByteRegister(m);
+      SetByteRegister(n, value);
+      break;
+    case Opcodes::MOV_RWN_DATA4:
+    case Opcodes::MOVB_RBN_DATA4:
+      value = Formats::Get<Formats::Rr::data4>(data);
+      if (byte)
+        SetByteRegister(m, value);
+      else
+        SetRegister(m, value);
+      break;
+    case Opcodes::MOV_REG_DATA16:
+      value = data16;
+      WriteWord(RegAddr(reg), value);
+      break;
+    case Opcodes::MOVB_REG_DATA8:
+      value = Formats::Get<Formats::RegData::data8>(data);
+      WriteByte(RegByteAddr(reg), value);
+      break;
+    case Opcodes::MOV_REG_MEM:
+      value = ReadData(mem, false);
+      WriteWord(RegAddr(reg), value);
+      break;
+    case Opcodes::MOVB_REG_MEM:
+      value = ReadData(mem, true);
+      WriteByte(RegByteAddr(reg), value);
+      break;
+    case Opcodes::MOV_MEM_REG:
+      value = ReadWord(RegAddr(reg));
+      WriteData(mem, value, false);
+      break;
+    case Opcodes::MOVB_MEM_REG:
+      value = ReadByte(RegByteAddr(reg));
+      WriteData(mem, value, true);
+      break;
+    case Opcodes::MOV_RWN_REF_RWM:
+    case Opcodes::MOVB_RBN_REF_RWM:
+    case Opcodes::MOV_RWN_REF_POST_INC_RWM:
+    case Opcodes::MOVB_RBN_REF_POST_INC_RWM: {
+      // The steps run in the manual's order, so with n == m the increment
+      // applies to the loaded value and the decrement to the stored one
+      value = ReadData(GetRegister(m), byte);
+      if (byte)
+        SetByteRegister(n, value);
+      else
+        SetRegister(n, value);
+      if ((data[0] & 0xF0) == 0x90)
+        SetRegister(m, GetRegister(m) + (byte ? 1 : 2));
+      break;
+    }
+    case Opcodes::MOV_REF_RWM_RWN:
+    case Opcodes::MOVB_REF_RWM_RBN:
+    case Opcodes::MOV_REF_PRE_DEC_RWM_RWN:
+    case Opcodes::MOVB_REF_PRE_DEC_RWM_RBN: {
+      uint16_t ptr = GetRegister(m);
+      if ((data[0] & 0xF0) == 0x80) {
+        ptr -= byte ? 1 : 2;
+        SetRegister(m, ptr);
+      }
+      value = byte ? GetByteRegister(n) : GetRegister(n);
+      WriteData(ptr, value, byte);
+      break;
+    }
+    case Opcodes::MOV_REF_RWN_REF_RWM:
+    case Opcodes::MOVB_REF_RWN_REF_RWM:
+    case Opcodes::MOV_REF_POST_INC_RWN_REF_RWM:
+    case Opcodes::MOVB_REF_POST_INC_RWN_REF_RWM:
+    case Opcodes::MOV_REF_RWN_REF_POST_INC_RWM:
+    case Opcodes::MOVB_REF_RWN_REF_POST_INC_RWM: {
+      const uint16_t dst = GetRegister(n);
+      const uint16_t src = GetRegister(m);
+      const uint16_t step = byte ? 1 : 2;
+      value = ReadData(src, byte);
+      WriteData(dst, value, byte);
+      if ((data[0] & 0xF0) == 0xD0) SetRegister(n, dst + step);
+      if ((data[0] & 0xF0) == 0xE0) SetRegister(m, src + step);
+      break;
+    }
+    case Opcodes::MOV_RWN_REF_RWM_DATA16:
+    case Opcodes::MOVB_RBN_REF_RWM_DATA16:
+      value = ReadData(GetRegister(m) + data16, byte);
+      if (byte)
+        SetByteRegister(n, value);
+      else
+        SetRegister(n, value);
+      break;
+    case Opcodes::MOV_REF_RWM_DATA16_RWN:
+    case Opcodes::MOVB_REF_RWM_DATA16_RBN:
+      value = byte ? GetByteRegister(n) : GetRegister(n);
+      WriteData(GetRegister(m) + data16, value, byte);
+      break;
+    case Opcodes::MOV_REF_RWN_MEM:
+    case Opcodes::MOVB_REF_RWN_MEM:
+      value = ReadData(mem, byte);
+      WriteData(GetRegister(m), value, byte);
+      break;
+    case Opcodes::MOV_MEM_REF_RWN:
+    case Opcodes::MOVB_MEM_REF_RWN:
+      value = ReadData(GetRegister(m), byte);
+      WriteData(mem, value, byte);
+      break;
+    case Opcodes::MOVBZ_RWN_RBM:
+    case Opcodes::MOVBS_RWN_RBM:
+      value = GetByteRegister(n);
+      SetRegister(m, (data[0] == Opcodes::MOVBS_RWN_RBM)
+                         ? (uint16_t)(int16_t)(int8_t)value
+                         : value);
+      break;
+    case Opcodes::MOVBZ_REG_MEM:
+    case Opcodes::MOVBS_REG_MEM:
+      value = ReadData(mem, true);
+      WriteWord(RegAddr(reg), (data[0] == Opcodes::MOVBS_REG_MEM)
+                                  ? (uint16_t)(int16_t)(int8_t)value
+                                  : value);
+      break;
+    case Opcodes::MOVBZ_MEM_REG:
+    case Opcodes::MOVBS_MEM_REG:
+      value = ReadByte(RegByteAddr(reg));
+      WriteData(mem,
+                (data[0] == Opcodes::MOVBS_MEM_REG)
+                    ? (uint16_t)(int16_t)(int8_t)value
+                    : value,
+                false);
+      break;
+    default:
+      return StatusInvalid;
+  }
+
+  // MOVBZ/MOVBS flag the byte source; MOVBZ never sets N
+  const bool flag_byte = byte || extend;
+  SetFlag(Flags::FLAG_E, value == (flag_byte ? 0x80 : 0x8000));
+  SetResultFlags(value, flag_byte);
+  if (extend && (data[0] & 0xF0) == 0xC0)
+    SetFlag(Flags::FLAG_NEGATIVE, false);
+
+  return StatusOk;
+}
+
+// BCLR/BSET, BFLDL/BFLDH, bit-bit operations and the JB family
+Emulator::Status Emulator::StepBit(const uint8_t *data) {
+  const uint8_t op = data[0];
+
+  if ((op & 0xF) == 0xE || (op & 0xF) == 0xF) {
+    const uint32_t addr =
+        BitoffAddr(Formats::Get<Formats::BitShort::bitoff>(data));
+    const uint16_t bit = 1u << Formats::Get<Formats::BitShort::bitpos>(data);
+    const uint16_t word = ReadWord(addr);
+    // Flags reflect the previous state of the bit; write back afterwards in
+    // case the bit lives in PSW
+    SetFlag(Flags::FLAG_E, false);
+    SetFlag(Flags::FLAG_ZERO, !(word & bit));
+    SetFlag(Flags::FLAG_OVERFLOW, false);
+    SetFlag(Flags::FLAG_CARRY, false);
+    SetFlag(Flags::FLAG_NEGATIVE, word & bit);
+    WriteWord(addr, (op & 0xF) == 0xF ? (ReadWord(addr) | bit)
+                                      : (ReadWord(addr) & ~bit));
+    return StatusOk;
+  }
+
+  if (op == Opcodes::BFLDL || op == Opcodes::BFLDH) {
+    const uint32_t addr = BitoffAddr(data[1]);
+    const uint16_t mask =
+        (op == Opcodes::BFLDL) ? data[2] : (uint16_t)(data[3] << 8u);
+    const uint16_t value =
+        (op == Opcodes::BFLDL) ? data[3] : (uint16_t)(data[2] << 8u);
+    const uint16_t result = (ReadWord(addr) & ~mask) | (value & mask);
+    SetFlag(Flags::FLAG_E, false);
+    SetFlag(Flags::FLAG_OVERFLOW, false);
+    SetFlag(Flags::FLAG_CARRY, false);
+    SetResultFlags(result, false);
+    WriteWord(addr, result);
+    return StatusOk;
+  }
+
+  if (op >= Opcodes::JB && op <= Opcodes::JNBS) {
+    const uint32_t addr =
+        BitoffAddr(Formats::Get<Formats::BitRel::bitoff>(data));
+    const uint16_t bit = 1u << Formats::Get<Formats::BitRel::bitpos>(data);
+    const auto rel = (int8_t)Formats::Get<Formats::BitRel::rel>(data);
+    const bool set = ReadWord(addr) & bit;
+    const bool jump_if_set = op == Opcodes::JB || op == Opcodes::JBC;
+
+    if (op == Opcodes::JBC || op == Opcodes::JNBS) {
+      SetFlag(Flags::FLAG_E, false);
+      SetFlag(Flags::FLAG_ZERO, !set);
+      SetFlag(Flags::FLAG_OVERFLOW, false);
+      SetFlag(Flags::FLAG_CARRY, false);
+      SetFlag(Flags::FLAG_NEGATIVE, set);
+    }
+
+    if (set == jump_if_set) {
+      if (op == Opcodes::JBC) WriteWord(addr, ReadWord(addr) & ~bit);
+      if (op == Opcodes::JNBS) WriteWord(addr, ReadWord(addr) | bit);
+      ip += 2 * rel;
+    }
+    return StatusOk;
+  }
+
+  // BAND/BCMP/BMOV/BMOVN/BOR/BXOR bitaddrZ.z, bitaddrQ.q
+  const uint32_t dst_addr = BitoffAddr(Formats::Get<Formats::BitBit::zz>(data));
+  const uint32_t src_addr = BitoffAddr(Formats::Get<Formats::BitBit::qq>(data));
+  const uint16_t dst_bit = 1u << Formats::Get<Formats::BitBit::z>(data);
+  const uint16_t src_bit = 1u << Formats::Get<Formats::BitBit::q>(data);
+  const bool a = ReadWord(dst_addr) & dst_bit;
+  const bool b = ReadWord(src_addr) & src_bit;
+  bool result;
+
+  switch (op) {
+    case Opcodes::BAND:
+      result = a && b;
+      break;
+    case Opcodes::BOR:
+      result = a || b;
+      break;
+    case Opcodes::BXOR:
+      result = a != b;
+      break;
+    case Opcodes::BMOV:
+      result = b;
+      break;
+    case Opcodes::BMOVN:
+      result = !b;
+      break;
+    case Opcodes::BCMP:
+      result = a;
+      break;
+    default:
+      return StatusInvalid;
+  }
+
+  SetFlag(Flags::FLAG_E, false);
+  SetFlag(Flags::FLAG_ZERO, !(a || b));
+  SetFlag(Flags::FLAG_OVERFLOW, a || b);
+  SetFlag(Flags::FLAG_CARRY, a && b);
+  SetFlag(Flags::FLAG_NEGATIVE, a != b);
+  if (op != Opcodes::BCMP) {
+    const uint16_t word = ReadWord(dst_addr);
+    WriteWord(dst_addr, result ? (word | dst_bit) : (word & ~dst_bit));
+  }
+
+  return StatusOk;
+}
+
+// ROL/ROR/SHL/SHR/ASHR Rwn, Rwm and Rwn, #data4
+Emulator::Status Emulator::StepShift(const uint8_t *data) {
+  const uint8_t op = data[0];
+  const bool immediate = op & 0x10;
+  const auto n = immediate ? Formats::Get<Formats::Rr::m>(data)
+                           : Formats::Get<Formats::Rr::n>(data);
+  const unsigned count =
+      immediate ? Formats::Get<Formats::Rr::data4>(data)
+                : GetRegister(Formats::Get<Formats::Rr::m>(data)) & 0xFu;
+  const uint16_t a = GetRegister(n);
+  uint16_t r = a;
+  bool carry = false;
+  bool overflow = false;
+
+  if (count > 0) {
+    switch (op & 0xE0) {
+      case 0x00:  // ROL
+        r = (a << count) | (a >> (16 - count));
+        carry = r & 1u;
+        break;
+      case 0x20:  // ROR
+        r = (a >> count) | (a << (16 - count));
+        carry = (a >> (count - 1)) & 1u;
+        overflow = (a & ((1u << (count - 1)) - 1)) != 0;
+        break;
+      case 0x40:  // SHL
+        r = a << count;
+        carry = (a >> (16 - count)) & 1u;
+        break;
+      case 0x60:  // SHR
+        r = a >> count;
+        carry = (a >> (count - 1)) & 1u;
+        overflow = (a & ((1u << (count - 1)) - 1)) != 0;
+        break;
+      case 0xA0:  // ASHR
+        r = (int16_t)a >> count;
+        carry = (a >> (count - 1)) & 1u;
+        overflow = (a & ((1u << (count - 1)) - 1)) != 0;
+        break;
+      default:
+        return StatusInvalid;
+    }
+  }
+
+  SetRegister(n, r);
+  SetFlag(Flags::FLAG_E, false);
+  SetFlag(Flags::FLAG_CARRY, carry);
+  SetFlag(Flags::FLAG_OVERFLOW, overflow);
+  SetResultFlags(r, false);
+
+  return StatusOk;
+}
+
+// MUL/MULU Rwn, Rwm and DIV/DIVU/DIVL/DIVLU Rwn through MDH/MDL
+Emulator::Status Emulator::StepMulDiv(const uint8_t *data) {
+  const uint8_t op = data[0];
+  const auto n = Formats::Get<Formats::Rr::n>(data);
+  const auto m = Formats::Get<Formats::Rr::m>(data);
+  uint32_t result;
+  bool overflow;
+
+  if (op == Opcodes::MUL || op == Opcodes::MULU) {
+    if (op == Opcodes::MUL) {
+      const int32_t product =
+          (int16_t)GetRegister(n) * (int16_t)GetRegister(m);
+      result = product;
+      overflow = product != (int16_t)product;
+    } else {
+      result = (uint32_t)GetRegister(n) * GetRegister(m);
+      overflow = result > 0xFFFF;
+    }
+    SetSfr(Sfr::MDH, result >> 16u);
+    SetSfr(Sfr::MDL, result & 0xFFFF);
+    SetFlag(Flags::FLAG_ZERO, result == 0);
+    SetFlag(Flags::FLAG_NEGATIVE, result & 0x80000000u);
+  } else {
+    const uint16_t divisor = GetRegister(n);
+    const bool wide = op == Opcodes::DIVL || op == Opcodes::DIVLU;
+    const bool is_signed = op == Opcodes::DIV || op == Opcodes::DIVL;
+    const uint32_t md = (GetSfr(Sfr::MDH) << 16u) | GetSfr(Sfr::MDL);
+    overflow = divisor == 0;
+
+    if (!overflow) {
+      uint32_t quotient, remainder;
+      if (is_signed) {
+        // 64 bits keep INT32_MIN / -1 defined; it is flagged as an overflow
+        // like any other quotient that does not fit in 16 bits
+        const int64_t dividend =
+            wide ? (int32_t)md : (int16_t)GetSfr(Sfr::MDL);
+        const int64_t q = dividend / (int16_t)divisor;
+        quotient = (uint32_t)q;
+        remainder = (uint32_t)(dividend - q * (int16_t)divisor);
+        overflow = q != (int16_t)q;
+      } else {
+        const uint32_t dividend = wide ? md : GetSfr(Sfr::MDL);
+        quotient = dividend / divisor;
+        remainder = dividend % divisor;
+        overflow = quotient > 0xFFFF;
+      }
+      SetSfr(Sfr::MDL, quotient & 0xFFFF);
+      SetSfr(Sfr::MDH, remainder & 0xFFFF);
+    }
+    result = GetSfr(Sfr::MDL);
+    SetResultFlags(result, false);
+  }
+
+  SetFlag(Flags::FLAG_E, false);
+  SetFlag(Flags::FLAG_CARRY, false);
+  SetFlag(Flags::FLAG_OVERFLOW, overflow);
+
+  return StatusOk;
+}
+
+// Jumps, calls and returns. ip already points past the instruction.
+Emulator::Status Emulator::StepBranch(const uint8_t *data) {
+  const uint8_t op = data[0];
+  const auto caddr = Formats::Get<Formats::CondCaddr::caddr>(data);
+
+  if ((op & 0xF) == 0xD) {  // JMPR cc, rel
+    if (TestCondition(op >> 4u)) ip += 2 * (int8_t)data[1];
+    return StatusOk;
+  }
+
+  switch (op) {
+    case Opcodes::JMPA:
+      if (TestCondition(Formats::Get<Formats::CondCaddr::cc>(data)))
+        ip = caddr;
+      break;
+    case Opcodes::JMPI:
+      if (TestCondition(Formats::Get<Formats::Rr::n>(data)))
+        ip = GetRegister(Formats::Get<Formats::Rr::m>(data));
+      break;
+    case Opcodes::JMPS:
+      SetSfr(Sfr::CSP, Formats::Get<Formats::SegCaddr::seg>(data));
+      ip = caddr;
+      break;
+    case Opcodes::CALLA:
+      if (TestCondition(Formats::Get<Formats::CondCaddr::cc>(data))) {
+        Push(ip);
+        ip = caddr;
+      }
+      break;
+    case Opcodes::CALLI:
+      if (TestCondition(Formats::Get<Formats::Rr::n>(data))) {
+        Push(ip);
+        ip = GetRegister(Formats::Get<Formats::Rr::m>(data));
+      }
+      break;
+    case Opcodes::CALLR:
+      Push(ip);
+      ip += 2 * (int8_t)data[1];
+      break;
+    case Opcodes::CALLS:
+      Push(GetSfr(Sfr::CSP));
+      Push(ip);
+      SetSfr(Sfr::CSP, Formats::Get<Formats::SegCaddr::seg>(data));
+      ip = caddr;
+      break;
+    case Opcodes::PCALL: {
+      const uint16_t value = ReadWord(RegAddr(data[1]));
+      Push(value);
+      SetFlag(Flags::FLAG_E, value == 0x8000);
+      SetResultFlags(value, false);
+      Push(ip);
+      ip = caddr;
+      break;
+    }
+    case Opcodes::TRAP:
+      // The vector table is in segment 0 in either mode; CSP is only saved
+      // when segmentation is enabled
+      Push(GetSfr(Sfr::PSW));
+      if (segmented) Push(GetSfr(Sfr::CSP));
+      SetSfr(Sfr::CSP, 0);
+      Push(ip);
+      ip = (data[1] >> 1u) * 4;
+      break;
+    case Opcodes::RET:
+      ip = Pop();
+      break;
+    case Opcodes::RETS:
+      ip = Pop();
+      SetSfr(Sfr::CSP, Pop());
+      break;
+    case Opcodes::RETP: {
+      ip = Pop();
+      const uint16_t value = Pop();
+      WriteWord(RegAddr(data[1]), value);
+      SetFlag(Flags::FLAG_E, value == 0x8000);
+      SetResultFlags(value, false);
+      break;
+    }
+    case Opcodes::RETI:
+      ip = Pop();
+      if (segmented) SetSfr(Sfr::CSP, Pop());
+      SetSfr(Sfr::PSW, Pop());
+      break;
+    default:
+      return StatusInvalid;
+  }
+
+  return StatusOk;
+}
+
+Emulator::Status Emulator::Step() {
+  uint8_t data[4];
+  const uint32_t pc = GetPc();
+  for (size_t i = 0; i < sizeof(data); i++) data[i] = ReadByte(pc + i);
+
+  const uint8_t op = data[0];
+  const uint8_t lo = op & 0xF;
+  const uint8_t hi = op >> 4u;
+  const uint16_t start = ip;
+  Status status = StatusOk;
+
+  // Advance first so that relative branches and calls see the next address
+  ip += Length(op);
+
+  if (hi <= 0x7 && lo <= 0x9) {
+    status = StepAlu(data);
+  } else if (lo == 0xE || lo == 0xF || (lo == 0xA && hi <= 0xB)) {
+    status = StepBit(data);
+  } else if (lo == 0xD || (lo == 0xA && hi >= 0xC)) {
+    status = StepBranch(data);
+  } else {
+    switch (op) {
+      case Opcodes::ROL_RWN_RWM:
+      case Opcodes::ROL_RWN_DATA4:
+      case Opcodes::ROR_RWN_RWM:
+      case Opcodes::ROR_RWN_DATA4:
+      case Opcodes::SHL_RWN_RWM:
+      case Opcodes::SHL_RWN_DATA4:
+      case Opcodes::SHR_RWN_RWM:
+      case Opcodes::SHR_RWN_DATA4:
+      case Opcodes::ASHR_RWN_RWM:
+      case Opcodes::ASHR_RWN_DATA4:
+        status = StepShift(data);
+        break;
+      case Opcodes::MUL:
+      case Opcodes::MULU:
+      case Opcodes::DIV:
+      case Opcodes::DIVU:
+      case Opcodes::DIVL:
+      case Opcodes::DIVLU:
+        status = StepMulDiv(data);
+        break;
+      case Opcodes::JMPI:
+      case Opcodes::CALLI:
+      case Opcodes::CALLR:
+      case Opcodes::PCALL:
+      case Opcodes::TRAP:
+      case Opcodes::RET:
+      case Opcodes::RETS:
+      case Opcodes::RETP:
+      case Opcodes::RETI:
+        status = StepBranch(data);
+        break;
+      case Opcodes::CMPI1_RWN_DATA4:
+      case Opcodes::CMPI1_RWN_MEM:
+      case Opcodes::CMPI1_RWN_DATA16:
+      case Opcodes::CMPI2_RWN_DATA4:
+      case Opcodes::CMPI2_RWN_MEM:
+      case Opcodes::CMPI2_RWN_DATA16:
+      case Opcodes::CMPD1_RWN_DATA4:
+      case Opcodes::CMPD1_RWN_MEM:
+      case Opcodes::CMPD1_RWN_DATA16:
+      case Opcodes::CMPD2_RWN_DATA4:
+      case Opcodes::CMPD2_RWN_MEM:
+      case Opcodes::CMPD2_RWN_DATA16: {
+        static constexpr int16_t step[] = {1, 2, -1, -2};
+        const auto rwn = Formats::Get<Formats::Rr::m>(data);
+        uint16_t b;
+        if (lo == 0x0)
+          b = Formats::Get<Formats::Rr::data4>(data);
+        else if (lo == 0x2)
+          b = ReadData(Formats::Get<Formats::RegMem::mem>(data), false);
+        else
+          b = Formats::Get<Formats::RegData::data16>(data);
+        const uint16_t a = GetRegister(rwn);
+        Alu(0x4, a, b, false);
+        SetRegister(rwn, a + step[hi - 0x8]);
+        break;
+      }
+      case Opcodes::CPL:
+      case Opcodes::CPLB: {
+        const bool byte = op == Opcodes::CPLB;
+        const auto n = Formats::Get<Formats::Rr::n>(data);
+        const uint16_t a = byte ? GetByteRegister(n) : GetRegister(n);
+        const uint16_t r = ~a & (byte ? 0xFF : 0xFFFF);
+        if (byte)
+          SetByteRegister(n, r);
+        else
+          SetRegister(n, r);
+        SetFlag(Flags::FLAG_E, a == (byte ? 0x80 : 0x8000));
+        SetResultFlags(r, byte);
+        break;
+      }
+      case Opcodes::NEG:
+      case Opcodes::NEGB: {
+        const bool byte = op == Opcodes::NEGB;
+        const auto n = Formats::Get<Formats::Rr::n>(data);
+        if (byte)
+          SetByteRegister(n, Alu(0x2, 0, GetByteRegister(n), true));
+        else
+          SetRegister(n, Alu(0x2, 0, GetRegister(n), false));
+        break;
+      }
+      case Opcodes::PRIOR: {
+        const uint16_t a = GetRegister(Formats::Get<Formats::Rr::m>(data));
+        uint16_t count = 0;
+        while (a != 0 && !((a << count) & 0x8000)) count++;
+        SetRegister(Formats::Get<Formats::Rr::n>(data), count);
+        SetFlag(Flags::FLAG_E, false);
+        SetFlag(Flags::FLAG_ZERO, a == 0);
+        SetFlag(Flags::FLAG_OVERFLOW, false);
+        SetFlag(Flags::FLAG_CARRY, false);
+        SetFlag(Flags::FLAG_NEGATIVE, false);
+        break;
+      }
+      case Opcodes::PUSH:
+      case Opcodes::POP: {
+        const uint32_t addr = RegAddr(data[1]);
+        uint16_t value;
+        if (op == Opcodes::PUSH) {
+          value = ReadWord(addr);
+          Push(value);
+        } else {
+          value = Pop();
+          WriteWord(addr, value);
+        }
+        SetFlag(Flags::FLAG_E, value == 0x8000);
+        SetResultFlags(value, false);
+        break;
+      }
+      case Opcodes::SCXT_REG_DATA16:
+      case Opcodes::SCXT_REG_MEM: {
+        const uint32_t addr = RegAddr(data[1]);
+        const uint16_t value =
+            (op == Opcodes::SCXT_REG_MEM)
+                ? ReadData(Formats::Get<Formats::RegMem::mem>(data), false)
+                : Formats::Get<Formats::RegData::data16>(data);
+        Push(ReadWord(addr));
+        WriteWord(addr, value);
+        break;
+      }
+      case Opcodes::EXTR_ATOMIC:
+      case Opcodes::EXTPRS_PAG_SEG_COUNT:
+      case Opcodes::EXTPRS_RWM_COUNT: {
+        const uint8_t count = ((data[1] & 0b00110000) >> 4u) + 1;
+        const uint8_t subop = data[1] >> 6u;
+        if (op == Opcodes::EXTR_ATOMIC) {
+          if (subop != 0b00 && subop != 0b10) {
+            status = StatusInvalid;
+            break;
+          }
+          ext_mode = ExtNone;
+          ext_reg = subop == 0b10;
+        } else {
+          const uint16_t value =
+              (op == Opcodes::EXTPRS_RWM_COUNT)
+                  ? GetRegister(Formats::Get<Formats::Rr::m>(data))
+                  : Formats::Get<Formats::RegData::data16>(data);
+          ext_mode = (subop & 0b01) ? ExtPage : ExtSegment;
+          ext_value = (ext_mode == ExtPage) ? (value & 0x3FF) : (value & 0xFF);
+          ext_reg = subop & 0b10;
+        }
+        // Count this instruction too; it is retired below
+        ext_count = count + 1;
+        break;
+      }
+      case Opcodes::NOP:
+      case Opcodes::EINIT:
+      case Opcodes::DISWDT:
+      case Opcodes::SRVWDT:
+        break;
+      case Opcodes::IDLE:
+      case Opcodes::PWRDN:
+      case Opcodes::SRST:
+        status = StatusHalted;
+        break;
+      default:
+        // Everything left in x0-x9 of the upper half is a MOV variant
+        status = (hi >= 0x8 && lo <= 0x9) ? StepMov(data) : StatusInvalid;
+        break;
+    }
+  }
+
+  if (status == StatusInvalid) {
+    ip = start;
+    return status;
+  }
+
+  if (ext_count > 0 && --ext_count == 0) {
+    ext_mode = ExtNone;
+    ext_reg = false;
+  }
+  return status;
+}
+
+size_t Emulator::Run(const uint32_t start, const uint32_t end,
+                     const size_t max_steps, Status &status) {
+  size_t steps = 0;
+  status = StatusOk;
+  while (steps < max_steps) {
+    const uint32_t pc = GetPc();
+    if (pc < start || pc >= end) break;
+
+    status = Step();
+    if (status == StatusInvalid) break;
+    steps++;
+    if (status == StatusHalted) break;
+  }
+  return steps;
+}
+}  // namespace C166
@@ -0,0 +1,96 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef TESTS_EMULATOR_H_
+#define TESTS_EMULATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace C166 {
+
+// Reference interpreter for the C166/ST10 instruction set over a flat 16 MB
+// physical address space. GPRs live in memory at CP, SFRs at 0xF000-0xFFFF of
+// segment 0, and data accesses are translated through DPP0-3 unless an
+// EXTP/EXTS sequence is active. The difftest runs it as the reference the
+// lifted IL is checked against.
+class Emulator {
+ public:
+  enum Status {
+    StatusOk,
+    StatusHalted,  // IDLE/PWRDN/SRST or another system control instruction
+    StatusInvalid  // Unknown or unsupported encoding; PC is left unchanged
+  };
+
+  static constexpr uint32_t memory_size = 0x1000000;
+
+  // RETI/TRAP push and pop CSP only when segmentation is enabled
+  bool segmented;
+
+  Emulator();
+
+  void Reset();
+  void Load(uint32_t addr, const uint8_t *data, size_t len);
+  const std::vector<uint8_t> &GetMemory() const { return memory; }
+
+  uint8_t ReadByte(uint32_t addr) const;
+  uint16_t ReadWord(uint32_t addr) const;
+  void WriteByte(uint32_t addr, uint8_t value);
+  void WriteWord(uint32_t addr, uint16_t value);
+
+  uint16_t GetRegister(uint8_t rw) const;
+  void SetRegister(uint8_t rw, uint16_t value);
+  uint16_t GetSfr(uint16_t sfr) const;
+  void SetSfr(uint16_t sfr, uint16_t value);
+  uint32_t GetPc() const;
+  void SetPc(uint32_t pc);
+
+  // Physical address of a 16-bit data address under the current DPP/EXT state
+  uint32_t TranslateData(uint16_t addr) const;
+
+  Status Step();
+  // Steps until the PC leaves [start, end), an instruction halts or fails, or
+  // max_steps instructions have executed. Returns the number of steps taken.
+  size_t Run(uint32_t start, uint32_t end, size_t max_steps, Status &status);
+
+ private:
+  enum ExtMode { ExtNone, ExtPage, ExtSegment };
+
+  std::vector<uint8_t> memory;
+  uint16_t ip;
+  ExtMode ext_mode;
+  uint16_t ext_value;
+  bool ext_reg;
+  uint8_t ext_count;  // Instructions left in the EXT sequence (incl. current)
+
+  uint32_t RegAddr(uint8_t reg) const;
+  uint32_t RegByteAddr(uint8_t reg) const;
+  uint32_t BitoffAddr(uint8_t bitoff) const;
+  uint32_t GprAddr(uint8_t rw) const;
+  uint32_t GprByteAddr(uint8_t rb) const;
+
+  uint8_t GetByteRegister(uint8_t rb) const;
+  void SetByteRegister(uint8_t rb, uint8_t value);
+  uint16_t ReadData(uint16_t addr, bool byte) const;
+  void WriteData(uint16_t addr, uint16_t value, bool byte);
+
+  void SetFlag(uint8_t flag, bool set);
+  bool GetFlag(uint8_t flag) const;
+  void SetResultFlags(uint32_t result, bool byte);
+  bool TestCondition(uint8_t cc) const;
+
+  void Push(uint16_t value);
+  uint16_t Pop();
+
+  uint16_t Alu(uint8_t op, uint16_t a, uint16_t b, bool byte);
+  Status StepAlu(const uint8_t *data);
+  Status StepMov(const uint8_t *data);
+  Status StepBit(const uint8_t *data);
+  Status StepShift(const uint8_t *data);
+  Status StepMulDiv(const uint8_t *data);
+  Status StepBranch(const uint8_t *data);
+};
+}  // namespace C166
+
+#endif  // TESTS_EMULATOR_H_
@@ -0,0 +1,387 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+// Stand-in for the parts of the Binary Ninja API that the lifter sources
+// (lift.cpp, util.cpp, flags.cpp) use, so that they can be built and
+// exercised without the core. LowLevelILFunction only records the expressions
+// it is asked to build; difftest.cpp evaluates them.
+
+#ifndef TESTS_STUB_BINARYNINJAAPI_H_
+#define TESTS_STUB_BINARYNINJAAPI_H_
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+enum BNLowLevelILOperation {
+  LLIL_NOP,
+  LLIL_SET_REG,
+  LLIL_SET_REG_SPLIT,
+  LLIL_SET_FLAG,
+  LLIL_LOAD,
+  LLIL_STORE,
+  LLIL_PUSH,
+  LLIL_POP,
+  LLIL_REG,
+  LLIL_REG_SPLIT,
+  LLIL_CONST,
+  LLIL_CONST_PTR,
+  LLIL_FLAG,
+  LLIL_ADD,
+  LLIL_ADC,
+  LLIL_SUB,
+  LLIL_SBB,
+  LLIL_AND,
+  LLIL_OR,
+  LLIL_XOR,
+  LLIL_LSL,
+  LLIL_LSR,
+  LLIL_ASR,
+  LLIL_ROL,
+  LLIL_ROR,
+  LLIL_MUL,
+  LLIL_MULU_DP,
+  LLIL_MULS_DP,
+  LLIL_DIVU,
+  LLIL_DIVU_DP,
+  LLIL_DIVS,
+  LLIL_DIVS_DP,
+  LLIL_MODU,
+  LLIL_MODU_DP,
+  LLIL_MODS,
+  LLIL_MODS_DP,
+  LLIL_NEG,
+  LLIL_NOT,
+  LLIL_SX,
+  LLIL_ZX,
+  LLIL_LOW_PART,
+  LLIL_JUMP,
+  LLIL_CALL,
+  LLIL_CALL_STACK_ADJUST,
+  LLIL_TAILCALL,
+  LLIL_RET,
+  LLIL_NORET,
+  LLIL_IF,
+  LLIL_GOTO,
+  LLIL_FLAG_GROUP,
+  LLIL_CMP_E,
+  LLIL_CMP_NE,
+  LLIL_CMP_UGT,
+  LLIL_INTRINSIC,
+  LLIL_UNIMPL,
+  LLIL_UNIMPL_MEM
+};
+
+enum BNLowLevelILFlagCondition {
+  LLFC_E,
+  LLFC_NE,
+  LLFC_SLT,
+  LLFC_ULT,
+  LLFC_SLE,
+  LLFC_ULE,
+  LLFC_SGE,
+  LLFC_UGE,
+  LLFC_SGT,
+  LLFC_UGT,
+  LLFC_NEG,
+  LLFC_POS,
+  LLFC_O,
+  LLFC_NO
+};
+
+enum BNFlagRole {
+  SpecialFlagRole,
+  ZeroFlagRole,
+  PositiveSignFlagRole,
+  NegativeSignFlagRole,
+  CarryFlagRole,
+  InvertedCarryFlagRole,
+  OverflowFlagRole
+};
+
+enum BNBranchType {
+  UnconditionalBranch,
+  FalseBranch,
+  TrueBranch,
+  CallDestination,
+  FunctionReturn,
+  SystemCall,
+  IndirectBranch,
+  UnresolvedBranch
+};
+
+enum BNInstructionTextTokenType {
+  TextToken,
+  InstructionToken,
+  OperandSeparatorToken,
+  RegisterToken,
+  IntegerToken,
+  PossibleAddressToken,
+  BeginMemoryOperandToken,
+  EndMemoryOperandToken,
+  CodeRelativeAddressToken
+};
+
+#define LLIL_TEMP(n) (0x80000000 | (n))
+#define LLIL_REG_IS_TEMP(n) (((n) & 0x80000000) != 0)
+
+struct BNRegisterOrConstant {
+  bool constant;
+  uint32_t reg;
+  uint64_t value;
+};
+
+struct BNLowLevelILLabel {
+  bool resolved;
+  size_t ref;
+  size_t operand;
+};
+
+namespace BinaryNinja {
+
+typedef size_t ExprId;
+
+class Architecture;
+
+struct ILSourceLocation {};
+
+struct LowLevelILLabel : BNLowLevelILLabel {
+  LowLevelILLabel() : BNLowLevelILLabel{} {}
+};
+
+struct RegisterOrFlag {
+  bool is_flag;
+  uint32_t index;
+
+  static RegisterOrFlag Register(uint32_t reg) { return {false, reg}; }
+  static RegisterOrFlag Flag(uint32_t flag) { return {true, flag}; }
+};
+
+struct InstructionInfo {
+  size_t length;
+  void AddBranch(BNBranchType, uint64_t = 0, Architecture * = nullptr,
+                 bool = false) {}
+};
+
+struct InstructionTextToken {
+  template <class... Args>
+  explicit InstructionTextToken(Args &&...) {}
+};
+
+inline void LogDebug(const char *, ...) {}
+inline void LogInfo(const char *, ...) {}
+inline void LogWarn(const char *fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  std::vfprintf(stderr, fmt, args);
+  std::fputc('\n', stderr);
+  va_end(args);
+}
+inline void LogError(const char *fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  std::vfprintf(stderr, fmt, args);
+  std::fputc('\n', stderr);
+  va_end(args);
+}
+
+// One recorded expression. Operands are expression indices, register or flag
+// numbers, or constants depending on the operation, in the order the builder
+// method takes them.
+struct LowLevelILExpr {
+  BNLowLevelILOperation operation;
+  size_t size;
+  uint32_t flags;
+  uint64_t operands[4];
+};
+
+class LowLevelILFunction {
+ public:
+  std::vector<LowLevelILExpr> exprs;
+  std::vector<ExprId> instructions;
+
+  ExprId AddExpr(BNLowLevelILOperation operation, size_t size, uint32_t flags,
+                 uint64_t a = 0, uint64_t b = 0, uint64_t c = 0,
+                 uint64_t d = 0) {
+    exprs.push_back({operation, size, flags, {a, b, c, d}});
+    return exprs.size() - 1;
+  }
+
+  ExprId AddInstruction(ExprId expr) {
+    instructions.push_back(expr);
+    return instructions.size() - 1;
+  }
+
+  // Labels never resolve, so branches are lifted as jumps
+  BNLowLevelILLabel *GetLabelForAddress(Architecture *, uint64_t) {
+    return nullptr;
+  }
+  void MarkLabel(BNLowLevelILLabel &label) {
+    label.resolved = true;
+    label.ref = instructions.size();
+  }
+
+  ExprId Nop(const ILSourceLocation & = {}) { return AddExpr(LLIL_NOP, 0, 0); }
+  ExprId SetRegister(size_t size, uint32_t reg, ExprId value,
+                     uint32_t flags = 0, const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_SET_REG, size, flags, reg, value);
+  }
+  ExprId SetRegisterSplit(size_t size, uint32_t high, uint32_t low,
+                          ExprId value, uint32_t flags = 0,
+                          const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_SET_REG_SPLIT, size, flags, high, low, value);
+  }
+  ExprId SetFlag(uint32_t flag, ExprId value, const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_SET_FLAG, 0, 0, flag, value);
+  }
+  ExprId Load(size_t size, ExprId addr, uint32_t flags = 0,
+              const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_LOAD, size, flags, addr);
+  }
+  ExprId Store(size_t size, ExprId addr, ExprId value, uint32_t flags = 0,
+               const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_STORE, size, flags, addr, value);
+  }
+  ExprId Push(size_t size, ExprId value, uint32_t flags = 0,
+              const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_PUSH, size, flags, value);
+  }
+  ExprId Pop(size_t size, uint32_t flags = 0, const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_POP, size, flags);
+  }
+  ExprId Register(size_t size, uint32_t reg, const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_REG, size, 0, reg);
+  }
+  ExprId RegisterSplit(size_t size, uint32_t high, uint32_t low,
+                       const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_REG_SPLIT, size, 0, high, low);
+  }
+  ExprId Const(size_t size, uint64_t value, const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_CONST, size, 0, value);
+  }
+  ExprId ConstPointer(size_t size, uint64_t value,
+                      const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_CONST_PTR, size, 0, value);
+  }
+  ExprId Flag(uint32_t flag, const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_FLAG, 0, 0, flag);
+  }
+  ExprId GetExprForRegisterOrConstant(const BNRegisterOrConstant &operand,
+                                      size_t size) {
+    return operand.constant ? Const(size, operand.value)
+                            : Register(size, operand.reg);
+  }
+
+#define STUB_BINARY_OP(name, operation)                                  \
+  ExprId name(size_t size, ExprId a, ExprId b, uint32_t flags = 0,       \
+              const ILSourceLocation & = {}) {                           \
+    return AddExpr(operation, size, flags, a, b);                        \
+  }
+  STUB_BINARY_OP(Add, LLIL_ADD)
+  STUB_BINARY_OP(Sub, LLIL_SUB)
+  STUB_BINARY_OP(And, LLIL_AND)
+  STUB_BINARY_OP(Or, LLIL_OR)
+  STUB_BINARY_OP(Xor, LLIL_XOR)
+  STUB_BINARY_OP(ShiftLeft, LLIL_LSL)
+  STUB_BINARY_OP(LogicalShiftRight, LLIL_LSR)
+  STUB_BINARY_OP(ArithShiftRight, LLIL_ASR)
+  STUB_BINARY_OP(RotateLeft, LLIL_ROL)
+  STUB_BINARY_OP(RotateRight, LLIL_ROR)
+  STUB_BINARY_OP(Mult, LLIL_MUL)
+  STUB_BINARY_OP(MultDoublePrecUnsigned, LLIL_MULU_DP)
+  STUB_BINARY_OP(MultDoublePrecSigned, LLIL_MULS_DP)
+  STUB_BINARY_OP(DivUnsigned, LLIL_DIVU)
+  STUB_BINARY_OP(DivDoublePrecUnsigned, LLIL_DIVU_DP)
+  STUB_BINARY_OP(DivSigned, LLIL_DIVS)
+  STUB_BINARY_OP(DivDoublePrecSigned, LLIL_DIVS_DP)
+  STUB_BINARY_OP(ModUnsigned, LLIL_MODU)
+  STUB_BINARY_OP(ModDoublePrecUnsigned, LLIL_MODU_DP)
+  STUB_BINARY_OP(ModSigned, LLIL_MODS)
+  STUB_BINARY_OP(ModDoublePrecSigned, LLIL_MODS_DP)
+#undef STUB_BINARY_OP
+
+  ExprId AddCarry(size_t size, ExprId a, ExprId b, ExprId carry,
+                  uint32_t flags = 0, const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_ADC, size, flags, a, b, carry);
+  }
+  ExprId SubBorrow(size_t size, ExprId a, ExprId b, ExprId carry,
+                   uint32_t flags = 0, const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_SBB, size, flags, a, b, carry);
+  }
+
+#define STUB_UNARY_OP(name, operation)                                 \
+  ExprId name(size_t size, ExprId a, uint32_t flags = 0,               \
+              const ILSourceLocation & = {}) {                         \
+    return AddExpr(operation, size, flags, a);                         \
+  }
+  STUB_UNARY_OP(Neg, LLIL_NEG)
+  STUB_UNARY_OP(Not, LLIL_NOT)
+  STUB_UNARY_OP(SignExtend, LLIL_SX)
+  STUB_UNARY_OP(ZeroExtend, LLIL_ZX)
+  STUB_UNARY_OP(LowPart, LLIL_LOW_PART)
+#undef STUB_UNARY_OP
+
+  ExprId CompareEqual(size_t size, ExprId a, ExprId b,
+                      const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_CMP_E, size, 0, a, b);
+  }
+  ExprId CompareNotEqual(size_t size, ExprId a, ExprId b,
+                         const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_CMP_NE, size, 0, a, b);
+  }
+  ExprId CompareUnsignedGreaterThan(size_t size, ExprId a, ExprId b,
+                                    const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_CMP_UGT, size, 0, a, b);
+  }
+  ExprId FlagGroup(uint32_t group, const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_FLAG_GROUP, 0, 0, group);
+  }
+
+  ExprId Jump(ExprId dest, const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_JUMP, 0, 0, dest);
+  }
+  ExprId Call(ExprId dest, const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_CALL, 0, 0, dest);
+  }
+  ExprId CallStackAdjust(ExprId dest, int64_t adjust,
+                         const std::map<uint32_t, int32_t> &,
+                         const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_CALL_STACK_ADJUST, 0, 0, dest, adjust);
+  }
+  ExprId TailCall(ExprId dest, const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_TAILCALL, 0, 0, dest);
+  }
+  ExprId Return(ExprId dest, const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_RET, 0, 0, dest);
+  }
+  ExprId NoReturn(const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_NORET, 0, 0);
+  }
+  ExprId If(ExprId condition, BNLowLevelILLabel &, BNLowLevelILLabel &,
+            const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_IF, 0, 0, condition);
+  }
+  ExprId Goto(BNLowLevelILLabel &, const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_GOTO, 0, 0);
+  }
+  ExprId Intrinsic(const std::vector<RegisterOrFlag> &, uint32_t intrinsic,
+                   const std::vector<ExprId> &, uint32_t flags = 0,
+                   const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_INTRINSIC, 0, flags, intrinsic);
+  }
+  ExprId Unimplemented(const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_UNIMPL, 0, 0);
+  }
+  ExprId UnimplementedMemoryRef(size_t size, ExprId addr,
+                                const ILSourceLocation & = {}) {
+    return AddExpr(LLIL_UNIMPL_MEM, size, 0, addr);
+  }
+};
+}  // namespace BinaryNinja
+
+#endif  // TESTS_STUB_BINARYNINJAAPI_H_
@@ -0,0 +1,4 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+// Everything lift.cpp needs is declared in binaryninjaapi.h